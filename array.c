@@ -19,50 +19,246 @@ Noweb home page: http://www.cs.tufts.edu/~nr/noweb/
 It's easiest to read or modify this file by working with array.w.
 */
 
+#define  ZTAG  ZT_ARRAY
 #include "mawk.h"
 #include "symtype.h"
 #include "memory.h"
 #include "split.h"
 #include "field.h"
 #include "bi_vars.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#endif
 typedef struct itable ITable ;
 static CELL* itable_find(ITable* it, STRING* sval, int64_t ival, 
                          int flag, size_t* sizep) ;
+#define DVEC_SEGS   32
+#define DVEC_INIT   8
+typedef struct dvec {
+    int origin ;  /* the key of element 0, 0 or 1 */
+    int nseg ;  /* number of segments in use */
+    int base_log ;  /* log2(base), or -1 if base is not a power of 2 */
+    size_t base ;  /* nodes in seg[0] */
+    size_t limit ;  /* nodes in all the segments */
+    struct hnode* seg[DVEC_SEGS] ;
+} DVEC ;
+#define dvec_cell(dv, i)  (&dvec_node(dv, i)->cell)
+static DVEC* new_dvec(size_t, int) ;
+static int floor_log2(size_t) ;
+static struct hnode* dvec_node(DVEC*, size_t) ;
+static int dvec_grow(DVEC*) ;
+static CELL* dvec_push(ARRAY) ;
+static void dvec_free(DVEC*) ;
+
 static void array_int_to_str(ARRAY) ;
 static void array_split_to_int(ARRAY) ;
 static void array_split_to_str(ARRAY) ;
 
-#ifdef QSORT
-static int i_compare(const void*, const void*) ;
-static int s_compare(const void*, const void*) ;
+static void aloop_free_keys(ALoop*) ;
+static void aloop_snapshot(ARRAY) ;
+
+typedef struct sort_item {
+    union {
+        uint64_t u ;
+        STRING* s ;
+    } sk ;  /* sort key */
+    union {
+        int64_t ival ;
+        STRING* sval ;
+        CELL* cp ;
+    } key ;  /* the index, or the value */
+} SortItem ;
+static int aloop_order(void) ;
+static void aloop_sort(ALoop*, ARRAY, int) ;
+static void sort_items(SortItem*, ARRAY, int, int) ;
+static uint64_t double_sort_key(double) ;
+static int sort_item_key(SortItem*, int, STRING*, int64_t, CELL*) ;
+static void radix_sort(SortItem*, size_t) ;
+static int sk_byte(const SortItem*, size_t) ;
+static int sk_compare(const SortItem*, const SortItem*, size_t) ;
+static void sort_by_string(SortItem*, size_t, size_t) ;
+
+static char* cat_buff ;
+static size_t cat_size ;
+static size_t int_key(char*, int64_t) ;
+static void cat_reserve(size_t) ;
+
+#define SPILL_MIN  4096
+static ARRAY* big_arrays ;
+static unsigned big_cnt ;  /* number on the list */
+static unsigned big_max ;  /* room on the list */
+
+#define SPILL_PART  32
+#define SPILL_MAXPARTS  (1U << 24)
+typedef struct spill_part {
+    ITable* ht ;  /* the elements if in memory, else 0 */
+    struct spill* spill ;  /* the array this is part of */
+    struct spill_part* prev ;  /* list of partitions in memory */
+    struct spill_part* next ;
+    int64_t offset ;
+    size_t room ;
+    size_t bytes ;
+    size_t cnt ;
+    int dirty ;
+} SpillPart ;
+
+typedef struct spill {
+    FILE* fp ;
+    int64_t end ;  /* bytes of fp in use */
+    unsigned nparts ;
+    SpillPart* parts ;
+} Spill ;
+
+typedef struct spill_rec {
+    size_t klen ;  /* bytes of key */
+    size_t slen ;  /* bytes of string value */
+    double dval ;
+    int type ;  /* of the value */
+} SpillRec ;
+
+static SpillPart* lru_first ;
+static SpillPart* lru_last ;
+static char* spill_buff ;  /* records on their way to or from disk */
+static size_t spill_buff_size ;
+#define spill_part(S, s, len)  ((unsigned) hash64(s, len) & ((S)->nparts-1))
+#define value_is_string(t)  ((t) == C_STRING || (t) == C_STRNUM || (t) == C_MBSTRN)
+
+#if defined(_WIN32) || defined(_WIN64)
+#define spill_seek(fp, off)  _fseeki64(fp, off, SEEK_SET)
+#else
+#define spill_seek(fp, off)  fseeko(fp, (off_t) (off), SEEK_SET)
+#endif
+static void big_add(ARRAY) ;
+static void big_remove(ARRAY) ;
+static int table_pinned(ITable*, CELL*, CELL*) ;
+static CELL* spill_find(Spill*, STRING*, int, size_t*) ;
+static ITable* spill_table(Spill*, unsigned) ;
+static void lru_push(SpillPart*) ;
+static void lru_unlink(SpillPart*) ;
+static int array_to_disk(ARRAY) ;
+static const char* key_chars(uint64_t, char*, size_t*) ;
+static unsigned node_part(Spill*, const struct hnode*) ;
+static size_t rec_put(char*, const char*, size_t, const CELL*) ;
+static size_t spill_put(char*, struct hnode*) ;
+static size_t spill_get(const char*, ITable*) ;
+static char* spill_buffer(size_t) ;
+static void spill_error(void) ;
+static void spill_load(SpillPart*) ;
+static void spill_store(SpillPart*) ;
+static size_t spill_size(const struct hnode*) ;
+static void spill_free(Spill*) ;
+static FILE* spill_tmpfile(void) ;
+static void spill_keys(ALoop*, ITable*) ;
+
+#define MAP_MAGIC  "wmawk2A"
+#define MAP_ORDER  0x01020304
+typedef struct map_head {
+    char magic[8] ;
+    uint32_t order ;  /* MAP_ORDER as written */
+    uint32_t rec_size ;  /* sizeof(SpillRec) */
+    uint64_t size ;  /* number of elements */
+    uint64_t nslots ;  /* a power of 2 */
+    uint64_t end ;  /* size of the file */
+} MapHead ;
+
+typedef struct map_slot {
+    uint64_t hval ;
+    uint64_t offset ;
+} MapSlot ;
+typedef struct dump_file {
+    FILE* fp ;
+    MapSlot* slots ;
+    uint64_t nslots ;
+    uint64_t offset ;  /* of the next record */
+} DumpFile ;
+
+#if defined(_WIN32) || defined(_WIN64)
+#define dump_rename(tmp, name)  \
+        MoveFileExA(tmp, name, MOVEFILE_REPLACE_EXISTING)
+#else
+#define dump_rename(tmp, name)  (rename(tmp, name) == 0)
 #endif
+typedef struct amap {
+    const char* base ;  /* the mapped file */
+    size_t len ;
+    ITable* ht ;  /* the elements looked up */
+} AMap ;
+static void dump_table(DumpFile*, ITable*) ;
+static void dump_element(DumpFile*, const char*, size_t, const CELL*) ;
+static CELL* map_find(AMap*, STRING*) ;
+static const char* map_record(AMap*, const char*, size_t) ;
+static void map_to_str(ARRAY) ;
+static void map_free(AMap*) ;
+static const char* map_check(AMap*, uint64_t) ;
+static void map_error(void) ;
+static const char* map_file(const char*, size_t*) ;
+static void unmap_file(const char*, size_t) ;
 
 typedef struct hnode {
-    struct hnode* link ;
-    int64_t ival ;
-    STRING* key ;
+    union {
+        int64_t ival ;
+        uint64_t word ;
+    } key ;
     CELL cell ;
 } HNODE ;
-#define INIT_HMASK   255
-#define MAX_AVE_BUCKET_SIZE   4
+#define NODE_FREE  (-1)
+
+typedef struct hblock {
+    size_t cnt ;  /* number of HNODEs that follow */
+} HBLOCK ;
+#define hblock_nodes(b)  ((HNODE*)((b)+1))
+#define node_hblock(p)   ((HBLOCK*)(p)-1)
+#define KEY_INLINE  7
+#define key_is_inline(w)  ((w) & 1)
+#define key_sval(w)  ((STRING*)(uintptr_t)(w))
+typedef struct hslot {
+    uint32_t hfrag ;
+    uint32_t node ;
+} HSLOT ;
+#define hash_frag(hval) \
+        ((uint32_t) (((hval) * 0x9e3779b97f4a7c15ULL) >> 32))
+#define INIT_HMASK   15
+#define hslot_home(hfrag, shift)  ((unsigned) ((hfrag) >> (shift)))
+#define hslot_dist(ht, i) \
+        (((i) - hslot_home((ht)->slots[i].hfrag, (ht)->shift)) & (ht)->hmask)
+#define itable_node(ht, n)  dvec_node((ht)->nodes, (n)-1)
 struct itable {
     unsigned hmask ;
+    int shift ;
     unsigned size ;
     unsigned limit ;
-    HNODE** buckets ;
+    int str_keys ;  /* keyed on strings */
+    HSLOT* slots ;
+    size_t used ;  /* nodes[0..used-1] have been used */
+    int64_t free_nodes ;  /* one more than the first free node index */
+    DVEC* nodes ;
 } ;
-static HNODE** make_buckets(unsigned) ;
+static void make_slots(ITable*, unsigned) ;
 static ITable* make_empty_itable(void) ;
-    
-static void hnode_free(HNODE*) ;
+static uint64_t inline_key(const char*, size_t) ;
+static uint64_t make_key(STRING*) ;
+static STRING* node_key(const HNODE*) ;
+static void free_key(uint64_t) ;
+
+static void hslot_insert(ITable*, HSLOT, unsigned, unsigned) ;
+static HBLOCK* new_hblock(size_t) ;
+static void hblock_free(HBLOCK*) ;
+static HNODE* new_hnode(ITable*, uint32_t*) ;
+static void hnode_free(ITable*, HNODE*, uint32_t) ;
 static void itable_free(ITable*) ;
 
 static void itable_convert_i_to_s(ITable*) ;
+static uint32_t int_to_str_key(HNODE*, int64_t) ;
+
+static ITable* itable_from_dvec(DVEC*, size_t, int) ;
+
+static void double_num_slots(ITable*) ;
 
-static void double_num_buckets(ITable*) ;
-        
-static int64_t* itable_i_vector(ITable*) ;
-static STRING** itable_s_vector(ITable*) ;
 CELL* array_find(ARRAY A, CELL *cp, int create_flag)
 {
     CELL key ; /* a copy of *cp */
@@ -74,9 +270,15 @@ reswitch:
     switch(A->type) {
         case AY_NULL:
             {
-                ITable* tb = make_empty_itable() ;
-                A->ptr = tb ;
+                ITable* tb ;
                 A->size = 0 ;
+                if (key.type == C_DOUBLE && (key.dval == 0.0 || key.dval == 1.0)) {
+                    A->ptr = new_dvec(DVEC_INIT, (int) key.dval) ;
+                    A->type = AY_SPLIT ;
+                    return dvec_push(A) ;
+                }
+                tb = make_empty_itable() ;
+                A->ptr = tb ;
                 if (key.type != C_DOUBLE || !is_int_double(key.dval)) {
                     A->type = AY_STR ;
                     goto reswitch ;
@@ -88,22 +290,28 @@ reswitch:
 
         case AY_SPLIT:
             {
+                DVEC* dv = (DVEC*)A->ptr ;
+                double d ;
                 if (key.type != C_DOUBLE || !is_int_double(key.dval)) {
                     array_split_to_str(A) ;
                     goto reswitch ;
                 }
-                if (key.dval < 1.0 || key.dval > (double) A->size) {
-                    if (create_flag) {
-                        array_split_to_int(A) ;
-                        goto reswitch ;
-                    }
-                    else  return 0 ;
+                d = key.dval - dv->origin ;
+                if (d >= 0.0 && d < (double) A->size) {
+                    /* the expected case */
+                    return dvec_cell(dv, (size_t) d) ;
+                }
+                else if (!create_flag) {
+                    return 0 ;
                 }
                 else {
-                    /* the expected case */
-                    CELL* cells = (CELL*)A->ptr ;
-                    unsigned d = (unsigned) key.dval ;
-                    return &cells[d-1] ;
+                    CELL* cp ;
+                    if (A->loops) aloop_snapshot(A) ;
+                    if (d == (double) A->size && (cp = dvec_push(A))) {
+                        return cp ;
+                    }
+                    array_split_to_int(A) ;
+                    goto reswitch ;
                 }
             }
 
@@ -111,9 +319,52 @@ reswitch:
             { 
                 CELL* ret ;
                 cast1_to_s(&key) ;
+                if (A->loops && create_flag) {
+                    ret = itable_find((ITable*)A->ptr, string(&key), 0,
+                                      NO_CREATE, &A->size) ;
+                    if (ret) {
+                        free_STRING(string(&key)) ;
+                        return ret ;
+                    }
+                    aloop_snapshot(A) ;
+                }
+
                 ret = itable_find((ITable*)(A->ptr),string(&key), 0,
                           create_flag, &A->size) ;
                 free_STRING(string(&key)) ;
+                if (A->size >= SPILL_MIN && !A->big) big_add(A) ;
+                return ret ;
+            }
+        case AY_SPILL:
+            {
+                CELL* ret ;
+                cast1_to_s(&key) ;
+                if (A->loops && create_flag) {
+                    ret = spill_find((Spill*)A->ptr, string(&key),
+                                     NO_CREATE, &A->size) ;
+                    if (ret) {
+                        free_STRING(string(&key)) ;
+                        return ret ;
+                    }
+                    aloop_snapshot(A) ;
+                }
+                ret = spill_find((Spill*)A->ptr, string(&key),
+                                 create_flag, &A->size) ;
+                free_STRING(string(&key)) ;
+                return ret ;
+            }
+        case AY_MAPPED:
+            {
+                AMap* M = (AMap*)A->ptr ;
+                CELL* ret ;
+                cast1_to_s(&key) ;
+                ret = map_find(M, string(&key)) ;
+                if (ret == 0 && create_flag) {
+                    size_t dummy ;
+                    ret = itable_find(M->ht, string(&key), 0, CREATE, &dummy) ;
+                    A->size++ ;
+                }
+                free_STRING(string(&key)) ;
                 return ret ;
             }
         case AY_INT:
@@ -122,6 +373,13 @@ reswitch:
                     array_int_to_str(A) ;
                     goto reswitch ;
                 }
+                if (A->loops && create_flag) {
+                    CELL* ret = itable_find((ITable*)A->ptr, 0, (int64_t) key.dval,
+                                            NO_CREATE, &A->size) ;
+                    if (ret) return ret ;
+                    aloop_snapshot(A) ;
+                }
+
                 /* the expected case */
                 return itable_find((ITable*)A->ptr, 0, (int64_t)key.dval, 
                            create_flag, &A->size) ;
@@ -143,6 +401,14 @@ reswitch:
             itable_find((ITable*)A->ptr, string(&key), 0, DELETE_, &A->size) ;
             free_STRING(string(&key)) ;
             break ;
+        case AY_SPILL:
+            cast1_to_s(&key) ;
+            spill_find((Spill*)A->ptr, string(&key), DELETE_, &A->size) ;
+            free_STRING(string(&key)) ;
+            break ;
+        case AY_MAPPED:
+            map_to_str(A) ;
+            goto reswitch ;
         case AY_INT:
             if (key.type != C_DOUBLE || !is_int_double(key.dval)) {
                 array_int_to_str(A) ;
@@ -155,12 +421,22 @@ reswitch:
             if (key.type != C_DOUBLE || !is_int_double(key.dval)) {
                 array_split_to_str(A) ;
             }
-            else if (key.dval < 1.0 || key.dval > (double)A->size) {
-                /* not in the array so nothing to do */
-                return ;
-            }
             else {
-                array_split_to_int(A) ;
+                DVEC* dv = (DVEC*)A->ptr ;
+                double d = key.dval - dv->origin ;
+                if (d < 0.0 || d >= (double)A->size) {
+                    /* not in the array so nothing to do */
+                    return ;
+                }
+                else if (d == (double)(A->size-1)) {
+                    /* the last element, stays dense */
+                    cell_destroy(dvec_cell(dv, A->size-1)) ;
+                    A->size-- ;
+                    break ;
+                }
+                else {
+                    array_split_to_int(A) ;
+                }
             }
             goto reswitch ;
     }
@@ -170,24 +446,34 @@ void array_load(ARRAY A, size_t cnt)
 {
     array_clear(A) ;
     if (cnt > 0) {
-        CELL* cells = (CELL*)zmalloc(sizeof(CELL) * cnt) ;
-        memset(cells, 0, sizeof(CELL) * cnt) ;
+        DVEC* dv = new_dvec(cnt, 1) ;
         A->size = cnt ;
         A->type = AY_SPLIT ;
-        A->ptr = cells ;
-        transfer_to_array(cells, cnt) ;
+        A->ptr = dv ;
+        transfer_to_array(&dv->seg[0]->cell, cnt, sizeof(HNODE)) ;
     }
 }
+#define RECLAIM_SIZE  4096  /* a big array, see zreclaim() */
+
 void array_clear(ARRAY A)
 {
+    size_t size = A->size ;
     if (A->type == AY_NULL) return ;
+    if (A->loops) aloop_snapshot(A) ;
+    if (A->big) big_remove(A) ;
 
     if (A->type == AY_SPLIT) {
-        unsigned i ;
+        size_t i ;
         for(i = 0; i < A->size; i++) {
-            cell_destroy((CELL*)A->ptr+i) ;
+            cell_destroy(dvec_cell((DVEC*)A->ptr, i)) ;
         }
-        zfree(A->ptr, A->size * sizeof(CELL)) ;
+        dvec_free((DVEC*)A->ptr) ;
+    }
+    else if (A->type == AY_SPILL) {
+        spill_free((Spill*)A->ptr) ;
+    }
+    else if (A->type == AY_MAPPED) {
+        map_free((AMap*)A->ptr) ;
     }
     else {
         itable_free((ITable*)A->ptr) ;
@@ -196,64 +482,175 @@ void array_clear(ARRAY A)
     A->ptr = 0 ;
     A->size = 0 ;
     A->type = AY_NULL ;
+    if (size >= RECLAIM_SIZE) zreclaim() ;
 }
 ALoop* make_aloop(ARRAY A, CELL* cp) 
 {
-    ALoop* al = (ALoop*)zmalloc(sizeof(ALoop)) ;
+    ALoop* al = ZMALLOC(ALoop) ;
+    int order ;
+    if (A->type == AY_MAPPED) map_to_str(A) ;
+    order = A->type == AY_NULL ? AL_UNSORTED : aloop_order() ;
     al->type = A->type ;
-    al->size = A->size ;
+    al->origin = 0 ;
+    al->size = 0 ;
     al->next = 0 ;
+    al->part = 0 ;
     al->cp = cp ;
     al->link = 0 ;
-    if (al->type == AY_INT) {
-        al->ptr.ival = itable_i_vector((ITable*)(A->ptr)) ;
-#ifdef QSORT
-        qsort(al->ptr.ival, al->size, sizeof(int64_t), i_compare) ;
-#endif
+    al->alink = 0 ;
+    al->A = 0 ;
+    if (order != AL_UNSORTED) {
+        aloop_sort(al, A, order) ;
     }
-    else if (al->type == AY_STR) {
-        al->ptr.sval = itable_s_vector((ITable*)(A->ptr)) ;
-#ifdef QSORT
-        qsort(al->ptr.sval, al->size, sizeof(STRING*), s_compare) ;
-#endif
+    else if (al->type != AY_NULL) {
+        /* walk A in place */
+        al->A = A ;
+        al->alink = A->loops ;
+        A->loops = al ;
+        if (al->type == AY_SPLIT) {
+            al->origin = ((DVEC*)A->ptr)->origin ;
+        }
     }
     return al ;
 }
 void aloop_free(ALoop* al)
 {
-    if (al->type == AY_INT) {
-        zfree(al->ptr.ival, sizeof(int64_t) * al->size) ;
-    }
-    else if (al->type == AY_STR) {
-        unsigned i ;
-        for(i=0; i < al->size; i++) {
-            free_STRING(al->ptr.sval[i]) ;
-        }
-        zfree(al->ptr.sval, sizeof(STRING*) * al->size) ;
+    if (al->A) {
+        /* take it off the list of in place loops on A */
+        ALoop** pp = &al->A->loops ;
+        while(*pp != al) pp = &(*pp)->alink ;
+        *pp = al->alink ;
     }
+    if (al->A == 0 || al->type == AY_SPILL) aloop_free_keys(al) ;
     zfree(al, sizeof(ALoop)) ;
 }
 int aloop_next(ALoop* al)
 {
-    if (al->next >= al->size) return 0 ;
-    cell_destroy(al->cp) ;
-    switch(al->type) {
-        case AY_SPLIT:
+    if (al->A) {
+        if (al->type == AY_SPLIT) {
+            if (al->next >= al->A->size) return 0 ;
+            cell_destroy(al->cp) ;
             al->cp->type = C_DOUBLE ;
-            al->cp->dval = (double) (al->next+1) ;
-            break ;
-        case AY_INT:
+            al->cp->dval = (double) al->next + al->origin ;
+            al->next++ ;
+        }
+        else if (al->type == AY_SPILL) {
+            {
+                Spill* S = (Spill*)al->A->ptr ;
+                STRING* sval ;
+                do {
+                    while(al->next >= al->size) {
+                        aloop_free_keys(al) ;
+                        if (al->part == S->nparts) return 0 ;
+                        spill_keys(al, spill_table(S, al->part++)) ;
+                    }
+                    sval = al->ptr.sval[al->next++] ;
+                } while(!spill_find(S, sval, NO_CREATE, &al->A->size)) ;
+                cell_destroy(al->cp) ;
+                al->cp->type = C_STRING ;
+                al->cp->ptr = (PTR) STRING_dup(sval) ;
+            }
+
+        }
+        else {
+            ITable* ht = (ITable*)al->A->ptr ;
+            HNODE* p ;
+            do {
+                if (al->next >= ht->used) return 0 ;
+                p = dvec_node(ht->nodes, al->next++) ;
+            } while(p->cell.type == NODE_FREE) ;
+            cell_destroy(al->cp) ;
+            if (al->type == AY_INT) {
+                al->cp->type = C_DOUBLE ;
+                al->cp->dval = (double) p->key.ival ;
+            }
+            else {
+                al->cp->type = C_STRING ;
+                al->cp->ptr = (PTR) node_key(p) ;
+            }
+        }
+
+    }
+    else {
+        if (al->next >= al->size) return 0 ;
+        cell_destroy(al->cp) ;
+        if (al->type == AY_INT) {
             al->cp->type = C_DOUBLE ;
             al->cp->dval = (double) al->ptr.ival[al->next] ;
-            break ;
-        case AY_STR:
+        }
+        else {
             al->cp->type = C_STRING ;
             al->cp->ptr = STRING_dup(al->ptr.sval[al->next]) ;
-            break ;
+        }
+        al->next++ ;
     }
-    al->next++ ;
     return 1 ;
 }
+int array_order(const char* name)
+{
+    static const struct {
+        const char* name ;
+        int order ;
+    } orders[] = {
+        { "@unsorted", AL_UNSORTED },
+        { "@ind_num_asc", AL_IND_NUM },
+        { "@ind_num_desc", AL_IND_NUM | AL_DESC },
+        { "@ind_str_asc", AL_IND_STR },
+        { "@ind_str_desc", AL_IND_STR | AL_DESC },
+        { "@val_num_asc", AL_VAL_NUM },
+        { "@val_num_desc", AL_VAL_NUM | AL_DESC },
+        { "@val_str_asc", AL_VAL_STR },
+        { "@val_str_desc", AL_VAL_STR | AL_DESC },
+        { "@val_type_asc", AL_VAL_TYPE },
+        { "@val_type_desc", AL_VAL_TYPE | AL_DESC },
+        { 0, 0 }
+    } ;
+    int i ;
+    for(i = 0; orders[i].name; i++) {
+        if (strcmp(name, orders[i].name) == 0) return orders[i].order ;
+    }
+    return -1 ;
+}
+size_t array_sort(ARRAY A, ARRAY D, int order, int indices)
+{
+    size_t n = A->size ;
+    SortItem* items ;
+    DVEC* dv ;
+    size_t i ;
+    if (n == 0) {
+        array_clear(D) ;
+        return 0 ;
+    }
+    if (A->type == AY_MAPPED) map_to_str(A) ;
+    items = (SortItem*)zmalloc(sizeof(SortItem) * n) ;
+    sort_items(items, A, order, !indices) ;
+    dv = new_dvec(n, 1) ;
+    for(i = 0; i < n; i++) {
+        CELL* cp = dvec_cell(dv, i) ;
+        if (!indices) {
+            CELL* vp = items[i].key.cp ;
+            if (D == A) {
+                *cp = *vp ;
+                vp->type = C_NOINIT ;
+            }
+            else cellcpy(cp, vp) ;
+        }
+        else if (A->type == AY_STR || A->type == AY_SPILL) {
+            cp->type = C_STRING ;
+            cp->ptr = (PTR) items[i].key.sval ;
+        }
+        else {
+            cp->type = C_DOUBLE ;
+            cp->dval = (double) items[i].key.ival ;
+        }
+    }
+    zfree(items, sizeof(SortItem) * n) ;
+    array_clear(D) ;
+    D->ptr = dv ;
+    D->type = AY_SPLIT ;
+    D->size = n ;
+    return n ;
+}
 CELL *array_cat(
    CELL *sp,
    int cnt)
@@ -265,7 +662,6 @@ CELL *array_cat(
 
    size_t total_len ;  /* length of cat'ed expression */
    CELL *top ;   /* value of sp at entry */
-   char *target ;  /* build cat'ed char* here */
    STRING *sval ;  /* build cat'ed STRING here */
    {
        cellcpy(&subsep, SUBSEP) ;
@@ -279,24 +675,26 @@ CELL *array_cat(
        sp -= (cnt-1) ;
    }
 
-   total_len = ((size_t) (cnt-1)) * subsep_len ;
+   total_len = 0 ;
    for(p = sp ; p <= top ; p++) {
-      if ( p->type < C_STRING ) cast1_to_s(p) ;
-      total_len += string(p)->len ;
+      if (p->type == C_DOUBLE && is_int_double(p->dval)) {
+         cat_reserve(total_len + 24 + subsep_len) ;
+         total_len += int_key(cat_buff + total_len, (int64_t) p->dval) ;
+      }
+      else {
+         if ( p->type < C_STRING ) cast1_to_s(p) ;
+         cat_reserve(total_len + string(p)->len + subsep_len) ;
+         memcpy(cat_buff + total_len, string(p)->str, string(p)->len) ;
+         total_len += string(p)->len ;
+      }
+      if (p < top) {
+         memcpy(cat_buff + total_len, subsep_str, subsep_len) ;
+         total_len += subsep_len ;
+      }
    }
 
-   sval = new_STRING0(total_len) ;
-   target = sval->str ;
-   for(p = sp ; p < top ; p++) {
-      memcpy(target, string(p)->str, string(p)->len) ;
-      target += string(p)->len ;
-      memcpy(target, subsep_str, subsep_len) ;
-      target += subsep_len ;
-   }
-   /* now p == top */
-   memcpy(target, string(p)->str, string(p)->len) ;
-
-   for(p = sp; p <= top ; p++) free_STRING(string(p)) ;
+   sval = new_STRING2(cat_buff, total_len) ;
+   for(p = sp; p <= top ; p++) cell_destroy(p) ;
    free_STRING(string(&subsep)) ;
    /* set contents of sp , sp->type > C_STRING is possible so reset */
    sp->type = C_STRING ;
@@ -304,250 +702,1317 @@ CELL *array_cat(
    return sp ;
 
 }
+void array_spill(CELL* base, CELL* sp)
+{
+    size_t low = mem_budget - mem_budget/8 ;
+    SpillPart* p ;
+    while(mem_used > low && big_cnt > 0) {
+        ARRAY A = 0 ;
+        unsigned i ;
+        for(i = 0; i < big_cnt; i++) {
+            ARRAY B = big_arrays[i] ;
+            if (!B->loops && (A == 0 || B->size > A->size) &&
+                !table_pinned((ITable*)B->ptr, base, sp)) A = B ;
+        }
+        if (A == 0 || !array_to_disk(A)) break ;
+    }
+    p = lru_last ;
+    while(mem_used > low && p) {
+        SpillPart* hold = p->prev ;
+        if (!table_pinned(p->ht, base, sp)) spill_store(p) ;
+        p = hold ;
+    }
+}
+int array_dump(ARRAY A, const char* name)
+{
+    DumpFile df ;
+    MapHead head ;
+    size_t i ;
+    int ok ;
+    size_t tmp_size = strlen(name) + 32 ;
+    char* tmp = (char*)zmalloc(tmp_size) ;
+    if (A->type == AY_MAPPED) map_to_str(A) ;
+    sprintf(tmp, "%s.%d.tmp", name, (int) getpid()) ;
+    if ((df.fp = fopen(tmp, "wb")) == 0) {
+        zfree(tmp, tmp_size) ;
+        return 0 ;
+    }
+    df.nslots = 16 ;
+    while(df.nslots < 2 * (uint64_t) A->size) df.nslots <<= 1 ;
+    df.slots = (MapSlot*)zmalloc(sizeof(MapSlot) * df.nslots) ;
+    memset(df.slots, 0, sizeof(MapSlot) * df.nslots) ;
+    df.offset = sizeof(MapHead) + sizeof(MapSlot) * df.nslots ;
+    ok = spill_seek(df.fp, df.offset) == 0 ;
+    if (ok && A->type == AY_SPLIT) {
+        DVEC* dv = (DVEC*)A->ptr ;
+        for(i = 0; i < A->size; i++) {
+            char buff[64] ;
+            int len = sprintf(buff, LDFMT, (int64_t) i + dv->origin) ;
+            dump_element(&df, buff, len, dvec_cell(dv, i)) ;
+        }
+    }
+    else if (ok && (A->type == AY_STR || A->type == AY_INT)) {
+        dump_table(&df, (ITable*)A->ptr) ;
+    }
+    else if (ok && A->type == AY_SPILL) {
+        Spill* S = (Spill*)A->ptr ;
+        unsigned k ;
+        for(k = 0; k < S->nparts; k++) {
+            int on_disk = S->parts[k].ht == 0 ;
+            dump_table(&df, spill_table(S, k)) ;
+            if (on_disk) spill_store(S->parts + k) ;
+        }
+    }
+    memset(&head, 0, sizeof(head)) ;
+    strcpy(head.magic, MAP_MAGIC) ;
+    head.order = MAP_ORDER ;
+    head.rec_size = sizeof(SpillRec) ;
+    head.size = A->size ;
+    head.nslots = df.nslots ;
+    head.end = df.offset ;
+    ok = ok && !ferror(df.fp) && spill_seek(df.fp, 0) == 0 &&
+         fwrite(&head, sizeof(head), 1, df.fp) == 1 &&
+         fwrite(df.slots, sizeof(MapSlot), df.nslots, df.fp) == df.nslots ;
+    if (fclose(df.fp) != 0) ok = 0 ;
+    zfree(df.slots, sizeof(MapSlot) * df.nslots) ;
+    if (!ok || !dump_rename(tmp, name)) {
+        remove(tmp) ;
+        ok = 0 ;
+    }
+    zfree(tmp, tmp_size) ;
+    return ok ;
+}
+int array_attach(ARRAY A, const char* name)
+{
+    size_t len ;
+    const char* base = map_file(name, &len) ;
+    const MapHead* head = (const MapHead*) base ;
+    AMap* M ;
+    if (base == 0) return 0 ;
+    if (len < sizeof(MapHead) ||
+        memcmp(head->magic, MAP_MAGIC, sizeof(MAP_MAGIC)) != 0 ||
+        head->order != MAP_ORDER || head->rec_size != sizeof(SpillRec) ||
+        head->end != len || head->nslots == 0 ||
+        (head->nslots & (head->nslots-1)) != 0 ||
+        head->size >= head->nslots ||
+        head->nslots > (len - sizeof(MapHead)) / sizeof(MapSlot)) {
+        unmap_file(base, len) ;
+        return 0 ;
+    }
+    array_clear(A) ;
+    if (head->size == 0) {
+        unmap_file(base, len) ;
+        return 1 ;
+    }
+    M = ZMALLOC(AMap) ;
+    M->base = base ;
+    M->len = len ;
+    M->ht = make_empty_itable() ;
+    A->ptr = M ;
+    A->size = (size_t) head->size ;
+    A->type = AY_MAPPED ;
+    return 1 ;
+}
+static DVEC* new_dvec(size_t base, int origin)
+{
+    DVEC* dv = ZMALLOC(DVEC) ;
+    size_t b ;
+    dv->origin = origin ;
+    dv->nseg = 1 ;
+    dv->base = base ;
+    dv->limit = base ;
+    dv->base_log = -1 ;
+    for(b = 1 ; b && b <= base ; b <<= 1) {
+        if (b == base) dv->base_log = floor_log2(b) ;
+    }
+    dv->seg[0] = hblock_nodes(new_hblock(base)) ;
+    return dv ;
+}
+static int floor_log2(size_t q)
+{
+#ifdef __GNUC__
+    return (int)(8*sizeof(unsigned long long) - 1)
+              - __builtin_clzll((unsigned long long) q) ;
+#else
+    int k = 0 ;
+    while(q >>= 1) k++ ;
+    return k ;
+#endif
+}
+
+static HNODE* dvec_node(DVEC* dv, size_t i)
+{
+    if (i < dv->base) {
+        return dv->seg[0] + i ;
+    }
+    else {
+        size_t q = dv->base_log >= 0 ? i >> dv->base_log : i / dv->base ;
+        int k = floor_log2(q) + 1 ;
+        return dv->seg[k] + (i - (dv->base << (k-1))) ;
+    }
+}
+static int dvec_grow(DVEC* dv)
+{
+    size_t cnt = dv->base << (dv->nseg-1) ;
+    if (dv->nseg == DVEC_SEGS) return 0 ;
+    dv->seg[dv->nseg++] = hblock_nodes(new_hblock(cnt)) ;
+    dv->limit += cnt ;
+    return 1 ;
+}
+
+static CELL* dvec_push(ARRAY A)
+{
+    DVEC* dv = (DVEC*)A->ptr ;
+    CELL* cp ;
+    if (A->size == dv->limit && !dvec_grow(dv)) return 0 ;
+    cp = dvec_cell(dv, A->size) ;
+    cp->type = C_NOINIT ;
+    A->size++ ;
+    return cp ;
+}
+static void dvec_free(DVEC* dv)
+{
+    int k ;
+    for(k = 0 ; k < dv->nseg ; k++) {
+        hblock_free(node_hblock(dv->seg[k])) ;
+    }
+    zfree(dv, sizeof(DVEC)) ;
+}
 static void array_int_to_str(ARRAY A)
 {
     ITable* ht = (ITable*)A->ptr ;
+    if (A->loops) aloop_snapshot(A) ;
     itable_convert_i_to_s(ht) ;
     A->type = AY_STR ;
 }
 static void array_split_to_int(ARRAY A)
 {
-    ITable* tb = make_empty_itable() ;
-    unsigned i ;
-    CELL* cells = (CELL*)A->ptr ;
-    for(i=1; i <= A->size; i++) {
-        size_t unused ;
-        CELL* cp = itable_find(tb,0, i, CREATE, &unused) ;
-        *cp = cells[i-1] ; /* no ref cnt adjustment needed */
-    }
-    zfree(cells, sizeof(CELL) * A->size) ;
+    if (A->loops) aloop_snapshot(A) ;
+    A->ptr = itable_from_dvec((DVEC*)A->ptr, A->size, 0) ;
     A->type = AY_INT ;
-    A->ptr = tb ;
     /* A->size stayed the same */
 }
+
 static void array_split_to_str(ARRAY A)
 {
-    ITable* tb = make_empty_itable() ;
-    unsigned i ;
-    CELL* cells = (CELL*)A->ptr ;
-    for(i=1; i <= A->size; i++) {
-        size_t unused ;
-        char buffer[128] ;
-        STRING* sval ;
-        CELL* cp ; 
-        sprintf(buffer, "%u" , i) ;
-        sval = new_STRING(buffer) ;
-        cp = itable_find(tb, sval, 0, CREATE, &unused) ;
-        *cp = cells[i-1] ; /* no ref cnt adjustment needed */
-        free_STRING(sval) ;
-    }
-    zfree(cells, sizeof(CELL) * A->size) ;
+    if (A->loops) aloop_snapshot(A) ;
+    A->ptr = itable_from_dvec((DVEC*)A->ptr, A->size, 1) ;
     A->type = AY_STR ;
-    A->ptr = tb ;
     /* A->size stayed the same */
 }
-#ifdef QSORT
-static int i_compare(const void* l, const void* r)
+static void aloop_free_keys(ALoop* al)
+{
+    if (al->size == 0) return ;
+    if (al->type == AY_INT) {
+        zfree(al->ptr.ival, sizeof(int64_t) * al->size) ;
+    }
+    else if (al->type == AY_STR || al->type == AY_SPILL) {
+        unsigned i ;
+        for(i=0; i < al->size; i++) {
+            free_STRING(al->ptr.sval[i]) ;
+        }
+        zfree(al->ptr.sval, sizeof(STRING*) * al->size) ;
+    }
+    al->size = 0 ;
+}
+static void aloop_snapshot(ARRAY A)
+{
+    ALoop* al = A->loops ;
+    while(al) {
+        ALoop* hold = al->alink ;
+        unsigned cnt = 0 ;
+        unsigned i ;
+        if (al->type == AY_SPLIT) {
+            if (al->next < A->size) cnt = A->size - al->next ;
+            if (cnt > 0) {
+                al->ptr.ival = (int64_t*)zmalloc(sizeof(int64_t) * cnt) ;
+                for(i = 0; i < cnt; i++) {
+                    al->ptr.ival[i] = (int64_t) (al->next + i) + al->origin ;
+                }
+            }
+            al->type = AY_INT ;
+        }
+        else if (al->type == AY_SPILL) {
+            {
+                Spill* S = (Spill*)A->ptr ;
+                STRING** keys ;
+                unsigned k ;
+                size_t j ;
+                for(j = al->next; j < al->size; j++) {
+                    if (spill_find(S, al->ptr.sval[j], NO_CREATE, &A->size)) cnt++ ;
+                }
+                for(k = al->part; k < S->nparts; k++) {
+                    SpillPart* p = S->parts + k ;
+                    cnt += p->ht ? p->ht->size : p->cnt ;
+                }
+                keys = cnt > 0 ? (STRING**)zmalloc(sizeof(STRING*) * cnt) : 0 ;
+                i = 0 ;
+                for(j = al->next; j < al->size; j++) {
+                    STRING* sval = al->ptr.sval[j] ;
+                    if (spill_find(S, sval, NO_CREATE, &A->size)) {
+                        keys[i++] = sval ;
+                        al->ptr.sval[j] = 0 ;
+                    }
+                }
+                for(k = al->part; k < S->nparts; k++) {
+                    ITable* ht = spill_table(S, k) ;
+                    for(j = 0; j < ht->used; j++) {
+                        HNODE* p = dvec_node(ht->nodes, j) ;
+                        if (p->cell.type != NODE_FREE) keys[i++] = node_key(p) ;
+                    }
+                }
+                for(j = 0; j < al->size; j++) {
+                    if (al->ptr.sval[j]) free_STRING(al->ptr.sval[j]) ;
+                }
+                if (al->size > 0) zfree(al->ptr.sval, sizeof(STRING*) * al->size) ;
+                al->ptr.sval = keys ;
+                al->type = AY_STR ;
+            }
+
+        }
+        else {
+            {
+                ITable* ht = (ITable*)A->ptr ;
+                size_t j ;
+                for(j = al->next; j < ht->used; j++) {
+                    if (dvec_node(ht->nodes, j)->cell.type != NODE_FREE) cnt++ ;
+                }
+                if (cnt > 0) {
+                    if (al->type == AY_INT) {
+                        al->ptr.ival = (int64_t*)zmalloc(sizeof(int64_t) * cnt) ;
+                    }
+                    else {
+                        al->ptr.sval = (STRING**)zmalloc(sizeof(STRING*) * cnt) ;
+                    }
+                }
+                i = 0 ;
+                for(j = al->next; j < ht->used; j++) {
+                    HNODE* p = dvec_node(ht->nodes, j) ;
+                    if (p->cell.type == NODE_FREE) continue ;
+                    if (al->type == AY_INT) al->ptr.ival[i++] = p->key.ival ;
+                    else al->ptr.sval[i++] = node_key(p) ;
+                }
+            }
+
+        }
+        if (cnt == 0) al->type = AY_NULL ;
+        al->size = cnt ;
+        al->next = 0 ;
+        al->A = 0 ;
+        al->alink = 0 ;
+        al = hold ;
+    }
+    A->loops = 0 ;
+}
+static int aloop_order(void)
+{
+    static STRING* sorted_in ;
+    CELL key ;
+    CELL* cp ;
+    int order ;
+    if (procinfo == 0) return AL_UNSORTED ;
+    if (sorted_in == 0) sorted_in = new_STRING("sorted_in") ;
+    key.type = C_STRING ;
+    key.ptr = (PTR) sorted_in ;
+    cp = array_find(procinfo, &key, NO_CREATE) ;
+    if (cp == 0 || cp->type == C_NOINIT) return AL_UNSORTED ;
+    cellcpy(&key, cp) ;
+    cast1_to_s(&key) ;
+    if ((order = array_order(string(&key)->str)) < 0) {
+        rt_error("unknown order PROCINFO[\"sorted_in\"] = \"%s\"",
+                 string(&key)->str) ;
+    }
+    free_STRING(string(&key)) ;
+    return order ;
+}
+static void aloop_sort(ALoop* al, ARRAY A, int order)
+{
+    SortItem* items = (SortItem*)zmalloc(sizeof(SortItem) * A->size) ;
+    size_t n = A->size ;
+    size_t i ;
+    sort_items(items, A, order, 0) ;
+    al->size = n ;
+    if (A->type == AY_STR || A->type == AY_SPILL) {
+        al->type = AY_STR ;
+        al->ptr.sval = (STRING**)zmalloc(sizeof(STRING*) * n) ;
+        for(i = 0; i < n; i++) al->ptr.sval[i] = items[i].key.sval ;
+    }
+    else {
+        al->type = AY_INT ;
+        al->ptr.ival = (int64_t*)zmalloc(sizeof(int64_t) * n) ;
+        for(i = 0; i < n; i++) al->ptr.ival[i] = items[i].key.ival ;
+    }
+
+    zfree(items, sizeof(SortItem) * n) ;
+}
+static void sort_items(SortItem* items, ARRAY A, int order, int values)
+{
+    int how = order & ~AL_DESC ;
+    int desc = (order & AL_DESC) != 0 ;
+    int str_keys = A->type == AY_STR || A->type == AY_SPILL ;
+    size_t n = A->size ;
+    size_t front = 0 ;
+    size_t back = n ;
+    size_t i ;
+    SortItem t ;
+
+    if (A->type == AY_SPLIT) {
+        DVEC* dv = (DVEC*)A->ptr ;
+        for(i = 0; i < n; i++) {
+            CELL* cp = dvec_cell(dv, i) ;
+            int64_t ival = (int64_t) i + dv->origin ;
+            if (values) t.key.cp = cp ;
+            else t.key.ival = ival ;
+            if (sort_item_key(&t, how, 0, ival, cp)) items[front++] = t ;
+            else items[--back] = t ;
+        }
+    }
+    else {
+        Spill* S = A->type == AY_SPILL ? (Spill*)A->ptr : 0 ;
+        unsigned k ;
+        for(k = 0; k < (S ? S->nparts : 1); k++) {
+            ITable* ht = S ? spill_table(S, k) : (ITable*)A->ptr ;
+            for(i = 0; i < ht->used; i++) {
+                HNODE* p = dvec_node(ht->nodes, i) ;
+                STRING* sval = 0 ;
+                int64_t ival = 0 ;
+                if (p->cell.type == NODE_FREE) continue ;
+                if (str_keys) sval = node_key(p) ;
+                else ival = p->key.ival ;
+                if (values) t.key.cp = &p->cell ;
+                else if (str_keys) t.key.sval = sval ;
+                else t.key.ival = ival ;
+                if (sort_item_key(&t, how, sval, ival, &p->cell)) {
+                    items[front++] = t ;
+                }
+                else items[--back] = t ;
+                if (values && sval) free_STRING(sval) ;
+            }
+        }
+    }
+    /* the back was filled from the end */
+    for(i = 0; i < (n - back)/2; i++) {
+        t = items[back+i] ;
+        items[back+i] = items[n-1-i] ;
+        items[n-1-i] = t ;
+    }
+
+    if (desc && (how == AL_IND_NUM || how == AL_VAL_NUM)) {
+        for(i = 0; i < front; i++) items[i].sk.u = ~items[i].sk.u ;
+        desc = 0 ;
+    }
+    radix_sort(items, front) ;
+    sort_by_string(items + front, n - front, 0) ;
+    for(i = front; i < n; i++) free_STRING(items[i].sk.s) ;
+    if (desc) {
+        for(i = 0; i < n/2; i++) {
+            t = items[i] ;
+            items[i] = items[n-1-i] ;
+            items[n-1-i] = t ;
+        }
+    }
+}
+static uint64_t double_sort_key(double d)
 {
-    const int64_t* il = l ;
-    const int64_t* ir = r ;
-    return *il - *ir ;
+    uint64_t u ;
+    memcpy(&u, &d, sizeof(u)) ;
+    return (u >> 63) ? ~u : u | ((uint64_t)1 << 63) ;
 }
 
-static int s_compare(const void* l, const void* r)
+static int sort_item_key(SortItem* p, int how, STRING* sval,
+                         int64_t ival, CELL* cp)
 {
-    STRING* const* sl = l ;
-    STRING* const* sr = r ;
-    return STRING_cmp(*sl,*sr) ;
+    CELL c ;
+    switch(how) {
+        case AL_IND_NUM:
+            if (sval) {
+                c.type = C_STRING ;
+                c.ptr = (PTR) STRING_dup(sval) ;
+                cast1_to_d(&c) ;
+                p->sk.u = double_sort_key(c.dval) ;
+            }
+            else {
+                p->sk.u = double_sort_key((double) ival) ;
+            }
+            return 1 ;
+        case AL_IND_STR:
+            if (sval) {
+                p->sk.s = STRING_dup(sval) ;
+            }
+            else {
+                char buffer[64] ;
+                sprintf(buffer, LDFMT, ival) ;
+                p->sk.s = new_STRING(buffer) ;
+            }
+            return 0 ;
+        case AL_VAL_NUM:
+            cellcpy(&c, cp) ;
+            cast1_to_d(&c) ;
+            p->sk.u = double_sort_key(c.dval) ;
+            return 1 ;
+        case AL_VAL_TYPE:
+            cellcpy(&c, cp) ;
+            if (c.type == C_MBSTRN) check_strnum(&c) ;
+            if (c.type < C_STRING || c.type == C_STRNUM) {
+                cast1_to_d(&c) ;
+                p->sk.u = double_sort_key(c.dval) ;
+                return 1 ;
+            }
+            p->sk.s = string(&c) ;
+            return 0 ;
+        default: /* AL_VAL_STR */
+            cellcpy(&c, cp) ;
+            cast1_to_s(&c) ;
+            p->sk.s = string(&c) ;
+            return 0 ;
+    }
+}
+static void radix_sort(SortItem* a, size_t n)
+{
+    SortItem* tmp ;
+    SortItem* from = a ;
+    SortItem* to ;
+    size_t count[8][256] ;
+    size_t i ;
+    int k ;
+    if (n < 2) return ;
+    memset(count, 0, sizeof(count)) ;
+    for(i = 0; i < n; i++) {
+        uint64_t u = a[i].sk.u ;
+        for(k = 0; k < 8; k++) count[k][(u >> 8*k) & 0xff]++ ;
+    }
+    tmp = (SortItem*)zmalloc(sizeof(SortItem) * n) ;
+    to = tmp ;
+    for(k = 0; k < 8; k++) {
+        size_t* c = count[k] ;
+        size_t sum = 0 ;
+        int j ;
+        if (c[(from[0].sk.u >> 8*k) & 0xff] == n) continue ;
+        for(j = 0; j < 256; j++) {
+            size_t t = c[j] ;
+            c[j] = sum ;
+            sum += t ;
+        }
+        for(i = 0; i < n; i++) {
+            to[c[(from[i].sk.u >> 8*k) & 0xff]++] = from[i] ;
+        }
+        to = from ;
+        from = from == a ? tmp : a ;
+    }
+    if (from != a) memcpy(a, from, sizeof(SortItem) * n) ;
+    zfree(tmp, sizeof(SortItem) * n) ;
+}
+static int sk_byte(const SortItem* p, size_t depth)
+{
+    const STRING* s = p->sk.s ;
+    return depth < s->len ? (unsigned char) s->str[depth] : -1 ;
+}
+
+static int sk_compare(const SortItem* p, const SortItem* q, size_t depth)
+{
+    const STRING* s = p->sk.s ;
+    const STRING* t = q->sk.s ;
+    size_t len = s->len < t->len ? s->len : t->len ;
+    int ret = memcmp(s->str + depth, t->str + depth, len - depth) ;
+    if (ret == 0) ret = s->len < t->len ? -1 : s->len > t->len ;
+    return ret ;
+}
+
+static void sort_by_string(SortItem* a, size_t n, size_t depth)
+{
+    while(n > 1) {
+        size_t lt, gt, i ;
+        int v ;
+        SortItem t ;
+        if (n < 16) {
+            for(i = 1; i < n; i++) {
+                size_t j = i ;
+                t = a[i] ;
+                while(j > 0 && sk_compare(&t, a+j-1, depth) < 0) {
+                    a[j] = a[j-1] ;
+                    j-- ;
+                }
+                a[j] = t ;
+            }
+            return ;
+        }
+        /* pivot is the median of three */
+        {
+            int x = sk_byte(a, depth) ;
+            int y = sk_byte(a + n/2, depth) ;
+            int z = sk_byte(a + n-1, depth) ;
+            size_t m = (x < y) ? (y < z ? n/2 : x < z ? n-1 : 0)
+                               : (x < z ? 0 : y < z ? n-1 : n/2) ;
+            t = a[0] ; a[0] = a[m] ; a[m] = t ;
+        }
+        v = sk_byte(a, depth) ;
+        lt = 0 ;
+        gt = n ;
+        i = 1 ;
+        while(i < gt) {
+            int c = sk_byte(a+i, depth) ;
+            if (c < v) {
+                t = a[lt] ; a[lt++] = a[i] ; a[i++] = t ;
+            }
+            else if (c > v) {
+                t = a[--gt] ; a[gt] = a[i] ; a[i] = t ;
+            }
+            else i++ ;
+        }
+        sort_by_string(a, lt, depth) ;
+        sort_by_string(a+gt, n-gt, depth) ;
+        if (v < 0) return ;
+        a += lt ;
+        n = gt - lt ;
+        depth++ ;
+    }
+}
+static void cat_reserve(size_t len)
+{
+    if (len > cat_size) {
+        size_t new_size = 2 * len ;
+        if (cat_buff) {
+            cat_buff = (char*)zrealloc(cat_buff, cat_size, new_size) ;
+        }
+        else {
+            cat_buff = (char*)zmalloc(new_size) ;
+        }
+        cat_size = new_size ;
+    }
+}
+
+static size_t int_key(char* target, int64_t ival)
+{
+    char digits[24] ;
+    char* q = digits + sizeof(digits) ;
+    uint64_t u = ival < 0 ? -(uint64_t)ival : (uint64_t)ival ;
+    size_t len ;
+    do {
+        *--q = (char)('0' + u % 10) ;
+        u /= 10 ;
+    } while(u) ;
+    if (ival < 0) *--q = '-' ;
+    len = (size_t)(digits + sizeof(digits) - q) ;
+    memcpy(target, q, len) ;
+    return len ;
+}
+static void big_add(ARRAY A)
+{
+    if (big_cnt == big_max) {
+        unsigned new_max = big_max ? 2*big_max : 8 ;
+        if (big_arrays) {
+            big_arrays = (ARRAY*)zrealloc(big_arrays,
+                      sizeof(ARRAY) * big_max, sizeof(ARRAY) * new_max) ;
+        }
+        else {
+            big_arrays = (ARRAY*)zmalloc(sizeof(ARRAY) * new_max) ;
+        }
+        big_max = new_max ;
+    }
+    big_arrays[big_cnt++] = A ;
+    A->big = 1 ;
+}
+
+static void big_remove(ARRAY A)
+{
+    unsigned i = 0 ;
+    while(big_arrays[i] != A) i++ ;
+    big_arrays[i] = big_arrays[--big_cnt] ;
+    A->big = 0 ;
+}
+static int table_pinned(ITable* ht, CELL* base, CELL* sp)
+{
+    DVEC* dv = ht->nodes ;
+    CELL* cp ;
+    for(cp = base; cp <= sp; cp++) {
+        uintptr_t a = (uintptr_t) cp->ptr ;
+        int k ;
+        for(k = 0; k < dv->nseg; k++) {
+            uintptr_t lo = (uintptr_t) dv->seg[k] ;
+            uintptr_t hi = (uintptr_t) (dv->seg[k] + node_hblock(dv->seg[k])->cnt) ;
+            if (a >= lo && a < hi) return 1 ;
+        }
+    }
+    return 0 ;
+}
+static CELL* spill_find(Spill* S, STRING* sval, int flag, size_t* sizep)
+{
+    unsigned k = spill_part(S, sval->str, sval->len) ;
+    ITable* ht = spill_table(S, k) ;
+    unsigned old_size = ht->size ;
+    size_t dummy ;
+    CELL* ret = itable_find(ht, sval, 0, flag, &dummy) ;
+    *sizep = *sizep + ht->size - old_size ;
+    if (flag != NO_CREATE) S->parts[k].dirty = 1 ;
+    return ret ;
+}
+
+static ITable* spill_table(Spill* S, unsigned k)
+{
+    SpillPart* p = S->parts + k ;
+    if (p->ht == 0) {
+        spill_load(p) ;
+    }
+    else if (p != lru_first) {
+        lru_unlink(p) ;
+        lru_push(p) ;
+    }
+    return p->ht ;
+}
+
+static void lru_push(SpillPart* p)
+{
+    p->prev = 0 ;
+    p->next = lru_first ;
+    if (lru_first) lru_first->prev = p ;
+    else lru_last = p ;
+    lru_first = p ;
+}
+
+static void lru_unlink(SpillPart* p)
+{
+    if (p->prev) p->prev->next = p->next ;
+    else lru_first = p->next ;
+    if (p->next) p->next->prev = p->prev ;
+    else lru_last = p->prev ;
+}
+static int array_to_disk(ARRAY A)
+{
+    ITable* ht = (ITable*)A->ptr ;
+    FILE* fp = spill_tmpfile() ;
+    Spill* S ;
+    uint32_t* order ;
+    size_t* pos ;
+    size_t i, n ;
+    unsigned k ;
+    if (fp == 0) {
+        errmsg(errno, "cannot open a temporary file, -W memory is ignored") ;
+        mem_budget = (size_t) -1 ;
+        return 0 ;
+    }
+    S = ZMALLOC(Spill) ;
+    S->fp = fp ;
+    S->end = 0 ;
+    S->nparts = 16 ;
+    while(S->nparts < A->size / SPILL_PART && S->nparts < SPILL_MAXPARTS) {
+        S->nparts <<= 1 ;
+    }
+    S->parts = (SpillPart*)zmalloc(sizeof(SpillPart) * S->nparts) ;
+    memset(S->parts, 0, sizeof(SpillPart) * S->nparts) ;
+    for(k = 0; k < S->nparts; k++) S->parts[k].spill = S ;
+    order = (uint32_t*)zmalloc(sizeof(uint32_t) * A->size) ;
+    pos = (size_t*)zmalloc(sizeof(size_t) * S->nparts) ;
+    for(i = 0; i < ht->used; i++) {
+        HNODE* p = dvec_node(ht->nodes, i) ;
+        if (p->cell.type != NODE_FREE) S->parts[node_part(S, p)].cnt++ ;
+    }
+    for(n = 0, k = 0; k < S->nparts; k++) {
+        pos[k] = n ;
+        n += S->parts[k].cnt ;
+    }
+    for(i = 0; i < ht->used; i++) {
+        HNODE* p = dvec_node(ht->nodes, i) ;
+        if (p->cell.type != NODE_FREE) order[pos[node_part(S, p)]++] = (uint32_t) i ;
+    }
+
+    for(i = 0, k = 0; k < S->nparts; k++) {
+        SpillPart* p = S->parts + k ;
+        size_t j ;
+        char* q ;
+        for(j = 0; j < p->cnt; j++) {
+            p->bytes += spill_size(dvec_node(ht->nodes, order[i+j])) ;
+        }
+        q = spill_buffer(p->bytes) ;
+        for(j = 0; j < p->cnt; j++) {
+            q += spill_put(q, dvec_node(ht->nodes, order[i++])) ;
+        }
+        p->offset = S->end ;
+        p->room = p->bytes ;
+        S->end += p->room ;
+        if (fwrite(spill_buff, 1, p->bytes, fp) != p->bytes) spill_error() ;
+    }
+    zfree(order, sizeof(uint32_t) * A->size) ;
+    zfree(pos, sizeof(size_t) * S->nparts) ;
+    big_remove(A) ;
+    itable_free(ht) ;
+    A->ptr = S ;
+    A->type = AY_SPILL ;
+    return 1 ;
+}
+static const char* key_chars(uint64_t w, char* buff, size_t* lenp)
+{
+    if (key_is_inline(w)) {
+        size_t len = (w >> 1) & 0x7f ;
+        size_t i ;
+        for(i = 0; i < len; i++) buff[i] = (char)(w >> 8*(i+1)) ;
+        *lenp = len ;
+        return buff ;
+    }
+    *lenp = key_sval(w)->len ;
+    return key_sval(w)->str ;
+}
+
+static unsigned node_part(Spill* S, const HNODE* p)
+{
+    char buff[KEY_INLINE] ;
+    size_t len ;
+    const char* s = key_chars(p->key.word, buff, &len) ;
+    return spill_part(S, s, len) ;
+}
+static size_t rec_put(char* buff, const char* key, size_t klen,
+                      const CELL* cp)
+{
+    SpillRec r ;
+    memset(&r, 0, sizeof(r)) ;
+    r.klen = klen ;
+    r.type = cp->type ;
+    if (r.type == C_DOUBLE || r.type == C_STRNUM) r.dval = cp->dval ;
+    if (value_is_string(r.type)) r.slen = string(cp)->len ;
+    memcpy(buff, &r, sizeof(r)) ;
+    memcpy(buff + sizeof(r), key, r.klen) ;
+    if (r.slen > 0) {
+        memcpy(buff + sizeof(r) + r.klen, string(cp)->str, r.slen) ;
+    }
+    return sizeof(r) + r.klen + r.slen ;
+}
+
+static size_t spill_put(char* buff, HNODE* p)
+{
+    char kbuff[KEY_INLINE] ;
+    size_t klen ;
+    const char* key = key_chars(p->key.word, kbuff, &klen) ;
+    return rec_put(buff, key, klen, &p->cell) ;
+}
+
+static size_t spill_get(const char* buff, ITable* ht)
+{
+    SpillRec r ;
+    STRING* key ;
+    CELL* cp ;
+    unsigned old_size = ht->size ;
+    size_t dummy ;
+    memcpy(&r, buff, sizeof(r)) ;
+    key = new_STRING2(buff + sizeof(r), r.klen) ;
+    cp = itable_find(ht, key, 0, CREATE, &dummy) ;
+    free_STRING(key) ;
+    if (ht->size != old_size) {
+        cp->type = r.type ;
+        cp->dval = r.dval ;
+        if (value_is_string(r.type)) {
+            cp->ptr = (PTR) new_STRING2(buff + sizeof(r) + r.klen, r.slen) ;
+        }
+    }
+    return sizeof(r) + r.klen + r.slen ;
+}
+
+static char* spill_buffer(size_t bytes)
+{
+    if (bytes > spill_buff_size) {
+        size_t size = spill_buff_size ? spill_buff_size : 4096 ;
+        while(size < bytes) size <<= 1 ;
+        if (spill_buff) zfree(spill_buff, spill_buff_size) ;
+        spill_buff = (char*)zmalloc(size) ;
+        spill_buff_size = size ;
+    }
+    return spill_buff ;
+}
+
+static void spill_error(void)
+{
+    rt_error("read or write failed on the temporary file of an array") ;
+}
+static void spill_load(SpillPart* p)
+{
+    FILE* fp = p->spill->fp ;
+    ITable* ht = make_empty_itable() ;
+    size_t i ;
+    if (p->cnt > ht->limit) {
+        unsigned hmask = ht->hmask ;
+        while(hmask - (hmask>>2) < p->cnt) hmask = (hmask<<1)+1 ;
+        zfree(ht->slots, (ht->hmask+1) * sizeof(HSLOT)) ;
+        make_slots(ht, hmask) ;
+    }
+    if (p->bytes > 0) {
+        char* q = spill_buffer(p->bytes) ;
+        if (spill_seek(fp, p->offset) != 0 ||
+            fread(q, 1, p->bytes, fp) != p->bytes) spill_error() ;
+        for(i = 0; i < p->cnt; i++) q += spill_get(q, ht) ;
+    }
+    p->ht = ht ;
+    p->dirty = 0 ;
+    lru_push(p) ;
+}
+
+static void spill_store(SpillPart* p)
+{
+    Spill* S = p->spill ;
+    ITable* ht = p->ht ;
+    if (p->dirty) {
+        size_t bytes = 0 ;
+        size_t i ;
+        char* q ;
+        for(i = 0; i < ht->used; i++) {
+            HNODE* r = dvec_node(ht->nodes, i) ;
+            if (r->cell.type != NODE_FREE) bytes += spill_size(r) ;
+        }
+        if (bytes > p->room) {
+            p->offset = S->end ;
+            p->room = bytes + bytes/2 ;
+            S->end += p->room ;
+        }
+        q = spill_buffer(bytes) ;
+        for(i = 0; i < ht->used; i++) {
+            HNODE* r = dvec_node(ht->nodes, i) ;
+            if (r->cell.type != NODE_FREE) q += spill_put(q, r) ;
+        }
+        if (bytes > 0 && (spill_seek(S->fp, p->offset) != 0 ||
+            fwrite(spill_buff, 1, bytes, S->fp) != bytes)) spill_error() ;
+        p->bytes = bytes ;
+        p->cnt = ht->size ;
+    }
+    lru_unlink(p) ;
+    itable_free(ht) ;
+    p->ht = 0 ;
+}
+
+static size_t spill_size(const HNODE* p)
+{
+    uint64_t w = p->key.word ;
+    size_t size = sizeof(SpillRec) ;
+    size += key_is_inline(w) ? (w >> 1) & 0x7f : key_sval(w)->len ;
+    if (value_is_string(p->cell.type)) size += ((STRING*)p->cell.ptr)->len ;
+    return size ;
+}
+static void spill_free(Spill* S)
+{
+    unsigned k ;
+    for(k = 0; k < S->nparts; k++) {
+        SpillPart* p = S->parts + k ;
+        if (p->ht) {
+            lru_unlink(p) ;
+            itable_free(p->ht) ;
+        }
+    }
+    fclose(S->fp) ;
+    zfree(S->parts, sizeof(SpillPart) * S->nparts) ;
+    ZFREE(S) ;
+}
+static FILE* spill_tmpfile(void)
+{
+    FILE* fp ;
+#if defined(_WIN32) || defined(_WIN64)
+    char* name = _tempnam(0, "wmawk") ;
+    fp = name ? fopen(name, "w+bTD") : 0 ;
+    free(name) ;
+#else
+    fp = tmpfile() ;
+#endif
+    if (fp) setvbuf(fp, 0, _IONBF, 0) ;
+    return fp ;
+}
+static void spill_keys(ALoop* al, ITable* ht)
+{
+    size_t i ;
+    unsigned j = 0 ;
+    al->next = 0 ;
+    al->size = ht->size ;
+    if (al->size == 0) return ;
+    al->ptr.sval = (STRING**)zmalloc(sizeof(STRING*) * al->size) ;
+    for(i = 0; i < ht->used; i++) {
+        HNODE* p = dvec_node(ht->nodes, i) ;
+        if (p->cell.type != NODE_FREE) al->ptr.sval[j++] = node_key(p) ;
+    }
+}
+static void dump_table(DumpFile* df, ITable* ht)
+{
+    size_t i ;
+    for(i = 0; i < ht->used; i++) {
+        HNODE* p = dvec_node(ht->nodes, i) ;
+        char buff[64] ;
+        const char* key ;
+        size_t len ;
+        if (p->cell.type == NODE_FREE) continue ;
+        if (ht->str_keys) key = key_chars(p->key.word, buff, &len) ;
+        else {
+            len = sprintf(buff, LDFMT, p->key.ival) ;
+            key = buff ;
+        }
+        dump_element(df, key, len, &p->cell) ;
+    }
+}
+
+static void dump_element(DumpFile* df, const char* key, size_t len,
+                         const CELL* cp)
+{
+    size_t bytes = sizeof(SpillRec) + len ;
+    uint64_t hval = hash64(key, len) ;
+    uint64_t i = hval & (df->nslots-1) ;
+    if (value_is_string(cp->type)) bytes += string(cp)->len ;
+    rec_put(spill_buffer(bytes), key, len, cp) ;
+    fwrite(spill_buff, 1, bytes, df->fp) ;
+    while(df->slots[i].offset) i = (i+1) & (df->nslots-1) ;
+    df->slots[i].hval = hval ;
+    df->slots[i].offset = df->offset ;
+    df->offset += bytes ;
+}
+static CELL* map_find(AMap* M, STRING* sval)
+{
+    size_t dummy ;
+    CELL* cp = itable_find(M->ht, sval, 0, NO_CREATE, &dummy) ;
+    const char* rec ;
+    if (cp == 0 && (rec = map_record(M, sval->str, sval->len)) != 0) {
+        spill_get(rec, M->ht) ;
+        cp = itable_find(M->ht, sval, 0, NO_CREATE, &dummy) ;
+    }
+    return cp ;
+}
+
+static const char* map_record(AMap* M, const char* s, size_t len)
+{
+    const MapHead* head = (const MapHead*) M->base ;
+    const MapSlot* slots = (const MapSlot*) (head + 1) ;
+    uint64_t hval = hash64(s, len) ;
+    uint64_t i = hval & (head->nslots-1) ;
+    uint64_t n ;
+    for(n = 0; n < head->nslots && slots[i].offset; n++) {
+        if (slots[i].hval == hval) {
+            const char* rec = map_check(M, slots[i].offset) ;
+            SpillRec r ;
+            memcpy(&r, rec, sizeof(r)) ;
+            if (r.klen == len && memcmp(rec + sizeof(r), s, len) == 0) {
+                return rec ;
+            }
+        }
+        i = (i+1) & (head->nslots-1) ;
+    }
+    return 0 ;
+}
+
+static void map_to_str(ARRAY A)
+{
+    AMap* M = (AMap*)A->ptr ;
+    const MapHead* head = (const MapHead*) M->base ;
+    const MapSlot* slots = (const MapSlot*) (head + 1) ;
+    uint64_t i ;
+    for(i = 0; i < head->nslots; i++) {
+        if (slots[i].offset) spill_get(map_check(M, slots[i].offset), M->ht) ;
+    }
+    A->ptr = M->ht ;
+    A->type = AY_STR ;
+    M->ht = 0 ;
+    map_free(M) ;
+}
+
+static void map_free(AMap* M)
+{
+    if (M->ht) itable_free(M->ht) ;
+    unmap_file(M->base, M->len) ;
+    ZFREE(M) ;
+}
+static const char* map_check(AMap* M, uint64_t offset)
+{
+    SpillRec r ;
+    if (offset > M->len - sizeof(r)) map_error() ;
+    memcpy(&r, M->base + offset, sizeof(r)) ;
+    if (r.klen > M->len || r.slen > M->len ||
+        r.klen + r.slen > M->len - sizeof(r) - offset) map_error() ;
+    if (r.type < C_NOINIT || r.type > C_MBSTRN ||
+        (r.slen != 0 && !value_is_string(r.type))) map_error() ;
+    return M->base + offset ;
+}
+
+static void map_error(void)
+{
+    rt_error("an array file read with reada() is corrupt") ;
 }
+static const char* map_file(const char* name, size_t* lenp)
+{
+    struct stat st ;
+    const char* base = 0 ;
+    int fd = open(name, O_RDONLY) ;
+    if (fd == -1) return 0 ;
+    if (fstat(fd, &st) == 0 && st.st_size > 0 &&
+        (uint64_t) st.st_size <= (size_t) -1) {
+#if defined(_WIN32) || defined(_WIN64)
+        HANDLE h = CreateFileMapping((HANDLE) _get_osfhandle(fd), 0,
+                                     PAGE_READONLY, 0, 0, 0) ;
+        if (h) {
+            base = (const char*) MapViewOfFile(h, FILE_MAP_READ, 0, 0, 0) ;
+            CloseHandle(h) ;
+        }
+#else
+        void* p = mmap(0, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0) ;
+        if (p != MAP_FAILED) {
+            posix_madvise(p, (size_t) st.st_size, POSIX_MADV_RANDOM) ;
+            base = (const char*) p ;
+        }
+#endif
+        *lenp = (size_t) st.st_size ;
+    }
+    close(fd) ;
+    return base ;
+}
+
+static void unmap_file(const char* base, size_t len)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    UnmapViewOfFile(base) ;
+#else
+    munmap((void*) base, len) ;
 #endif
+}
+static uint64_t inline_key(const char* s, size_t len)
+{
+    uint64_t w = (len << 1) | 1 ;
+    size_t i ;
+    for(i = 0; i < len; i++) {
+        w |= (uint64_t)(unsigned char) s[i] << 8*(i+1) ;
+    }
+    return w ;
+}
+
+static uint64_t make_key(STRING* sval)
+{
+    if (sval->len <= KEY_INLINE) return inline_key(sval->str, sval->len) ;
+    return (uint64_t)(uintptr_t) STRING_dup(sval) ;
+}
+
+static STRING* node_key(const HNODE* p)
+{
+    uint64_t w = p->key.word ;
+    if (key_is_inline(w)) {
+        size_t len = (w >> 1) & 0x7f ;
+        STRING* ret = new_STRING0(len) ;
+        size_t i ;
+        for(i = 0; i < len; i++) ret->str[i] = (char)(w >> 8*(i+1)) ;
+        return ret ;
+    }
+    return STRING_dup(key_sval(w)) ;
+}
+
+static void free_key(uint64_t w)
+{
+    if (!key_is_inline(w)) free_STRING(key_sval(w)) ;
+}
 static ITable* make_empty_itable()
 {
     ITable* ret = ZMALLOC(ITable) ;
-    ret->hmask = INIT_HMASK ;
     ret->size = 0 ;
-    ret->limit = MAX_AVE_BUCKET_SIZE * (INIT_HMASK+1) ;
-    ret->buckets = make_buckets(INIT_HMASK+1) ;
+    ret->str_keys = 0 ;
+    ret->used = 0 ;
+    ret->free_nodes = 0 ;
+    ret->nodes = new_dvec(DVEC_INIT, 0) ;
+    make_slots(ret, INIT_HMASK) ;
     return ret ;
 }
-static HNODE** make_buckets(unsigned cnt)
-{
-    HNODE** bks = (HNODE**)emalloc(cnt * sizeof(HNODE*)) ;
-    memset(bks, 0, cnt * sizeof(HNODE*)) ;
-    return bks ;
-}
-CELL* itable_find(ITable* htable, STRING* sval, int64_t ival, 
-                  int flag, size_t* szp) 
-{
-    int64_t hash = sval ? hash2(sval->str,sval->len) : ival ;
-    unsigned idx = (unsigned) hash & htable->hmask ;
-    HNODE* q = 0 ;
-    HNODE* p = htable->buckets[idx] ;
-    while(p) {
-        if (hash == p->ival && (!sval || STRING_eq(sval,p->key))) {
-            /* found */
-            if (flag == DELETE_) {
-                {
-                    htable->size-- ;
-                    *szp = htable->size ;
-                    if (q) {
-                        q->link = p->link ;
-                    }
-                    else {
-                        htable->buckets[idx] = p->link ;
+static void make_slots(ITable* ht, unsigned hmask)
+{
+    unsigned n ;
+    ht->hmask = hmask ;
+    ht->shift = 32 ;
+    for(n = hmask; n; n >>= 1) ht->shift-- ;
+    ht->limit = hmask - (hmask>>2) ;
+    ht->slots = (HSLOT*)zmalloc((hmask+1) * sizeof(HSLOT)) ;
+    memset(ht->slots, 0, (hmask+1) * sizeof(HSLOT)) ;
+}
+CELL* itable_find(ITable* htable, STRING* sval, int64_t ival,
+                  int flag, size_t* szp)
+{
+    uint64_t hval = sval ? hash64(sval->str,sval->len) : (uint64_t) ival ;
+    uint32_t hfrag = hash_frag(hval) ;
+    unsigned idx = hslot_home(hfrag, htable->shift) ;
+    unsigned dist = 0 ;
+    HSLOT* slots = htable->slots ;
+    int long_key = sval && sval->len > KEY_INLINE ;
+    uint64_t word = 0 ;
+    if (sval == 0) word = (uint64_t) ival ;
+    else if (!long_key) word = inline_key(sval->str, sval->len) ;
+    while(slots[idx].node && hslot_dist(htable, idx) >= dist) {
+        if (hfrag == slots[idx].hfrag) {
+            HNODE* p = itable_node(htable, slots[idx].node) ;
+            if (!long_key ? p->key.word == word
+                          : !key_is_inline(p->key.word) &&
+                            STRING_eq(sval, key_sval(p->key.word))) {
+                /* found */
+                if (flag == DELETE_) {
+                    {
+                        unsigned next ;
+                        htable->size-- ;
+                        *szp = htable->size ;
+                        hnode_free(htable, p, slots[idx].node) ;
+                        while(next = (idx+1) & htable->hmask,
+                              slots[next].node && hslot_dist(htable, next) > 0) {
+                            slots[idx] = slots[next] ;
+                            idx = next ;
+                        }
+                        slots[idx].node = 0 ;
+                        return 0 ;
                     }
-                    hnode_free(p) ;
-                    return 0 ;
-                }
 
+                }
+                return &p->cell ;
             }
-            if (q) {
-                /* move to front */
-                q->link = p->link ;
-                p->link = htable->buckets[idx] ;
-                htable->buckets[idx] = p ;
-            }  /* else at front */
-            return &p->cell ;
         }
-        q = p ;
-        p = p->link ;
+        idx = (idx+1) & htable->hmask ;
+        dist++ ;
     }
     /* not found */
     if (flag == CREATE) {
-        {
-            p = ZMALLOC(HNODE) ;
-            p->key = sval ? STRING_dup(sval) : 0 ;
-            p->ival = hash ;
-            p->cell.type = C_NOINIT ;
-            p->link = htable->buckets[idx] ;
-            htable->buckets[idx] = p ;
-            htable->size++ ;
-            *szp = htable->size ;
-            if (htable->size > htable->limit) {
-                double_num_buckets(htable) ;
-            }
+        HSLOT e ;
+        HNODE* p = new_hnode(htable, &e.node) ;
+        if (sval) {
+            p->key.word = long_key ? make_key(sval) : word ;
+            htable->str_keys = 1 ;
+        }
+        else {
+            p->key.ival = ival ;
+        }
+        p->cell.type = C_NOINIT ;
+        e.hfrag = hfrag ;
+        hslot_insert(htable, e, idx, dist) ;
+        htable->size++ ;
+        *szp = htable->size ;
+        if (htable->size > htable->limit) {
+            double_num_slots(htable) ;
         }
 
         return &p->cell ;
     }
     return 0 ;
 }
-static void hnode_free(HNODE* p)
+static void hslot_insert(ITable* ht, HSLOT e, unsigned idx, unsigned dist)
+{
+    HSLOT* slots = ht->slots ;
+    while(slots[idx].node) {
+        unsigned d = hslot_dist(ht, idx) ;
+        if (d < dist) {
+            HSLOT hold = slots[idx] ;
+            slots[idx] = e ;
+            e = hold ;
+            dist = d ;
+        }
+        idx = (idx+1) & ht->hmask ;
+        dist++ ;
+    }
+    slots[idx] = e ;
+}
+static HBLOCK* new_hblock(size_t cnt)
+{
+    HBLOCK* b = (HBLOCK*)zmalloc(sizeof(HBLOCK) + cnt * sizeof(HNODE)) ;
+    b->cnt = cnt ;
+    return b ;
+}
+
+static void hblock_free(HBLOCK* b)
+{
+    zfree(b, sizeof(HBLOCK) + b->cnt * sizeof(HNODE)) ;
+}
+
+static HNODE* new_hnode(ITable* ht, uint32_t* np)
+{
+    HNODE* p ;
+    if (ht->free_nodes) {
+        *np = (uint32_t) ht->free_nodes ;
+        p = itable_node(ht, *np) ;
+        ht->free_nodes = p->key.ival ;
+        return p ;
+    }
+    if (ht->used == ht->nodes->limit && !dvec_grow(ht->nodes)) {
+        rt_overflow("array size", (unsigned) ht->used) ;
+    }
+    p = dvec_node(ht->nodes, ht->used) ;
+    *np = (uint32_t) ++ht->used ;
+    return p ;
+}
+
+static void hnode_free(ITable* ht, HNODE* p, uint32_t n)
 {
-    if (p->key) free_STRING(p->key) ;
+    if (ht->str_keys) free_key(p->key.word) ;
     cell_destroy(&p->cell) ;
-    zfree(p, sizeof(HNODE)) ;
+    p->cell.type = NODE_FREE ;
+    p->key.ival = ht->free_nodes ;
+    ht->free_nodes = n ;
 }
+
 static void itable_free(ITable* ht)
 {
-    unsigned i ;
-    unsigned size = ht->size ;
-    for(i=0; size > 0; i++) {
-        HNODE* p = ht->buckets[i] ;
-        while(p) {
-            HNODE* q = p ;
-            p = p->link ;
-            hnode_free(q) ;
-            size-- ;
+    size_t i ;
+    for(i=0; i < ht->used; i++) {
+        HNODE* p = dvec_node(ht->nodes, i) ;
+        if (p->cell.type != NODE_FREE) {
+            if (ht->str_keys) free_key(p->key.word) ;
+            cell_destroy(&p->cell) ;
         }
     }
-    free(ht->buckets) ;
+    dvec_free(ht->nodes) ;
+    zfree(ht->slots, (ht->hmask+1) * sizeof(HSLOT)) ;
     zfree(ht, sizeof(ITable)) ;
 }
 static void itable_convert_i_to_s(ITable* ht)
 {
-    char buffer[256] ;
-    unsigned hmask = ht->hmask ;
-    HNODE** new_buckets = make_buckets(hmask+1) ;
-    unsigned i ;  /* walks old buckets */
-    unsigned j ;  /* index into new_buckets */
-    unsigned cnt = ht->size ;  /* number of nodes to convert */
-    for(i=0; cnt > 0; i++) {
-        HNODE* p = ht->buckets[i] ;
-        while(p) {
-            HNODE* q = p ;
-            p = p->link ;
-            sprintf(buffer, LDFMT, q->ival) ;
-            q->key = new_STRING(buffer) ;
-            q->ival = hash(buffer) ;
-            j = q->ival & hmask ;
-            q->link = new_buckets[j] ;
-            new_buckets[j] = q ;
-            cnt-- ;
-        }
-    }
-    free(ht->buckets) ;
-    ht->buckets = new_buckets ;
-}
-static void double_num_buckets(ITable* htable)
-{
-   unsigned old_hmask = htable->hmask ;
-   unsigned new_hmask = (old_hmask<<1)+1 ;
-   HNODE** buckets = htable->buckets ;
-   buckets = (HNODE**)erealloc(buckets, sizeof(HNODE*) * (new_hmask+1)) ;
-   {
-       HNODE* p ;  /* walks bucket[i] */
-       HNODE* q ;  /* trails p */
-       HNODE* tail ; /* builds bucket[j] from the back */
-       HNODE p0 ;  /* sentinel */
-       HNODE t0 ;  /* sentinel */
-       unsigned i, j ;
-
-       for(i=0, j=old_hmask+1; i < old_hmask+1; i++, j++) {
-           p = buckets[i] ;
-           q = &p0 ;
-           q->link = p ;
-           tail = &t0 ;
-           tail->link = 0 ;
-
-           while(p) {
-               if (p->ival & (old_hmask+1)) {
-                   /* it moves */
-                   q->link = p->link ;
-                   tail = tail->link = p ;
-                   tail->link = 0 ;
-                   p = q->link ;
-               }
-               else {
-                   q = p ;
-                   p = p->link ;
-               }
-           }
-           buckets[i] = p0.link ;
-           buckets[j] = t0.link ;
-       }
-   }
-
-   htable->hmask = new_hmask ;
-   htable->limit = (new_hmask+1) * MAX_AVE_BUCKET_SIZE ;
-   htable->buckets = buckets ;
+    HSLOT* old_slots = ht->slots ;
+    unsigned cnt = ht->hmask+1 ;  /* number of old slots */
+    unsigned i ;
+    make_slots(ht, ht->hmask) ;
+    ht->str_keys = 1 ;
+    for(i=0; i < cnt; i++) {
+        if (old_slots[i].node) {
+            HSLOT e = old_slots[i] ;
+            HNODE* p = itable_node(ht, e.node) ;
+            e.hfrag = int_to_str_key(p, p->key.ival) ;
+            hslot_insert(ht, e, hslot_home(e.hfrag, ht->shift), 0) ;
+        }
+    }
+    zfree(old_slots, cnt * sizeof(HSLOT)) ;
 }
-static int64_t*  itable_i_vector(ITable* it)
+static uint32_t int_to_str_key(HNODE* p, int64_t ival)
 {
-    int64_t* ret = (int64_t*)zmalloc(sizeof(int64_t)*it->size) ;
-    unsigned r = 0 ;
-    unsigned i ;
-    for(i=0; r < it->size; i++) {
-        HNODE* p = it->buckets[i] ;
-        while(p) {
-            ret[r++] = p->ival ;
-            p = p->link ;
+    char buffer[64] ;
+    int len = sprintf(buffer, LDFMT, ival) ;
+    p->key.word = len <= KEY_INLINE ? inline_key(buffer, len)
+                      : (uint64_t)(uintptr_t) new_STRING2(buffer, len) ;
+    return hash_frag(hash64(buffer, len)) ;
+}
+static ITable* itable_from_dvec(DVEC* dv, size_t size, int str_keys)
+{
+    ITable* ht = ZMALLOC(ITable) ;
+    unsigned hmask = INIT_HMASK ;
+    size_t i ;
+    while(hmask - (hmask>>2) < size) hmask = (hmask<<1)+1 ;
+    make_slots(ht, hmask) ;
+    ht->size = size ;
+    ht->str_keys = str_keys ;
+    ht->used = size ;
+    ht->free_nodes = 0 ;
+    ht->nodes = dv ;
+    for(i=0; i < size; i++) {
+        HNODE* p = dvec_node(dv, i) ;
+        int64_t ival = (int64_t) i + dv->origin ;
+        HSLOT e ;
+        e.node = (uint32_t) (i+1) ;
+        if (str_keys) {
+            e.hfrag = int_to_str_key(p, ival) ;
         }
+        else {
+            p->key.ival = ival ;
+            e.hfrag = hash_frag((uint64_t) ival) ;
+        }
+        hslot_insert(ht, e, hslot_home(e.hfrag, ht->shift), 0) ;
     }
-    return ret ;
+    return ht ;
 }
-static STRING**  itable_s_vector(ITable* it)
+static void double_num_slots(ITable* ht)
 {
-    STRING** ret = (STRING**)zmalloc(sizeof(STRING*)*it->size) ;
-    unsigned r = 0 ;
+    HSLOT* old_slots = ht->slots ;
+    unsigned cnt = ht->hmask+1 ;  /* number of old slots */
     unsigned i ;
-    for(i=0; r < it->size; i++) {
-        HNODE* p = it->buckets[i] ;
-        while(p) {
-            ret[r++] = STRING_dup(p->key) ;
-            p = p->link ;
+    make_slots(ht, (ht->hmask<<1)+1) ;
+    for(i=0; i < cnt; i++) {
+        if (old_slots[i].node) {
+            hslot_insert(ht, old_slots[i],
+                         hslot_home(old_slots[i].hfrag, ht->shift), 0) ;
         }
     }
-    return ret ;
+    zfree(old_slots, cnt * sizeof(HSLOT)) ;
 }
 
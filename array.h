@@ -28,29 +28,45 @@ It's easiest to read or modify this file by working with array.w.
 typedef struct array {
    void* ptr ;  /* What this points to depends on the type */
    size_t size ; /* number of elts in the table */
-   int type ;  /* values in AY_NULL .. AY_SPLIT */
+   int type ;  /* values in AY_NULL .. AY_MAPPED */
+   int big ;  /* on the list of arrays that can be spilled */
+   struct aloop* loops ;  /* for(i in A) loops walking A in place */
 } *ARRAY ;
 enum {
    AY_NULL = 0,
    AY_SPLIT,
    AY_STR,
-   AY_INT
+   AY_INT,
+   AY_SPILL,
+   AY_MAPPED
 } ;
-#define new_ARRAY()  ((ARRAY)memset(ZMALLOC(struct array),0,sizeof(struct array)))
+#define new_ARRAY()  ((ARRAY)memset(zmalloc_t(sizeof(struct array),ZT_ARRAY),\
+                                    0,sizeof(struct array)))
 #define NO_CREATE  0
 #define CREATE     1
 #define DELETE_   2
 typedef struct aloop {
     struct aloop* link ;
-    int type ;  /* AY_NULL .. AY_INT */
+    struct aloop* alink ;
+    ARRAY A ;
+    int type ;  /* AY_NULL .. AY_SPILL */
+    int origin ;  /* for AY_SPLIT */
     unsigned size ;
     unsigned next ;
+    unsigned part ;  /* for AY_SPILL */
     CELL* cp ;
     union {
-        STRING** sval ;  /* for AY_STR */
+        STRING** sval ;  /* for AY_STR and AY_SPILL */
         int64_t*  ival ; /* for AY_INT */
     } ptr ;
 } ALoop ;
+#define AL_UNSORTED  0
+#define AL_IND_NUM   1
+#define AL_IND_STR   2
+#define AL_VAL_NUM   3
+#define AL_VAL_STR   4
+#define AL_VAL_TYPE  5
+#define AL_DESC      8  /* or'ed with one of the above */
 CELL* array_find(ARRAY, CELL*, int);
 void  array_delete(ARRAY, CELL*);
 void  array_load(ARRAY, size_t);
@@ -62,5 +78,13 @@ void aloop_free(ALoop*) ;
 int aloop_next(ALoop*) ;
 
 
+int array_order(const char*) ;
+size_t array_sort(ARRAY, ARRAY, int, int) ;
+
+void array_spill(CELL*, CELL*) ;
+
+int array_dump(ARRAY, const char*) ;
+int array_attach(ARRAY, const char*) ;
+
 #endif /* ARRAY_H */
 
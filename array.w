@@ -18,28 +18,35 @@ values.
 The type [[ARRAY]] is a pointer to a [[struct array]].
 The [[size]] field is the number of elements in the table.
 The meaning of the [[ptr]] field depends on the [[type]] field.
+The [[loops]] field is explained with array loops below, and the
+[[big]] field with spilling arrays to disk.
 
 <<array typedefs and [[#defines]]>>=
 typedef struct array {
    void* ptr ;  /* What this points to depends on the type */
    size_t size ; /* number of elts in the table */
-   int type ;  /* values in AY_NULL .. AY_SPLIT */
+   int type ;  /* values in AY_NULL .. AY_MAPPED */
+   int big ;  /* on the list of arrays that can be spilled */
+   struct aloop* loops ;  /* for(i in A) loops walking A in place */
 } *ARRAY ;
 @ %def ARRAY
 
 By AWK language specification, there is only one kind of array,
-but internally [[mawk]] has four kinds of arrays.
+but internally [[mawk]] has six kinds of arrays.
 These are distinguished by the
 [[type]] field in the structure.  The types are,
 
 \I[[AY_NULL]] The array is empty.  The [[size]] and [[ptr]] fields are
 zero.
 
-\I[[AY_SPLIT]] The array was created by the [[AWK]] built-in
-[[split]].  The return value from [[split]] is stored in the [[size]]
-field.  The [[ptr]] field points at a vector of [[CELL]]s.  The number
-of [[CELL]]s is the [[size]] field. 
-The address of [[A[i]]] is [[(CELL*)A->ptr+i-1]].
+\I[[AY_SPLIT]] The keys are the consecutive integers
+[[origin]] to [[origin+size-1]], where [[origin]] is 0 or 1.
+The [[ptr]] field points at a [[DVEC]], a dense vector of [[CELL]]s,
+and the address of [[A[i]]] is [[dvec_cell(A->ptr, i-origin)]].
+The name is historical: the array was created by the [[AWK]] built-in
+[[split]], with [[origin]] 1 and the return value from [[split]] in
+the [[size]] field.  An array that is filled in key order,
+e.g., [[A[++n] = $0]] or [[A[n++] = $0]], is also of this type.
 
 \I[[AY_STR]] The [[ptr]] field points at an associative map from
 [[STRING*]] to [[CELL*]].  If [[s]] is an awk string, then this
@@ -52,14 +59,25 @@ memory [[A[d]]].  An array of this type must always be
 accessed with an integer key.  If it is accessed with a string
 key, then the array is converted to type [[AY_STR]].
 
+\I[[AY_SPILL]] The array was an [[AY_STR]] array that has been
+written to a temporary file to keep under the memory budget set
+with [[-W memory]].  The [[ptr]] field points at a [[Spill]],
+see below.
+
+\I[[AY_MAPPED]] The array was read with [[reada()]] and its
+elements are in a file mapped into memory.  The [[ptr]] field
+points at an [[AMap]], see array files below.
+
 <<array typedefs and [[#defines]]>>=
 enum {
    AY_NULL = 0,
    AY_SPLIT,
    AY_STR,
-   AY_INT
+   AY_INT,
+   AY_SPILL,
+   AY_MAPPED
 } ;
-@ %def AY_NULL AY_INT AY_STR AY_SPLIT
+@ %def AY_NULL AY_INT AY_STR AY_SPLIT AY_SPILL AY_MAPPED
 
 \subsection{Construction}
 Arrays are always created as empty arrays of type [[AY_NULL]].
@@ -68,7 +86,8 @@ their type change by conversion.  The only constructor function is
 a macro.
 
 <<array typedefs and [[#defines]]>>=
-#define new_ARRAY()  ((ARRAY)memset(ZMALLOC(struct array),0,sizeof(struct array)))
+#define new_ARRAY()  ((ARRAY)memset(zmalloc_t(sizeof(struct array),ZT_ARRAY),\
+				    0,sizeof(struct array)))
 @ %def new_ARRAY
 @
 \subsection{Internal Tables}
@@ -114,12 +133,139 @@ table, then [[*sizep]] is set to the new size (+1 the old size on
 creation or -1 the old size on deletion).
 \endhitems
 
+\subsection{Dense Vectors}
+The elements of an [[AY_SPLIT]] array are held in a [[DVEC]].
+The caller of [[array_find()]] can hold the address of one element
+while another is created, e.g., [[A[1] = A[2]]], so an element
+never moves, not when the vector grows and not when the array is
+converted to a hash table.
+A [[DVEC]] is a list of segments and each segment is an [[HBLOCK]]
+of [[HNODE]]s, the nodes of the hash table (see below), so
+a conversion hands the vector to the new table, which keeps
+its nodes in a [[DVEC]] too.
+Segment [[seg[0]]] holds [[base]] nodes and segment [[seg[k]]] for
+[[k > 0]] holds [[base<<(k-1)]], so each new segment doubles
+[[limit]], the number of nodes allocated, and the segment of
+element [[i]] is found from the log base 2 of [[i/base]].
+
+<<local constants, defines and prototypes>>=
+#define DVEC_SEGS   32
+#define DVEC_INIT   8
+typedef struct dvec {
+    int origin ;  /* the key of element 0, 0 or 1 */
+    int nseg ;  /* number of segments in use */
+    int base_log ;  /* log2(base), or -1 if base is not a power of 2 */
+    size_t base ;  /* nodes in seg[0] */
+    size_t limit ;  /* nodes in all the segments */
+    struct hnode* seg[DVEC_SEGS] ;
+} DVEC ;
+@ %def DVEC DVEC_SEGS DVEC_INIT
+
+<<local functions>>=
+static DVEC* new_dvec(size_t base, int origin)
+{
+    DVEC* dv = ZMALLOC(DVEC) ;
+    size_t b ;
+    dv->origin = origin ;
+    dv->nseg = 1 ;
+    dv->base = base ;
+    dv->limit = base ;
+    dv->base_log = -1 ;
+    for(b = 1 ; b && b <= base ; b <<= 1) {
+        if (b == base) dv->base_log = floor_log2(b) ;
+    }
+    dv->seg[0] = hblock_nodes(new_hblock(base)) ;
+    return dv ;
+}
+@ %def new_dvec
+
+<<local functions>>=
+static int floor_log2(size_t q)
+{
+#ifdef __GNUC__
+    return (int)(8*sizeof(unsigned long long) - 1)
+              - __builtin_clzll((unsigned long long) q) ;
+#else
+    int k = 0 ;
+    while(q >>= 1) k++ ;
+    return k ;
+#endif
+}
+
+static HNODE* dvec_node(DVEC* dv, size_t i)
+{
+    if (i < dv->base) {
+        return dv->seg[0] + i ;
+    }
+    else {
+        size_t q = dv->base_log >= 0 ? i >> dv->base_log : i / dv->base ;
+	int k = floor_log2(q) + 1 ;
+	return dv->seg[k] + (i - (dv->base << (k-1))) ;
+    }
+}
+@ %def floor_log2 dvec_node
+
+<<local constants, defines and prototypes>>=
+#define dvec_cell(dv, i)  (&dvec_node(dv, i)->cell)
+@ %def dvec_cell
+
+Function [[dvec_grow(dv)]] adds a segment to [[*dv]], or returns
+zero if it has as many as it can hold.
+Function [[dvec_push(A)]] adds the element after the last to
+[[AY_SPLIT]] array [[A]] and returns its address, or returns zero if
+[[A]] has as many elements as a [[DVEC]] can hold.
+
+<<local functions>>=
+static int dvec_grow(DVEC* dv)
+{
+    size_t cnt = dv->base << (dv->nseg-1) ;
+    if (dv->nseg == DVEC_SEGS) return 0 ;
+    dv->seg[dv->nseg++] = hblock_nodes(new_hblock(cnt)) ;
+    dv->limit += cnt ;
+    return 1 ;
+}
+
+static CELL* dvec_push(ARRAY A)
+{
+    DVEC* dv = (DVEC*)A->ptr ;
+    CELL* cp ;
+    if (A->size == dv->limit && !dvec_grow(dv)) return 0 ;
+    cp = dvec_cell(dv, A->size) ;
+    cp->type = C_NOINIT ;
+    A->size++ ;
+    return cp ;
+}
+@ %def dvec_grow dvec_push
+
+Function [[dvec_free(dv)]] frees the memory of [[DVEC]] [[*dv]].  The
+elements have been destroyed.
+
+<<local functions>>=
+static void dvec_free(DVEC* dv)
+{
+    int k ;
+    for(k = 0 ; k < dv->nseg ; k++) {
+        hblock_free(node_hblock(dv->seg[k])) ;
+    }
+    zfree(dv, sizeof(DVEC)) ;
+}
+@ %def dvec_free
+
+<<local constants, defines and prototypes>>=
+static DVEC* new_dvec(size_t, int) ;
+static int floor_log2(size_t) ;
+static struct hnode* dvec_node(DVEC*, size_t) ;
+static int dvec_grow(DVEC*) ;
+static CELL* dvec_push(ARRAY) ;
+static void dvec_free(DVEC*) ;
+
+@
 \subsection{Array Type Conversions}
 By specification of the AWK language, an array is an association of
 string value to AWK scalar, [[A[3] = 1]] means [[A["3"] = 1]].
 So in theory, there is only one array type, [[AY_STR]].  In
 practice, [[mawk]] uses [[AY_SPLIT]] and [[AY_INT]] for faster
-performance.  This works fine as long as [[A[3]]] is always accessed
+performance and less memory.  This works fine as long as [[A[3]]] is always accessed
 as [[A[3]]], but while [[A[3]=1; print A["3"]]] is weird, it is
 also correct and must print [[1]].  Handling this example correctly
 requires array [[A]] be converted from [[AY_INT]] to [[AY_STR]].
@@ -138,59 +284,35 @@ This is [[AY_INT]] to [[AY_STR]].
 static void array_int_to_str(ARRAY A)
 {
     ITable* ht = (ITable*)A->ptr ;
+    if (A->loops) aloop_snapshot(A) ;
     itable_convert_i_to_s(ht) ;
     A->type = AY_STR ;
 }
 @ %def array_int_to_str
 
-This is [[AY_SPLIT]] to [[AY_INT]]. Each element of the
-split array is inserted into an integer array.
+This is [[AY_SPLIT]] to [[AY_INT]] and [[AY_SPLIT]] to [[AY_STR]].
+The nodes of the dense vector become the nodes of the
+hash table, with [[itable_from_dvec()]] making the
+keys and the slots.  For string keys this involves
+converting each key to string with [[sprintf()]].
 
 <<local functions>>=
 static void array_split_to_int(ARRAY A)
 {
-    ITable* tb = make_empty_itable() ;
-    unsigned i ;
-    CELL* cells = (CELL*)A->ptr ;
-    for(i=1; i <= A->size; i++) {
-	size_t unused ;
-        CELL* cp = itable_find(tb,0, i, CREATE, &unused) ;
-	*cp = cells[i-1] ; /* no ref cnt adjustment needed */
-    }
-    zfree(cells, sizeof(CELL) * A->size) ;
+    if (A->loops) aloop_snapshot(A) ;
+    A->ptr = itable_from_dvec((DVEC*)A->ptr, A->size, 0) ;
     A->type = AY_INT ;
-    A->ptr = tb ;
     /* A->size stayed the same */
 }
-@ %def array_split_to_int
-
-This is [[AY_SPLIT]] to [[AY_STR]].  Each element of the
-split array is inserted into a string array.  This involves
-converting each key to string with [[sprintf()]].
 
-<<local functions>>=
 static void array_split_to_str(ARRAY A)
 {
-    ITable* tb = make_empty_itable() ;
-    unsigned i ;
-    CELL* cells = (CELL*)A->ptr ;
-    for(i=1; i <= A->size; i++) {
-	size_t unused ;
-        char buffer[128] ;
-        STRING* sval ;
-        CELL* cp ; 
-	sprintf(buffer, "%u" , i) ;
-	sval = new_STRING(buffer) ;
-	cp = itable_find(tb, sval, 0, CREATE, &unused) ;
-	*cp = cells[i-1] ; /* no ref cnt adjustment needed */
-	free_STRING(sval) ;
-    }
-    zfree(cells, sizeof(CELL) * A->size) ;
+    if (A->loops) aloop_snapshot(A) ;
+    A->ptr = itable_from_dvec((DVEC*)A->ptr, A->size, 1) ;
     A->type = AY_STR ;
-    A->ptr = tb ;
     /* A->size stayed the same */
 }
-@ %def array_split_to_str
+@ %def array_split_to_int array_split_to_str
 
 <<local constants, defines and prototypes>>=
 static void array_int_to_str(ARRAY) ;
@@ -270,9 +392,43 @@ reswitch:
 	    { 
 		CELL* ret ;
 		cast1_to_s(&key) ;
+		<<snapshot loops on [[A]] before a new string key is made>>
 		ret = itable_find((ITable*)(A->ptr),string(&key), 0,
 		          create_flag, &A->size) ;
 		free_STRING(string(&key)) ;
+		if (A->size >= SPILL_MIN && !A->big) big_add(A) ;
+		return ret ;
+	    }
+	case AY_SPILL:
+	    {
+		CELL* ret ;
+		cast1_to_s(&key) ;
+		if (A->loops && create_flag) {
+		    ret = spill_find((Spill*)A->ptr, string(&key),
+				     NO_CREATE, &A->size) ;
+		    if (ret) {
+			free_STRING(string(&key)) ;
+			return ret ;
+		    }
+		    aloop_snapshot(A) ;
+		}
+		ret = spill_find((Spill*)A->ptr, string(&key),
+		                 create_flag, &A->size) ;
+		free_STRING(string(&key)) ;
+		return ret ;
+	    }
+	case AY_MAPPED:
+	    {
+		AMap* M = (AMap*)A->ptr ;
+		CELL* ret ;
+		cast1_to_s(&key) ;
+		ret = map_find(M, string(&key)) ;
+		if (ret == 0 && create_flag) {
+		    size_t dummy ;
+		    ret = itable_find(M->ht, string(&key), 0, CREATE, &dummy) ;
+		    A->size++ ;
+		}
+		free_STRING(string(&key)) ;
 		return ret ;
 	    }
 	case AY_INT:
@@ -281,6 +437,7 @@ reswitch:
 		    array_int_to_str(A) ;
 		    goto reswitch ;
 		}
+		<<snapshot loops on [[A]] before a new integer key is made>>
 		/* the expected case */
 		return itable_find((ITable*)A->ptr, 0, (int64_t)key.dval, 
 		           create_flag, &A->size) ;
@@ -291,39 +448,79 @@ reswitch:
 }
 @ %def array_find
 
-If [[1 <= key <= A->size]], then lookup is a simple array reference, else a
-conversion is needed.
+If a loop is walking [[A]] in place, a new key changes the structure
+of [[A]], so a lookup that can create is first tried without creating.
+This is done the same way for an [[AY_SPILL]] array, so a loop
+visits the same keys whether or not [[A]] went to disk.
+
+<<snapshot loops on [[A]] before a new string key is made>>=
+if (A->loops && create_flag) {
+    ret = itable_find((ITable*)A->ptr, string(&key), 0,
+                      NO_CREATE, &A->size) ;
+    if (ret) {
+	free_STRING(string(&key)) ;
+        return ret ;
+    }
+    aloop_snapshot(A) ;
+}
+
+<<snapshot loops on [[A]] before a new integer key is made>>=
+if (A->loops && create_flag) {
+    CELL* ret = itable_find((ITable*)A->ptr, 0, (int64_t) key.dval,
+                            NO_CREATE, &A->size) ;
+    if (ret) return ret ;
+    aloop_snapshot(A) ;
+}
+
+@
+If [[origin <= key < origin+A->size]], then lookup is a simple
+array reference.  Creating the element at [[key == origin+A->size]]
+appends to the vector.  Any other new key needs a conversion.
 
 <<find in a split array>>=
 {
+    DVEC* dv = (DVEC*)A->ptr ;
+    double d ;
     if (key.type != C_DOUBLE || !is_int_double(key.dval)) {
         array_split_to_str(A) ;
 	goto reswitch ;
     }
-    if (key.dval < 1.0 || key.dval > (double) A->size) {
-        if (create_flag) {
-	    array_split_to_int(A) ;
-	    goto reswitch ;
-	}
-	else  return 0 ;
+    d = key.dval - dv->origin ;
+    if (d >= 0.0 && d < (double) A->size) {
+        /* the expected case */
+	return dvec_cell(dv, (size_t) d) ;
+    }
+    else if (!create_flag) {
+        return 0 ;
     }
     else {
-        /* the expected case */
-        CELL* cells = (CELL*)A->ptr ;
-	unsigned d = (unsigned) key.dval ;
-	return &cells[d-1] ;
+        CELL* cp ;
+	if (A->loops) aloop_snapshot(A) ;
+	if (d == (double) A->size && (cp = dvec_push(A))) {
+	    return cp ;
+	}
+	array_split_to_int(A) ;
+	goto reswitch ;
     }
 }
 
 @
 One element is added to an empty table.  The table type is 
-[[AY_INT]] or [[AY_STR]] depending on the type of the key.
+[[AY_INT]] or [[AY_STR]] depending on the type of the key, except
+that a key of 0 or 1 starts a dense [[AY_SPLIT]] array with that
+origin, in the expectation that the keys that follow are in order.
 
 <<make a new integer or string array>>=
 {
-    ITable* tb = make_empty_itable() ;
-    A->ptr = tb ;
+    ITable* tb ;
     A->size = 0 ;
+    if (key.type == C_DOUBLE && (key.dval == 0.0 || key.dval == 1.0)) {
+        A->ptr = new_dvec(DVEC_INIT, (int) key.dval) ;
+	A->type = AY_SPLIT ;
+	return dvec_push(A) ;
+    }
+    tb = make_empty_itable() ;
+    A->ptr = tb ;
     if (key.type != C_DOUBLE || !is_int_double(key.dval)) {
 	A->type = AY_STR ;
 	goto reswitch ;
@@ -341,7 +538,8 @@ at the [[CELL]] holding [[expr]].
 Depending on the type of array [[A]] and the type of [[*cp]],
 the array may undergo type conversion similar to that with
 [[array_find(A,cp)]].  After that, it is a call to
-[[itable_find()]] for deletion. If deletion makes the size zero,
+[[itable_find()]] for deletion.  Deleting the last element of an
+[[AY_SPLIT]] array leaves it dense.  If deletion makes the size zero,
 the array [[type]] becomes [[AY_NULL]].
 
 <<interface functions>>=
@@ -358,6 +556,14 @@ reswitch:
 	    itable_find((ITable*)A->ptr, string(&key), 0, DELETE_, &A->size) ;
 	    free_STRING(string(&key)) ;
 	    break ;
+	case AY_SPILL:
+	    cast1_to_s(&key) ;
+	    spill_find((Spill*)A->ptr, string(&key), DELETE_, &A->size) ;
+	    free_STRING(string(&key)) ;
+	    break ;
+	case AY_MAPPED:
+	    map_to_str(A) ;
+	    goto reswitch ;
 	case AY_INT:
 	    if (key.type != C_DOUBLE || !is_int_double(key.dval)) {
 	        array_int_to_str(A) ;
@@ -370,12 +576,22 @@ reswitch:
 	    if (key.type != C_DOUBLE || !is_int_double(key.dval)) {
 	        array_split_to_str(A) ;
 	    }
-	    else if (key.dval < 1.0 || key.dval > (double)A->size) {
-	        /* not in the array so nothing to do */
-		return ;
-	    }
 	    else {
-	        array_split_to_int(A) ;
+	        DVEC* dv = (DVEC*)A->ptr ;
+		double d = key.dval - dv->origin ;
+		if (d < 0.0 || d >= (double)A->size) {
+		    /* not in the array so nothing to do */
+		    return ;
+		}
+		else if (d == (double)(A->size-1)) {
+		    /* the last element, stays dense */
+		    cell_destroy(dvec_cell(dv, A->size-1)) ;
+		    A->size-- ;
+		    break ;
+		}
+		else {
+		    array_split_to_int(A) ;
+		}
 	    }
 	    goto reswitch ;
     }
@@ -402,12 +618,11 @@ void array_load(ARRAY A, size_t cnt)
 {
     array_clear(A) ;
     if (cnt > 0) {
-        CELL* cells = (CELL*)zmalloc(sizeof(CELL) * cnt) ;
-	memset(cells, 0, sizeof(CELL) * cnt) ;
+        DVEC* dv = new_dvec(cnt, 1) ;
         A->size = cnt ;
 	A->type = AY_SPLIT ;
-	A->ptr = cells ;
-        transfer_to_array(cells, cnt) ;
+	A->ptr = dv ;
+        transfer_to_array(&dv->seg[0]->cell, cnt, sizeof(HNODE)) ;
     }
 }
 @ %def array_load
@@ -422,18 +637,31 @@ itself.  This function gets called in four contexts:
 (3)~execution of the [[AWK]] statement, [[delete A[expr]]], deletes
 the last element, and
 (4)~when an existing array is used by [[split()]].
+After a big array is cleared, [[zreclaim()]] gives the memory
+chunks it leaves empty back to the operating system.
 
 <<interface functions>>=
+#define RECLAIM_SIZE  4096  /* a big array, see zreclaim() */
+
 void array_clear(ARRAY A)
 {
+    size_t size = A->size ;
     if (A->type == AY_NULL) return ;
+    if (A->loops) aloop_snapshot(A) ;
+    if (A->big) big_remove(A) ;
 
     if (A->type == AY_SPLIT) {
-        unsigned i ;
+        size_t i ;
         for(i = 0; i < A->size; i++) {
-            cell_destroy((CELL*)A->ptr+i) ;
+            cell_destroy(dvec_cell((DVEC*)A->ptr, i)) ;
 	}
-        zfree(A->ptr, A->size * sizeof(CELL)) ;
+        dvec_free((DVEC*)A->ptr) ;
+    }
+    else if (A->type == AY_SPILL) {
+        spill_free((Spill*)A->ptr) ;
+    }
+    else if (A->type == AY_MAPPED) {
+        map_free((AMap*)A->ptr) ;
     }
     else {
         itable_free((ITable*)A->ptr) ;
@@ -442,6 +670,7 @@ void array_clear(ARRAY A)
     A->ptr = 0 ;
     A->size = 0 ;
     A->type = AY_NULL ;
+    if (size >= RECLAIM_SIZE) zreclaim() ;
 }
 @ %def array_clear
 
@@ -457,32 +686,63 @@ is controlled by an [[ALoop]].  The fields in an [[ALoop]] are,
 
 \I[[type]] is the type of array [[A]].
 
-\I[[size]] is the size of [[A]].
+\I[[origin]] is the first key if [[A]] is [[AY_SPLIT]].
+
+\I[[A]] is the array if the loop walks [[A]] in place, else zero.
 
-\I[[next]] is an index into the indices of [[A]].
+\I[[alink]] links the in place loops on [[A]], which start at
+[[A->loops]].
+
+\I[[size]] is the number of indices in [[ptr]].
+
+\I[[next]] is an index into [[ptr]], or the position of
+an in place walk.
 
 \I[[cp]] is a pointer to the [[CELL]] address of loop variable [[i]].
 
+\I[[part]] is the next partition to walk if [[A]] is [[AY_SPILL]].
+
 \I[[link]] is pointer used to put the [[ALoop]] object in a stack, which
 handles nested loops.
 \endhitems
 
 \noindent
-Since the [[ALoop]] object holds all state necessary to run the loop,
-the user
-program can do anything to [[A]] inside the body of
-the loop, even [[delete A]], and the loop
+A loop walks [[A]] in place:
+an [[AY_SPLIT]] array by index and an [[AY_INT]] or [[AY_STR]]
+array over the [[HNODE]]s of the table by their index, which is
+the order the elements were created in if none were deleted.
+Nothing is copied, so a loop over a large array in an [[END]]
+block does not need memory for all its keys.
+An [[AY_SPILL]] array is walked a partition at a time, from a
+vector of the keys of the partition, so only that partition need
+be in memory; a key in the vector that has since been deleted is
+skipped.
+An [[AY_MAPPED]] array is first made an [[AY_STR]] array.
+The body of the loop can delete elements of [[A]].  The node of a
+deleted element is marked free and is skipped.
+Anything else that changes the structure of [[A]], i.e.,
+creating an element, a type conversion or [[delete A]],
+first calls [[aloop_snapshot(A)]] which copies the keys that each
+in place loop on [[A]] has still to visit to a vector, and the
+loops carry on from their vectors.
+So the
+user program can do anything to [[A]] inside the body of
+the loop and the loop
 still works.
 
 <<array typedefs and [[#defines]]>>=
 typedef struct aloop {
     struct aloop* link ;
-    int type ;  /* AY_NULL .. AY_INT */
+    struct aloop* alink ;
+    ARRAY A ;
+    int type ;  /* AY_NULL .. AY_SPILL */
+    int origin ;  /* for AY_SPLIT */
     unsigned size ;
     unsigned next ;
+    unsigned part ;  /* for AY_SPILL */
     CELL* cp ;
     union {
-        STRING** sval ;  /* for AY_STR */
+        STRING** sval ;  /* for AY_STR and AY_SPILL */
 	int64_t*  ival ; /* for AY_INT */
     } ptr ;
 } ALoop ;
@@ -501,101 +761,246 @@ unchanged and the return is [[0]].
 \endhitems
 
 \noindent
-Note, that the [[ITable]] interface provides a hook for getting
-the array indices into a vector.
+The order of the loop is set at run time by
+[[PROCINFO["sorted_in"]]], see [[aloop_order()]] below.  Unless
+it asks for a sorted order, the loop walks [[A]] in place.
 
 <<interface functions>>=
 ALoop* make_aloop(ARRAY A, CELL* cp) 
 {
-    ALoop* al = (ALoop*)zmalloc(sizeof(ALoop)) ;
+    ALoop* al = ZMALLOC(ALoop) ;
+    int order ;
+    if (A->type == AY_MAPPED) map_to_str(A) ;
+    order = A->type == AY_NULL ? AL_UNSORTED : aloop_order() ;
     al->type = A->type ;
-    al->size = A->size ;
+    al->origin = 0 ;
+    al->size = 0 ;
     al->next = 0 ;
+    al->part = 0 ;
     al->cp = cp ;
     al->link = 0 ;
-    if (al->type == AY_INT) {
-        al->ptr.ival = itable_i_vector((ITable*)(A->ptr)) ;
-#ifdef QSORT
-	qsort(al->ptr.ival, al->size, sizeof(int64_t), i_compare) ;
-#endif
+    al->alink = 0 ;
+    al->A = 0 ;
+    if (order != AL_UNSORTED) {
+        aloop_sort(al, A, order) ;
     }
-    else if (al->type == AY_STR) {
-        al->ptr.sval = itable_s_vector((ITable*)(A->ptr)) ;
-#ifdef QSORT
-	qsort(al->ptr.sval, al->size, sizeof(STRING*), s_compare) ;
-#endif
+    else if (al->type != AY_NULL) {
+        /* walk A in place */
+        al->A = A ;
+	al->alink = A->loops ;
+	A->loops = al ;
+	if (al->type == AY_SPLIT) {
+	    al->origin = ((DVEC*)A->ptr)->origin ;
+	}
     }
     return al ;
 }
 @ %def make_aloop
 
-<<local functions>>=
-#ifdef QSORT
-static int i_compare(const void* l, const void* r)
-{
-    const int64_t* il = l ;
-    const int64_t* ir = r ;
-    return *il - *ir ;
-}
-
-static int s_compare(const void* l, const void* r)
+<<interface functions>>=
+void aloop_free(ALoop* al)
 {
-    STRING* const* sl = l ;
-    STRING* const* sr = r ;
-    return STRING_cmp(*sl,*sr) ;
+    if (al->A) {
+        /* take it off the list of in place loops on A */
+        ALoop** pp = &al->A->loops ;
+	while(*pp != al) pp = &(*pp)->alink ;
+	*pp = al->alink ;
+    }
+    if (al->A == 0 || al->type == AY_SPILL) aloop_free_keys(al) ;
+    zfree(al, sizeof(ALoop)) ;
 }
-#endif
-@ %def i_compare s_compare
+@ %def aloop_free
 
-<<local constants, defines and prototypes>>=
-#ifdef QSORT
-static int i_compare(const void*, const void*) ;
-static int s_compare(const void*, const void*) ;
-#endif
+Function [[aloop_free_keys(al)]] frees the vector of keys of [[al]].
 
-<<interface functions>>=
-void aloop_free(ALoop* al)
+<<local functions>>=
+static void aloop_free_keys(ALoop* al)
 {
+    if (al->size == 0) return ;
     if (al->type == AY_INT) {
         zfree(al->ptr.ival, sizeof(int64_t) * al->size) ;
     }
-    else if (al->type == AY_STR) {
+    else if (al->type == AY_STR || al->type == AY_SPILL) {
         unsigned i ;
 	for(i=0; i < al->size; i++) {
 	    free_STRING(al->ptr.sval[i]) ;
 	}
         zfree(al->ptr.sval, sizeof(STRING*) * al->size) ;
     }
-    zfree(al, sizeof(ALoop)) ;
+    al->size = 0 ;
 }
-@ %def aloop_free
+@ %def aloop_free_keys
 
-How the loop is indexed depends on the type.
+How the loop is indexed depends on the type and on whether
+the loop is in place.
 
 <<interface functions>>=
 int aloop_next(ALoop* al)
 {
-    if (al->next >= al->size) return 0 ;
-    cell_destroy(al->cp) ;
-    switch(al->type) {
-        case AY_SPLIT:
-	    al->cp->type = C_DOUBLE ;
-	    al->cp->dval = (double) (al->next+1) ;
-	    break ;
-	case AY_INT:
+    if (al->A) {
+        <<in place, set [[i]] to the next index of [[A]] or return [[0]]>>
+    }
+    else {
+	if (al->next >= al->size) return 0 ;
+	cell_destroy(al->cp) ;
+	if (al->type == AY_INT) {
 	    al->cp->type = C_DOUBLE ;
 	    al->cp->dval = (double) al->ptr.ival[al->next] ;
-	    break ;
-	case AY_STR:
+	}
+	else {
 	    al->cp->type = C_STRING ;
 	    al->cp->ptr = STRING_dup(al->ptr.sval[al->next]) ;
-	    break ;
+	}
+	al->next++ ;
     }
-    al->next++ ;
     return 1 ;
 }
 @ %def aloop_next
 
+<<in place, set [[i]] to the next index of [[A]] or return [[0]]>>=
+if (al->type == AY_SPLIT) {
+    if (al->next >= al->A->size) return 0 ;
+    cell_destroy(al->cp) ;
+    al->cp->type = C_DOUBLE ;
+    al->cp->dval = (double) al->next + al->origin ;
+    al->next++ ;
+}
+else if (al->type == AY_SPILL) {
+    <<set [[i]] to the next index of spilled [[A]] or return [[0]]>>
+}
+else {
+    ITable* ht = (ITable*)al->A->ptr ;
+    HNODE* p ;
+    do {
+        if (al->next >= ht->used) return 0 ;
+	p = dvec_node(ht->nodes, al->next++) ;
+    } while(p->cell.type == NODE_FREE) ;
+    cell_destroy(al->cp) ;
+    if (al->type == AY_INT) {
+	al->cp->type = C_DOUBLE ;
+	al->cp->dval = (double) p->key.ival ;
+    }
+    else {
+	al->cp->type = C_STRING ;
+	al->cp->ptr = (PTR) node_key(p) ;
+    }
+}
+
+@
+Function [[aloop_snapshot(A)]] turns each in place loop on [[A]] into
+a loop over a vector of the keys the loop has still to visit.  It is
+called before the structure of [[A]] changes.
+A loop with nothing left to visit gets type [[AY_NULL]] and
+no vector.
+For an [[AY_SPILL]] array the keys still to visit are those left in
+the vector of the partition being walked, and all the keys of the
+partitions after it, which are read in to get them.
+
+<<local functions>>=
+static void aloop_snapshot(ARRAY A)
+{
+    ALoop* al = A->loops ;
+    while(al) {
+	ALoop* hold = al->alink ;
+	unsigned cnt = 0 ;
+	unsigned i ;
+	if (al->type == AY_SPLIT) {
+	    if (al->next < A->size) cnt = A->size - al->next ;
+	    if (cnt > 0) {
+		al->ptr.ival = (int64_t*)zmalloc(sizeof(int64_t) * cnt) ;
+		for(i = 0; i < cnt; i++) {
+		    al->ptr.ival[i] = (int64_t) (al->next + i) + al->origin ;
+		}
+	    }
+	    al->type = AY_INT ;
+	}
+	else if (al->type == AY_SPILL) {
+	    <<copy the keys a loop on spilled [[A]] has still to visit>>
+	}
+	else {
+	    <<copy the keys of the nodes from [[al->next]] on>>
+	}
+	if (cnt == 0) al->type = AY_NULL ;
+	al->size = cnt ;
+	al->next = 0 ;
+	al->A = 0 ;
+	al->alink = 0 ;
+	al = hold ;
+    }
+    A->loops = 0 ;
+}
+@ %def aloop_snapshot
+
+The nodes are walked twice, once to count them.
+
+<<copy the keys of the nodes from [[al->next]] on>>=
+{
+    ITable* ht = (ITable*)A->ptr ;
+    size_t j ;
+    for(j = al->next; j < ht->used; j++) {
+	if (dvec_node(ht->nodes, j)->cell.type != NODE_FREE) cnt++ ;
+    }
+    if (cnt > 0) {
+	if (al->type == AY_INT) {
+	    al->ptr.ival = (int64_t*)zmalloc(sizeof(int64_t) * cnt) ;
+	}
+	else {
+	    al->ptr.sval = (STRING**)zmalloc(sizeof(STRING*) * cnt) ;
+	}
+    }
+    i = 0 ;
+    for(j = al->next; j < ht->used; j++) {
+	HNODE* p = dvec_node(ht->nodes, j) ;
+	if (p->cell.type == NODE_FREE) continue ;
+	if (al->type == AY_INT) al->ptr.ival[i++] = p->key.ival ;
+	else al->ptr.sval[i++] = node_key(p) ;
+    }
+}
+
+@
+The keys in the vector of the partition that have been deleted are
+dropped, like the free nodes above.
+
+<<copy the keys a loop on spilled [[A]] has still to visit>>=
+{
+    Spill* S = (Spill*)A->ptr ;
+    STRING** keys ;
+    unsigned k ;
+    size_t j ;
+    for(j = al->next; j < al->size; j++) {
+	if (spill_find(S, al->ptr.sval[j], NO_CREATE, &A->size)) cnt++ ;
+    }
+    for(k = al->part; k < S->nparts; k++) {
+	SpillPart* p = S->parts + k ;
+	cnt += p->ht ? p->ht->size : p->cnt ;
+    }
+    keys = cnt > 0 ? (STRING**)zmalloc(sizeof(STRING*) * cnt) : 0 ;
+    i = 0 ;
+    for(j = al->next; j < al->size; j++) {
+	STRING* sval = al->ptr.sval[j] ;
+	if (spill_find(S, sval, NO_CREATE, &A->size)) {
+	    keys[i++] = sval ;
+	    al->ptr.sval[j] = 0 ;
+	}
+    }
+    for(k = al->part; k < S->nparts; k++) {
+	ITable* ht = spill_table(S, k) ;
+	for(j = 0; j < ht->used; j++) {
+	    HNODE* p = dvec_node(ht->nodes, j) ;
+	    if (p->cell.type != NODE_FREE) keys[i++] = node_key(p) ;
+	}
+    }
+    for(j = 0; j < al->size; j++) {
+	if (al->ptr.sval[j]) free_STRING(al->ptr.sval[j]) ;
+    }
+    if (al->size > 0) zfree(al->ptr.sval, sizeof(STRING*) * al->size) ;
+    al->ptr.sval = keys ;
+    al->type = AY_STR ;
+}
+
+<<local constants, defines and prototypes>>=
+static void aloop_free_keys(ALoop*) ;
+static void aloop_snapshot(ARRAY) ;
 
 <<interface prototypes>>=
 ALoop* make_aloop(ARRAY, CELL*) ;
@@ -603,433 +1008,2067 @@ void aloop_free(ALoop*) ;
 int aloop_next(ALoop*) ;
 
 
-@ 
-\subsection{Concatenating Array Indices}
-In [[AWK]], an array expression [[A[i,j]]] is equivalent to the
-expression [[A[i SUBSEP j]]], i.e., the index is the
-concatenation of the three
-elements [[i]], [[SUBSEP]] and [[j]].  This is performed by the
-function [[array_cat]].  On entry, [[sp]] points at the top of a
-stack of [[CELLs]].
-[[Cnt]] cells are popped off the stack and concatenated together
-separated by [[SUBSEP]] and the result is pushed back on the stack.
-On entry, the first multi-index is in [[sp[1-cnt]]] and the last is
-in [[sp[0]]].  The return value is the new stack top.
-(The stack is the run-time evaluation stack.
-This operation really has nothing to do with array structure, so
-logically this code belongs in [[execute.c]], but remains here for
-historical reasons.)
+@
+\subsection{Sorted Array Loops}
+A program picks the order of its [[for(i in A)]] loops at run time
+by assigning to [[PROCINFO["sorted_in"]]] one of the
+names,
+\list
+\item{} [["@unsorted"]], the default, walks [[A]] in place,
+\item{} [["@ind_num_asc"]] and [["@ind_num_desc"]], indices compared
+as numbers,
+\item{} [["@ind_str_asc"]] and [["@ind_str_desc"]], indices compared
+as strings,
+\item{} [["@val_num_asc"]] and [["@val_num_desc"]], values compared
+as numbers,
+\item{} [["@val_str_asc"]] and [["@val_str_desc"]], values compared
+as strings,
+\item{} [["@val_type_asc"]] and [["@val_type_desc"]], values compared
+as numbers if they are numbers and as strings if they are strings,
+with the numbers before the strings.
+\endlist
+\noindent
+These are the names [[gawk]] uses.  The order is read when the loop
+starts, so each loop can have its own.
+[[array_order(name)]] returns the order with [[name]], or [[-1]] if
+there is none.
 
+<<array typedefs and [[#defines]]>>=
+#define AL_UNSORTED  0
+#define AL_IND_NUM   1
+#define AL_IND_STR   2
+#define AL_VAL_NUM   3
+#define AL_VAL_STR   4
+#define AL_VAL_TYPE  5
+#define AL_DESC      8  /* or'ed with one of the above */
+@ %def AL_UNSORTED AL_IND_NUM AL_IND_STR AL_VAL_NUM AL_VAL_STR AL_VAL_TYPE AL_DESC
 
 <<interface functions>>=
-CELL *array_cat(
-   CELL *sp,
-   int cnt)
+int array_order(const char* name)
 {
-   CELL *p ;  /* walks the eval stack */
-   CELL subsep ;  /* local copy of SUBSEP */
-   <<subsep parts>>
-   size_t total_len ;  /* length of cat'ed expression */
-   CELL *top ;   /* value of sp at entry */
-   char *target ;  /* build cat'ed char* here */
-   STRING *sval ;  /* build cat'ed STRING here */
-   <<get subsep and compute parts>>
-   <<set [[top]] and return value of [[sp]]>>
-   <<cast cells to string and compute [[total_len]]>>
-   <<build the cat'ed [[STRING]] in [[sval]]>>
-   <<cleanup, set [[sp]] and return>>
+    static const struct {
+        const char* name ;
+	int order ;
+    } orders[] = {
+	{ "@unsorted", AL_UNSORTED },
+	{ "@ind_num_asc", AL_IND_NUM },
+	{ "@ind_num_desc", AL_IND_NUM | AL_DESC },
+	{ "@ind_str_asc", AL_IND_STR },
+	{ "@ind_str_desc", AL_IND_STR | AL_DESC },
+	{ "@val_num_asc", AL_VAL_NUM },
+	{ "@val_num_desc", AL_VAL_NUM | AL_DESC },
+	{ "@val_str_asc", AL_VAL_STR },
+	{ "@val_str_desc", AL_VAL_STR | AL_DESC },
+	{ "@val_type_asc", AL_VAL_TYPE },
+	{ "@val_type_desc", AL_VAL_TYPE | AL_DESC },
+	{ 0, 0 }
+    } ;
+    int i ;
+    for(i = 0; orders[i].name; i++) {
+        if (strcmp(name, orders[i].name) == 0) return orders[i].order ;
+    }
+    return -1 ;
 }
-@ %def array_cat
+@ %def array_order
 
 @
-We make a copy of [[SUBSEP]] which we can cast to string in the
-unlikely event the user has assigned a number to [[SUBSEP]].
+[[procinfo]] is [[PROCINFO]], or zero if the program does not
+use it.
 
-<<subsep parts>>=
-size_t subsep_len ; /* string length of subsep_str */
-char *subsep_str ;
-
-<<get subsep and compute parts>>=
+<<local functions>>=
+static int aloop_order(void)
 {
-    cellcpy(&subsep, SUBSEP) ;
-    if ( subsep.type < C_STRING ) cast1_to_s(&subsep) ;
-    subsep_len = string(&subsep)->len ;
-    subsep_str = string(&subsep)->str ;
+    static STRING* sorted_in ;
+    CELL key ;
+    CELL* cp ;
+    int order ;
+    if (procinfo == 0) return AL_UNSORTED ;
+    if (sorted_in == 0) sorted_in = new_STRING("sorted_in") ;
+    key.type = C_STRING ;
+    key.ptr = (PTR) sorted_in ;
+    cp = array_find(procinfo, &key, NO_CREATE) ;
+    if (cp == 0 || cp->type == C_NOINIT) return AL_UNSORTED ;
+    cellcpy(&key, cp) ;
+    cast1_to_s(&key) ;
+    if ((order = array_order(string(&key)->str)) < 0) {
+        rt_error("unknown order PROCINFO[\"sorted_in\"] = \"%s\"",
+	         string(&key)->str) ;
+    }
+    free_STRING(string(&key)) ;
+    return order ;
 }
+@ %def aloop_order
 
 @
-Set [[sp]] and [[top]] so the cells to concatenate are inclusively
-between [[sp]] and [[top]].
+A sorted loop is a loop over a vector like a snapshot.
+The elements of [[A]] are first copied to a vector of [[SortItem]]s,
+each holding an index, or a pointer to the value for [[asort()]],
+and the key the element is sorted on.
+A key compared as a number is
+a [[uint64_t]] that orders as the number does, so numbers are
+sorted with a radix sort.  A key compared as a string is a
+[[STRING*]], and strings are sorted with a multikey quicksort.
+Both look at the keys a byte at a time, which suits the
+cache better than [[qsort()]] calling a compare function.
 
-<<set [[top]] and return value of [[sp]]>>=
+<<local constants, defines and prototypes>>=
+typedef struct sort_item {
+    union {
+        uint64_t u ;
+	STRING* s ;
+    } sk ;  /* sort key */
+    union {
+        int64_t ival ;
+	STRING* sval ;
+	CELL* cp ;
+    } key ;  /* the index, or the value */
+} SortItem ;
+@ %def SortItem
+
+<<local functions>>=
+static void aloop_sort(ALoop* al, ARRAY A, int order)
 {
-    top = sp ; 
-    sp -= (cnt-1) ;
+    SortItem* items = (SortItem*)zmalloc(sizeof(SortItem) * A->size) ;
+    size_t n = A->size ;
+    size_t i ;
+    sort_items(items, A, order, 0) ;
+    <<move the indices in [[items]] to [[al]]>>
+    zfree(items, sizeof(SortItem) * n) ;
 }
+@ %def aloop_sort
 
 @
-The [[total_len]] is the sum of the lengths of the [[cnt]]
-strings and the [[cnt-1]] copies of [[subsep]].
-
-<<cast cells to string and compute [[total_len]]>>=
-total_len = ((size_t) (cnt-1)) * subsep_len ;
-for(p = sp ; p <= top ; p++) {
-   if ( p->type < C_STRING ) cast1_to_s(p) ;
-   total_len += string(p)->len ;
+The [[STRING]]s of string indices that [[sort_items()]] made go
+to the loop.
+
+<<move the indices in [[items]] to [[al]]>>=
+al->size = n ;
+if (A->type == AY_STR || A->type == AY_SPILL) {
+    al->type = AY_STR ;
+    al->ptr.sval = (STRING**)zmalloc(sizeof(STRING*) * n) ;
+    for(i = 0; i < n; i++) al->ptr.sval[i] = items[i].key.sval ;
 }
-
-<<build the cat'ed [[STRING]] in [[sval]]>>=
-sval = new_STRING0(total_len) ;
-target = sval->str ;
-for(p = sp ; p < top ; p++) {
-   memcpy(target, string(p)->str, string(p)->len) ;
-   target += string(p)->len ;
-   memcpy(target, subsep_str, subsep_len) ;
-   target += subsep_len ;
+else {
+    al->type = AY_INT ;
+    al->ptr.ival = (int64_t*)zmalloc(sizeof(int64_t) * n) ;
+    for(i = 0; i < n; i++) al->ptr.ival[i] = items[i].key.ival ;
 }
-/* now p == top */
-memcpy(target, string(p)->str, string(p)->len) ;
-
-@
-The return value is [[sp]] and it is already set correctly.  We
-just need to free the strings and set the contents of [[sp]].
-
-<<cleanup, set [[sp]] and return>>=
-for(p = sp; p <= top ; p++) free_STRING(string(p)) ;
-free_STRING(string(&subsep)) ;
-/* set contents of sp , sp->type > C_STRING is possible so reset */
-sp->type = C_STRING ;
-sp->ptr = (PTR) sval ;
-return sp ;
 
 @
-\section{Hash Table}
-Up to this point, the internal tables ([[ITable]]) have only
-provided a functional interface. Here is the implementation; 
-it is a hash table.  A different design such as red-black tree
-could be used to provide the same interface.
+Function [[sort_items(items,A,order,values)]] puts the elements of
+[[A]] in [[items[0..A->size-1]]] sorted by [[order]].  If [[values]]
+is set, each [[key]] is a pointer to the value, else the index,
+which for a string index is a new [[STRING]] the caller owns.
+The elements with a numeric sort key go at the front, and those with
+a string sort key at the back.
+All the partitions of an [[AY_SPILL]] array are read into memory.
+Descending by number complements the keys, which keeps the radix sort
+stable; otherwise descending reverses the ascending order.
 
-The hash table design was influenced by 
-and is similar to
-the design presented in Griswold and Townsend,
-{\sl The Design and Implementation of
-Dynamic Hashing Sets and Tables in Icon},
-{\bf Software Practice and Experience}, 23, 351-367, 1993.
+<<local functions>>=
+static void sort_items(SortItem* items, ARRAY A, int order, int values)
+{
+    int how = order & ~AL_DESC ;
+    int desc = (order & AL_DESC) != 0 ;
+    int str_keys = A->type == AY_STR || A->type == AY_SPILL ;
+    size_t n = A->size ;
+    size_t front = 0 ;
+    size_t back = n ;
+    size_t i ;
+    SortItem t ;
+
+    <<put the elements of [[A]] in [[items]]>>
+    if (desc && (how == AL_IND_NUM || how == AL_VAL_NUM)) {
+	for(i = 0; i < front; i++) items[i].sk.u = ~items[i].sk.u ;
+	desc = 0 ;
+    }
+    radix_sort(items, front) ;
+    sort_by_string(items + front, n - front, 0) ;
+    for(i = front; i < n; i++) free_STRING(items[i].sk.s) ;
+    if (desc) {
+	for(i = 0; i < n/2; i++) {
+	    t = items[i] ;
+	    items[i] = items[n-1-i] ;
+	    items[n-1-i] = t ;
+	}
+    }
+}
+@ %def sort_items
+
+<<put the elements of [[A]] in [[items]]>>=
+if (A->type == AY_SPLIT) {
+    DVEC* dv = (DVEC*)A->ptr ;
+    for(i = 0; i < n; i++) {
+	CELL* cp = dvec_cell(dv, i) ;
+	int64_t ival = (int64_t) i + dv->origin ;
+	if (values) t.key.cp = cp ;
+	else t.key.ival = ival ;
+	if (sort_item_key(&t, how, 0, ival, cp)) items[front++] = t ;
+	else items[--back] = t ;
+    }
+}
+else {
+    Spill* S = A->type == AY_SPILL ? (Spill*)A->ptr : 0 ;
+    unsigned k ;
+    for(k = 0; k < (S ? S->nparts : 1); k++) {
+	ITable* ht = S ? spill_table(S, k) : (ITable*)A->ptr ;
+	for(i = 0; i < ht->used; i++) {
+	    HNODE* p = dvec_node(ht->nodes, i) ;
+	    STRING* sval = 0 ;
+	    int64_t ival = 0 ;
+	    if (p->cell.type == NODE_FREE) continue ;
+	    if (str_keys) sval = node_key(p) ;
+	    else ival = p->key.ival ;
+	    if (values) t.key.cp = &p->cell ;
+	    else if (str_keys) t.key.sval = sval ;
+	    else t.key.ival = ival ;
+	    if (sort_item_key(&t, how, sval, ival, &p->cell)) {
+		items[front++] = t ;
+	    }
+	    else items[--back] = t ;
+	    if (values && sval) free_STRING(sval) ;
+	}
+    }
+}
+/* the back was filled from the end */
+for(i = 0; i < (n - back)/2; i++) {
+    t = items[back+i] ;
+    items[back+i] = items[n-1-i] ;
+    items[n-1-i] = t ;
+}
 
 @
-\subsection{Data Structure}
-Each element of the table is an [[HNODE]].  If the keys
-are integer ([[AY_INT]]), then the key is [[ival]].
-If the keys are [[STRING*]] ([[AY_STR]]), then the key
-is [[key]].  Note that an [[ITable]] holds no information
-about array type.
+Function [[sort_item_key(p,how,sval,ival,cp)]] sets the sort key of
+[[*p]] from the index, [[sval]] or [[ival]], or from the value
+[[*cp]], and returns [[1]] if the key is a number or [[0]] if it is a
+string, which is a new [[STRING]].
+A number maps to a [[uint64_t]] by flipping the sign bit if it is
+positive and all the bits if it is negative.
+An integer is a [[double]] here too, as an index compared as a
+number can be a string.
+
+<<local functions>>=
+static uint64_t double_sort_key(double d)
+{
+    uint64_t u ;
+    memcpy(&u, &d, sizeof(u)) ;
+    return (u >> 63) ? ~u : u | ((uint64_t)1 << 63) ;
+}
+
+static int sort_item_key(SortItem* p, int how, STRING* sval,
+                         int64_t ival, CELL* cp)
+{
+    CELL c ;
+    switch(how) {
+        case AL_IND_NUM:
+	    if (sval) {
+		c.type = C_STRING ;
+		c.ptr = (PTR) STRING_dup(sval) ;
+		cast1_to_d(&c) ;
+		p->sk.u = double_sort_key(c.dval) ;
+	    }
+	    else {
+	        p->sk.u = double_sort_key((double) ival) ;
+	    }
+	    return 1 ;
+	case AL_IND_STR:
+	    if (sval) {
+	        p->sk.s = STRING_dup(sval) ;
+	    }
+	    else {
+		char buffer[64] ;
+		sprintf(buffer, LDFMT, ival) ;
+		p->sk.s = new_STRING(buffer) ;
+	    }
+	    return 0 ;
+	case AL_VAL_NUM:
+	    cellcpy(&c, cp) ;
+	    cast1_to_d(&c) ;
+	    p->sk.u = double_sort_key(c.dval) ;
+	    return 1 ;
+	case AL_VAL_TYPE:
+	    cellcpy(&c, cp) ;
+	    if (c.type == C_MBSTRN) check_strnum(&c) ;
+	    if (c.type < C_STRING || c.type == C_STRNUM) {
+		cast1_to_d(&c) ;
+		p->sk.u = double_sort_key(c.dval) ;
+		return 1 ;
+	    }
+	    p->sk.s = string(&c) ;
+	    return 0 ;
+	default: /* AL_VAL_STR */
+	    cellcpy(&c, cp) ;
+	    cast1_to_s(&c) ;
+	    p->sk.s = string(&c) ;
+	    return 0 ;
+    }
+}
+@ %def double_sort_key sort_item_key
+
+@
+The radix sort is least significant byte first, so it is stable.
+A byte that is the same in every key is skipped, which for
+small integers skips most of the passes.
+
+<<local functions>>=
+static void radix_sort(SortItem* a, size_t n)
+{
+    SortItem* tmp ;
+    SortItem* from = a ;
+    SortItem* to ;
+    size_t count[8][256] ;
+    size_t i ;
+    int k ;
+    if (n < 2) return ;
+    memset(count, 0, sizeof(count)) ;
+    for(i = 0; i < n; i++) {
+        uint64_t u = a[i].sk.u ;
+	for(k = 0; k < 8; k++) count[k][(u >> 8*k) & 0xff]++ ;
+    }
+    tmp = (SortItem*)zmalloc(sizeof(SortItem) * n) ;
+    to = tmp ;
+    for(k = 0; k < 8; k++) {
+        size_t* c = count[k] ;
+	size_t sum = 0 ;
+	int j ;
+	if (c[(from[0].sk.u >> 8*k) & 0xff] == n) continue ;
+	for(j = 0; j < 256; j++) {
+	    size_t t = c[j] ;
+	    c[j] = sum ;
+	    sum += t ;
+	}
+	for(i = 0; i < n; i++) {
+	    to[c[(from[i].sk.u >> 8*k) & 0xff]++] = from[i] ;
+	}
+	to = from ;
+	from = from == a ? tmp : a ;
+    }
+    if (from != a) memcpy(a, from, sizeof(SortItem) * n) ;
+    zfree(tmp, sizeof(SortItem) * n) ;
+}
+@ %def radix_sort
+
+@
+The multikey quicksort of Bentley and Sedgewick partitions
+[[a[0..n-1]]] three ways on the byte at [[depth]] of a pivot.  All
+the strings have the same first [[depth]] bytes.  The middle part
+goes on to the next byte, unless the pivot has ended, when the
+strings in it are equal.  Short runs use an insertion sort.
+
+<<local functions>>=
+static int sk_byte(const SortItem* p, size_t depth)
+{
+    const STRING* s = p->sk.s ;
+    return depth < s->len ? (unsigned char) s->str[depth] : -1 ;
+}
+
+static int sk_compare(const SortItem* p, const SortItem* q, size_t depth)
+{
+    const STRING* s = p->sk.s ;
+    const STRING* t = q->sk.s ;
+    size_t len = s->len < t->len ? s->len : t->len ;
+    int ret = memcmp(s->str + depth, t->str + depth, len - depth) ;
+    if (ret == 0) ret = s->len < t->len ? -1 : s->len > t->len ;
+    return ret ;
+}
+
+static void sort_by_string(SortItem* a, size_t n, size_t depth)
+{
+    while(n > 1) {
+        size_t lt, gt, i ;
+	int v ;
+	SortItem t ;
+        if (n < 16) {
+	    for(i = 1; i < n; i++) {
+	        size_t j = i ;
+		t = a[i] ;
+		while(j > 0 && sk_compare(&t, a+j-1, depth) < 0) {
+		    a[j] = a[j-1] ;
+		    j-- ;
+		}
+		a[j] = t ;
+	    }
+	    return ;
+	}
+	/* pivot is the median of three */
+	{
+	    int x = sk_byte(a, depth) ;
+	    int y = sk_byte(a + n/2, depth) ;
+	    int z = sk_byte(a + n-1, depth) ;
+	    size_t m = (x < y) ? (y < z ? n/2 : x < z ? n-1 : 0)
+	                       : (x < z ? 0 : y < z ? n-1 : n/2) ;
+	    t = a[0] ; a[0] = a[m] ; a[m] = t ;
+	}
+	v = sk_byte(a, depth) ;
+	lt = 0 ;
+	gt = n ;
+	i = 1 ;
+	while(i < gt) {
+	    int c = sk_byte(a+i, depth) ;
+	    if (c < v) {
+	        t = a[lt] ; a[lt++] = a[i] ; a[i++] = t ;
+	    }
+	    else if (c > v) {
+	        t = a[--gt] ; a[gt] = a[i] ; a[i] = t ;
+	    }
+	    else i++ ;
+	}
+	sort_by_string(a, lt, depth) ;
+	sort_by_string(a+gt, n-gt, depth) ;
+	if (v < 0) return ;
+	a += lt ;
+	n = gt - lt ;
+	depth++ ;
+    }
+}
+@ %def sk_byte sk_compare sort_by_string
+
+<<local constants, defines and prototypes>>=
+static int aloop_order(void) ;
+static void aloop_sort(ALoop*, ARRAY, int) ;
+static void sort_items(SortItem*, ARRAY, int, int) ;
+static uint64_t double_sort_key(double) ;
+static int sort_item_key(SortItem*, int, STRING*, int64_t, CELL*) ;
+static void radix_sort(SortItem*, size_t) ;
+static int sk_byte(const SortItem*, size_t) ;
+static int sk_compare(const SortItem*, const SortItem*, size_t) ;
+static void sort_by_string(SortItem*, size_t, size_t) ;
 
-The fields are,
-\I[[link]] connects [[HNODE]]s into buckets of singly linked list.
-\I[[key]]  the node is keyed on [[STRING*]] value if [[key]] is not zero.
-\I[[ival]] if [[key]] is zero, the node is keyed on this integer value.
-\I[[cell]] the value looked up by either [[key]] or [[ival]].
+@
+\subsection{Sorting an Array}
+The built-in functions [[asort()]] and [[asorti()]] call
+[[array_sort(A,D,order,indices)]], which makes [[D]] a dense
+[[AY_SPLIT]] array with [[D[1..n]]] the values of [[A]], or with
+[[indices]] set the indices of [[A]], in [[order]], and
+returns [[n]], the number of elements in [[A]].
+[[D]] can be [[A]], and then the values are moved instead of copied.
+An [[AY_MAPPED]] array [[A]] is first made an [[AY_STR]] array.
+
+<<interface functions>>=
+size_t array_sort(ARRAY A, ARRAY D, int order, int indices)
+{
+    size_t n = A->size ;
+    SortItem* items ;
+    DVEC* dv ;
+    size_t i ;
+    if (n == 0) {
+        array_clear(D) ;
+	return 0 ;
+    }
+    if (A->type == AY_MAPPED) map_to_str(A) ;
+    items = (SortItem*)zmalloc(sizeof(SortItem) * n) ;
+    sort_items(items, A, order, !indices) ;
+    dv = new_dvec(n, 1) ;
+    for(i = 0; i < n; i++) {
+        CELL* cp = dvec_cell(dv, i) ;
+	if (!indices) {
+	    CELL* vp = items[i].key.cp ;
+	    if (D == A) {
+	        *cp = *vp ;
+		vp->type = C_NOINIT ;
+	    }
+	    else cellcpy(cp, vp) ;
+	}
+	else if (A->type == AY_STR || A->type == AY_SPILL) {
+	    cp->type = C_STRING ;
+	    cp->ptr = (PTR) items[i].key.sval ;
+	}
+	else {
+	    cp->type = C_DOUBLE ;
+	    cp->dval = (double) items[i].key.ival ;
+	}
+    }
+    zfree(items, sizeof(SortItem) * n) ;
+    array_clear(D) ;
+    D->ptr = dv ;
+    D->type = AY_SPLIT ;
+    D->size = n ;
+    return n ;
+}
+@ %def array_sort
+
+<<interface prototypes>>=
+int array_order(const char*) ;
+size_t array_sort(ARRAY, ARRAY, int, int) ;
+
+@ 
+\subsection{Concatenating Array Indices}
+In [[AWK]], an array expression [[A[i,j]]] is equivalent to the
+expression [[A[i SUBSEP j]]], i.e., the index is the
+concatenation of the three
+elements [[i]], [[SUBSEP]] and [[j]].  This is performed by the
+function [[array_cat]].  On entry, [[sp]] points at the top of a
+stack of [[CELLs]].
+[[Cnt]] cells are popped off the stack and concatenated together
+separated by [[SUBSEP]] and the result is pushed back on the stack.
+On entry, the first multi-index is in [[sp[1-cnt]]] and the last is
+in [[sp[0]]].  The return value is the new stack top.
+(The stack is the run-time evaluation stack.
+This operation really has nothing to do with array structure, so
+logically this code belongs in [[execute.c]], but remains here for
+historical reasons.)
+
+Since [[A[i,j]]] and [[A[i SUBSEP j]]] are the same element, the
+key has to be the concatenated string.  But the parts need not
+be made into [[STRING]]s first: the key is built in one pass in
+a buffer that is kept between calls, and is copied once into
+the result.
+
+<<interface functions>>=
+CELL *array_cat(
+   CELL *sp,
+   int cnt)
+{
+   CELL *p ;  /* walks the eval stack */
+   CELL subsep ;  /* local copy of SUBSEP */
+   <<subsep parts>>
+   size_t total_len ;  /* length of cat'ed expression */
+   CELL *top ;   /* value of sp at entry */
+   STRING *sval ;  /* build cat'ed STRING here */
+   <<get subsep and compute parts>>
+   <<set [[top]] and return value of [[sp]]>>
+   <<build the cat'ed expression in [[cat_buff]]>>
+   sval = new_STRING2(cat_buff, total_len) ;
+   <<cleanup, set [[sp]] and return>>
+}
+@ %def array_cat
+
+@
+We make a copy of [[SUBSEP]] which we can cast to string in the
+unlikely event the user has assigned a number to [[SUBSEP]].
+
+<<subsep parts>>=
+size_t subsep_len ; /* string length of subsep_str */
+char *subsep_str ;
+
+<<get subsep and compute parts>>=
+{
+    cellcpy(&subsep, SUBSEP) ;
+    if ( subsep.type < C_STRING ) cast1_to_s(&subsep) ;
+    subsep_len = string(&subsep)->len ;
+    subsep_str = string(&subsep)->str ;
+}
+
+@
+Set [[sp]] and [[top]] so the cells to concatenate are inclusively
+between [[sp]] and [[top]].
+
+<<set [[top]] and return value of [[sp]]>>=
+{
+    top = sp ; 
+    sp -= (cnt-1) ;
+}
+
+@
+A part with an integer value, the common case for a subscript such
+as [[A[i,j]]], is written into the buffer directly by [[int_key()]]
+which gives the same digits as [[cast1_to_s()]].
+Any other part is cast to string and copied.
+Buffer [[cat_buff]] holds [[cat_size]] bytes and grows as needed.
+
+<<local constants, defines and prototypes>>=
+static char* cat_buff ;
+static size_t cat_size ;
+static size_t int_key(char*, int64_t) ;
+static void cat_reserve(size_t) ;
+
+<<build the cat'ed expression in [[cat_buff]]>>=
+total_len = 0 ;
+for(p = sp ; p <= top ; p++) {
+   if (p->type == C_DOUBLE && is_int_double(p->dval)) {
+      cat_reserve(total_len + 24 + subsep_len) ;
+      total_len += int_key(cat_buff + total_len, (int64_t) p->dval) ;
+   }
+   else {
+      if ( p->type < C_STRING ) cast1_to_s(p) ;
+      cat_reserve(total_len + string(p)->len + subsep_len) ;
+      memcpy(cat_buff + total_len, string(p)->str, string(p)->len) ;
+      total_len += string(p)->len ;
+   }
+   if (p < top) {
+      memcpy(cat_buff + total_len, subsep_str, subsep_len) ;
+      total_len += subsep_len ;
+   }
+}
+
+<<local functions>>=
+static void cat_reserve(size_t len)
+{
+    if (len > cat_size) {
+        size_t new_size = 2 * len ;
+	if (cat_buff) {
+	    cat_buff = (char*)zrealloc(cat_buff, cat_size, new_size) ;
+	}
+	else {
+	    cat_buff = (char*)zmalloc(new_size) ;
+	}
+	cat_size = new_size ;
+    }
+}
+
+static size_t int_key(char* target, int64_t ival)
+{
+    char digits[24] ;
+    char* q = digits + sizeof(digits) ;
+    uint64_t u = ival < 0 ? -(uint64_t)ival : (uint64_t)ival ;
+    size_t len ;
+    do {
+        *--q = (char)('0' + u % 10) ;
+	u /= 10 ;
+    } while(u) ;
+    if (ival < 0) *--q = '-' ;
+    len = (size_t)(digits + sizeof(digits) - q) ;
+    memcpy(target, q, len) ;
+    return len ;
+}
+@ %def cat_buff cat_size cat_reserve int_key
+
+@
+The return value is [[sp]] and it is already set correctly.  We
+just need to free the strings and set the contents of [[sp]].
+
+<<cleanup, set [[sp]] and return>>=
+for(p = sp; p <= top ; p++) cell_destroy(p) ;
+free_STRING(string(&subsep)) ;
+/* set contents of sp , sp->type > C_STRING is possible so reset */
+sp->type = C_STRING ;
+sp->ptr = (PTR) sval ;
+return sp ;
+
+@
+\section{Hash Table}
+Up to this point, the internal tables ([[ITable]]) have only
+provided a functional interface. Here is the implementation;
+it is a hash table.  A different design such as red-black tree
+could be used to provide the same interface.
+
+The table is open addressed with Robin Hood insertion,
+see Celis, Larson and Munro,
+{\sl Robin Hood Hashing},
+{\bf 26th Annual Symposium on Foundations of Computer Science},
+281-288, 1985.
+The hash values of the keys are kept in one contiguous
+vector of slots, so a probe is a walk over adjacent memory
+and a probe that fails almost never touches an element.
+
+@
+\subsection{Data Structure}
+Each element of the table is an [[HNODE]].  The fields are,
+\I[[key]]  the node is keyed on integer [[key.ival]], or if
+the table has [[str_keys]] set, on the string in [[key.word]].
+\I[[cell]] the value looked up by the key.  In a node that is not in
+use, [[cell.type]] is [[NODE_FREE]].
 \endhitems
 
+The return value of [[itable_find()]] is [[&p->cell]] and the caller
+can hold that address while another element is created, e.g.,
+[[A[i] = A[j]]].  So an [[HNODE]] never moves.  The nodes of a
+table are the elements of a [[DVEC]], which may have been the
+vector of an [[AY_SPLIT]] array, and each node has an index
+in it.
+A deleted node goes on the table's free list, linked by index
+through [[key.ival]].  Note that an [[ITable]] holds no information
+about array type.
+
 <<hash table declarations and data>>=
 typedef struct hnode {
-    struct hnode* link ;
-    int64_t ival ;
-    STRING* key ;
+    union {
+	int64_t ival ;
+	uint64_t word ;
+    } key ;
     CELL cell ;
 } HNODE ;
-@ %def HNODE
+#define NODE_FREE  (-1)
+
+typedef struct hblock {
+    size_t cnt ;  /* number of HNODEs that follow */
+} HBLOCK ;
+#define hblock_nodes(b)  ((HNODE*)((b)+1))
+#define node_hblock(p)   ((HBLOCK*)(p)-1)
+@ %def HNODE NODE_FREE HBLOCK hblock_nodes node_hblock
+
+A string key of up to [[KEY_INLINE]] bytes is kept in the node:
+the low byte of [[key.word]] is twice the length plus one and the
+bytes of the key follow.  A longer key is a [[STRING*]] in
+[[key.word]], shared with the [[STRING]] that made it, and
+because a [[STRING]] is aligned the low bit is zero.
+Most keys in AWK programs are short, e.g., the words of a text
+or numbers up to seven digits, and then a
+key costs no memory beyond the node and compares as one word.
 
-Each bucket of a hash table is a linked list of [[HNODE]]s.
-The number of buckets is always a power of 2.  If the
-number of buckets is [[2^n]], then the [[hmask]] is
-[[2^n-1]].  For [[HNODE* p]], [[p]] is on the linked list
-starting at [[buckets[table->hmask & p->ival]]. 
+<<hash table declarations and data>>=
+#define KEY_INLINE  7
+#define key_is_inline(w)  ((w) & 1)
+#define key_sval(w)  ((STRING*)(uintptr_t)(w))
+@ %def KEY_INLINE key_is_inline key_sval
 
+<<hash table functions>>=
+static uint64_t inline_key(const char* s, size_t len)
+{
+    uint64_t w = (len << 1) | 1 ;
+    size_t i ;
+    for(i = 0; i < len; i++) {
+        w |= (uint64_t)(unsigned char) s[i] << 8*(i+1) ;
+    }
+    return w ;
+}
+
+static uint64_t make_key(STRING* sval)
+{
+    if (sval->len <= KEY_INLINE) return inline_key(sval->str, sval->len) ;
+    return (uint64_t)(uintptr_t) STRING_dup(sval) ;
+}
+
+static STRING* node_key(const HNODE* p)
+{
+    uint64_t w = p->key.word ;
+    if (key_is_inline(w)) {
+        size_t len = (w >> 1) & 0x7f ;
+	STRING* ret = new_STRING0(len) ;
+	size_t i ;
+	for(i = 0; i < len; i++) ret->str[i] = (char)(w >> 8*(i+1)) ;
+	return ret ;
+    }
+    return STRING_dup(key_sval(w)) ;
+}
+
+static void free_key(uint64_t w)
+{
+    if (!key_is_inline(w)) free_STRING(key_sval(w)) ;
+}
+@ %def inline_key make_key node_key free_key
+
+\noindent
+[[make_key(sval)]] returns the key word for [[sval]],
+[[node_key(p)]] returns the string key of node [[*p]] as
+a [[STRING]] the caller owns, and [[free_key(w)]] frees a key word.
+
+Each slot of the table is 8 bytes: [[hfrag]], which is the top 32
+bits of the hash value times [[2^64]] over the golden ratio, and
+[[node]], one more than the index of the node, zero if the slot is
+empty.  If the keys are integer ([[AY_INT]]), then the hash value
+is the key, else it is [[hash64()]] of the string key.
+The multiply spreads runs of integer keys, which are
+common in AWK, e.g., [[A[256*i]]], over the table.
+
+<<hash table declarations and data>>=
+typedef struct hslot {
+    uint32_t hfrag ;
+    uint32_t node ;
+} HSLOT ;
+#define hash_frag(hval) \
+	((uint32_t) (((hval) * 0x9e3779b97f4a7c15ULL) >> 32))
+@ %def HSLOT hash_frag
+
+The number of slots is always a power of 2.  If the
+number of slots is [[2^n]], then the [[hmask]] is
+[[2^n-1]] and [[shift]] is [[32-n]].  The home slot of
+an entry is the top [[n]] bits of [[hfrag]], so the slots are
+doubled without looking at the nodes.  The other bits of [[hfrag]]
+tell most keys apart without looking at the nodes.
+The probe distance of the entry in slot [[i]] is how far [[i]] is
+past its home slot.
+The table grows when it is 3/4 full.
 
 <<hash table declarations and data>>=
-#define INIT_HMASK   255
-#define MAX_AVE_BUCKET_SIZE   4
+#define INIT_HMASK   15
+#define hslot_home(hfrag, shift)  ((unsigned) ((hfrag) >> (shift)))
+#define hslot_dist(ht, i) \
+	(((i) - hslot_home((ht)->slots[i].hfrag, (ht)->shift)) & (ht)->hmask)
+#define itable_node(ht, n)  dvec_node((ht)->nodes, (n)-1)
 struct itable {
     unsigned hmask ;
+    int shift ;
     unsigned size ;
     unsigned limit ;
-    HNODE** buckets ;
+    int str_keys ;  /* keyed on strings */
+    HSLOT* slots ;
+    size_t used ;  /* nodes[0..used-1] have been used */
+    int64_t free_nodes ;  /* one more than the first free node index */
+    DVEC* nodes ;
 } ;
 @ %def itable
 @ %def INIT_HMASK
-@ %def MAX_AVE_BUCKET_SIZE 
+@ %def hslot_home hslot_dist itable_node
 
 <<hash table functions>>=
 static ITable* make_empty_itable()
 {
     ITable* ret = ZMALLOC(ITable) ;
-    ret->hmask = INIT_HMASK ;
     ret->size = 0 ;
-    ret->limit = MAX_AVE_BUCKET_SIZE * (INIT_HMASK+1) ;
-    ret->buckets = make_buckets(INIT_HMASK+1) ;
+    ret->str_keys = 0 ;
+    ret->used = 0 ;
+    ret->free_nodes = 0 ;
+    ret->nodes = new_dvec(DVEC_INIT, 0) ;
+    make_slots(ret, INIT_HMASK) ;
     return ret ;
 }
 @ %def make_empty_itable
 
 <<hash table functions>>=
-static HNODE** make_buckets(unsigned cnt)
+static void make_slots(ITable* ht, unsigned hmask)
 {
-    HNODE** bks = (HNODE**)emalloc(cnt * sizeof(HNODE*)) ;
-    memset(bks, 0, cnt * sizeof(HNODE*)) ;
-    return bks ;
+    unsigned n ;
+    ht->hmask = hmask ;
+    ht->shift = 32 ;
+    for(n = hmask; n; n >>= 1) ht->shift-- ;
+    ht->limit = hmask - (hmask>>2) ;
+    ht->slots = (HSLOT*)zmalloc((hmask+1) * sizeof(HSLOT)) ;
+    memset(ht->slots, 0, (hmask+1) * sizeof(HSLOT)) ;
 }
-@ %def make_buckets
+@ %def make_slots
 
 <<hash table declarations and data>>=
-static HNODE** make_buckets(unsigned) ;
+static void make_slots(ITable*, unsigned) ;
 static ITable* make_empty_itable(void) ;
-    
+static uint64_t inline_key(const char*, size_t) ;
+static uint64_t make_key(STRING*) ;
+static STRING* node_key(const HNODE*) ;
+static void free_key(uint64_t) ;
+
 @
 \subsection{Find, Create and Delete}
+The search starts at the home slot and stops at an empty slot or at
+an entry closer to its own home than the search has come, because
+Robin Hood insertion would have put the key there.
+Only an entry with the same [[hfrag]] is compared with the node.
+A string key that fits in a node is compared as a word.
 
 <<hash table functions>>=
-CELL* itable_find(ITable* htable, STRING* sval, int64_t ival, 
-                  int flag, size_t* szp) 
-{
-    int64_t hash = sval ? hash2(sval->str,sval->len) : ival ;
-    unsigned idx = (unsigned) hash & htable->hmask ;
-    HNODE* q = 0 ;
-    HNODE* p = htable->buckets[idx] ;
-    while(p) {
-        if (hash == p->ival && (!sval || STRING_eq(sval,p->key))) {
-	    /* found */
-	    if (flag == DELETE_) {
-	        <<delete [[p]] and return [[0]]>>
+CELL* itable_find(ITable* htable, STRING* sval, int64_t ival,
+                  int flag, size_t* szp)
+{
+    uint64_t hval = sval ? hash64(sval->str,sval->len) : (uint64_t) ival ;
+    uint32_t hfrag = hash_frag(hval) ;
+    unsigned idx = hslot_home(hfrag, htable->shift) ;
+    unsigned dist = 0 ;
+    HSLOT* slots = htable->slots ;
+    int long_key = sval && sval->len > KEY_INLINE ;
+    uint64_t word = 0 ;
+    if (sval == 0) word = (uint64_t) ival ;
+    else if (!long_key) word = inline_key(sval->str, sval->len) ;
+    while(slots[idx].node && hslot_dist(htable, idx) >= dist) {
+        if (hfrag == slots[idx].hfrag) {
+	    HNODE* p = itable_node(htable, slots[idx].node) ;
+	    if (!long_key ? p->key.word == word
+	                  : !key_is_inline(p->key.word) &&
+		            STRING_eq(sval, key_sval(p->key.word))) {
+		/* found */
+		if (flag == DELETE_) {
+		    <<delete the node in [[slots[idx]]] and return [[0]]>>
+		}
+		return &p->cell ;
 	    }
-	    if (q) {
-	        /* move to front */
-		q->link = p->link ;
-		p->link = htable->buckets[idx] ;
-		htable->buckets[idx] = p ;
-	    }  /* else at front */
-	    return &p->cell ;
 	}
-	q = p ;
-	p = p->link ;
+	idx = (idx+1) & htable->hmask ;
+	dist++ ;
     }
     /* not found */
     if (flag == CREATE) {
-        <<create a new node at [[p]] and insert in [[htable]] at [[buckets[idx]]]>>
+        <<create a new node at [[p]] and insert in [[htable]] at [[slots[idx]]]>>
 	return &p->cell ;
     }
     return 0 ;
 }
 @ %def itable_find
 
-<<delete [[p]] and return [[0]]>>=
+@
+An entry that is further from its home than the one in a slot
+takes that slot, and insertion carries on with the entry it
+displaced.
+
+<<hash table functions>>=
+static void hslot_insert(ITable* ht, HSLOT e, unsigned idx, unsigned dist)
 {
+    HSLOT* slots = ht->slots ;
+    while(slots[idx].node) {
+        unsigned d = hslot_dist(ht, idx) ;
+	if (d < dist) {
+	    HSLOT hold = slots[idx] ;
+	    slots[idx] = e ;
+	    e = hold ;
+	    dist = d ;
+	}
+	idx = (idx+1) & ht->hmask ;
+	dist++ ;
+    }
+    slots[idx] = e ;
+}
+@ %def hslot_insert
+
+<<create a new node at [[p]] and insert in [[htable]] at [[slots[idx]]]>>=
+HSLOT e ;
+HNODE* p = new_hnode(htable, &e.node) ;
+if (sval) {
+    p->key.word = long_key ? make_key(sval) : word ;
+    htable->str_keys = 1 ;
+}
+else {
+    p->key.ival = ival ;
+}
+p->cell.type = C_NOINIT ;
+e.hfrag = hfrag ;
+hslot_insert(htable, e, idx, dist) ;
+htable->size++ ;
+*szp = htable->size ;
+if (htable->size > htable->limit) {
+    double_num_slots(htable) ;
+}
+
+@
+After a deletion, the entries that follow in the probe sequence
+move back one slot, so there are no tombstones.
+
+<<delete the node in [[slots[idx]]] and return [[0]]>>=
+{
+    unsigned next ;
     htable->size-- ;
     *szp = htable->size ;
-    if (q) {
-	q->link = p->link ;
-    }
-    else {
-	htable->buckets[idx] = p->link ;
+    hnode_free(htable, p, slots[idx].node) ;
+    while(next = (idx+1) & htable->hmask,
+          slots[next].node && hslot_dist(htable, next) > 0) {
+	slots[idx] = slots[next] ;
+	idx = next ;
     }
-    hnode_free(p) ;
+    slots[idx].node = 0 ;
     return 0 ;
 }
 
 @
-Function, [[hnode_free(p)]], frees all memory used by [[HNODE]], [[*p]].
-Function, [[htable_free(ht)]], frees all memory used by
+Function, [[new_hblock(cnt)]], allocates an [[HBLOCK]] of [[cnt]]
+nodes and [[hblock_free(b)]] frees one.
+Function, [[new_hnode(ht,np)]], takes a node off the free list of
+[[ITable]], [[*ht]], or else the next unused node, adding a segment to
+[[ht->nodes]] if there is none, and sets [[*np]] to one more than
+its index.
+Function, [[hnode_free(ht,p,n)]], frees the key and value of
+[[HNODE]], [[*p]], and puts it on the free list.
+Function, [[itable_free(ht)]], frees all memory used by
 [[ITable]], [[*ht]].
 
 <<hash table functions>>=
-static void hnode_free(HNODE* p)
+static HBLOCK* new_hblock(size_t cnt)
+{
+    HBLOCK* b = (HBLOCK*)zmalloc(sizeof(HBLOCK) + cnt * sizeof(HNODE)) ;
+    b->cnt = cnt ;
+    return b ;
+}
+
+static void hblock_free(HBLOCK* b)
 {
-    if (p->key) free_STRING(p->key) ;
+    zfree(b, sizeof(HBLOCK) + b->cnt * sizeof(HNODE)) ;
+}
+
+static HNODE* new_hnode(ITable* ht, uint32_t* np)
+{
+    HNODE* p ;
+    if (ht->free_nodes) {
+        *np = (uint32_t) ht->free_nodes ;
+	p = itable_node(ht, *np) ;
+	ht->free_nodes = p->key.ival ;
+	return p ;
+    }
+    if (ht->used == ht->nodes->limit && !dvec_grow(ht->nodes)) {
+	rt_overflow("array size", (unsigned) ht->used) ;
+    }
+    p = dvec_node(ht->nodes, ht->used) ;
+    *np = (uint32_t) ++ht->used ;
+    return p ;
+}
+
+static void hnode_free(ITable* ht, HNODE* p, uint32_t n)
+{
+    if (ht->str_keys) free_key(p->key.word) ;
     cell_destroy(&p->cell) ;
-    zfree(p, sizeof(HNODE)) ;
+    p->cell.type = NODE_FREE ;
+    p->key.ival = ht->free_nodes ;
+    ht->free_nodes = n ;
 }
+
 static void itable_free(ITable* ht)
 {
-    unsigned i ;
-    unsigned size = ht->size ;
-    for(i=0; size > 0; i++) {
-        HNODE* p = ht->buckets[i] ;
-	while(p) {
-	    HNODE* q = p ;
-	    p = p->link ;
-	    hnode_free(q) ;
-	    size-- ;
+    size_t i ;
+    for(i=0; i < ht->used; i++) {
+        HNODE* p = dvec_node(ht->nodes, i) ;
+	if (p->cell.type != NODE_FREE) {
+	    if (ht->str_keys) free_key(p->key.word) ;
+	    cell_destroy(&p->cell) ;
 	}
     }
-    free(ht->buckets) ;
+    dvec_free(ht->nodes) ;
+    zfree(ht->slots, (ht->hmask+1) * sizeof(HSLOT)) ;
     zfree(ht, sizeof(ITable)) ;
 }
+@ %def new_hblock hblock_free
+@ %def new_hnode
 @ %def hnode_free
 @ %def itable_free
 
-<<create a new node at [[p]] and insert in [[htable]] at [[buckets[idx]]]>>=
-{
-    p = ZMALLOC(HNODE) ;
-    p->key = sval ? STRING_dup(sval) : 0 ;
-    p->ival = hash ;
-    p->cell.type = C_NOINIT ;
-    p->link = htable->buckets[idx] ;
-    htable->buckets[idx] = p ;
-    htable->size++ ;
-    *szp = htable->size ;
-    if (htable->size > htable->limit) {
-	double_num_buckets(htable) ;
-    }
-}
-
 <<hash table declarations and data>>=
-static void hnode_free(HNODE*) ;
+static void hslot_insert(ITable*, HSLOT, unsigned, unsigned) ;
+static HBLOCK* new_hblock(size_t) ;
+static void hblock_free(HBLOCK*) ;
+static HNODE* new_hnode(ITable*, uint32_t*) ;
+static void hnode_free(ITable*, HNODE*, uint32_t) ;
 static void itable_free(ITable*) ;
 
 @
 Function, [[itable_convert_i_to_s(ht)]], takes as input a hash table
-keyed on integers ([[ival]]), converts each integer key to a 
-string key via [[sprintf()]], and rebuilds the table on the
-string keys.
+keyed on integers, converts each integer key to a
+string key via [[sprintf()]], and rebuilds the slots on the
+string keys.  The nodes stay where they are.
 
 <<hash table functions>>=
 static void itable_convert_i_to_s(ITable* ht)
 {
-    char buffer[256] ;
-    unsigned hmask = ht->hmask ;
-    HNODE** new_buckets = make_buckets(hmask+1) ;
-    unsigned i ;  /* walks old buckets */
-    unsigned j ;  /* index into new_buckets */
-    unsigned cnt = ht->size ;  /* number of nodes to convert */
-    for(i=0; cnt > 0; i++) {
-        HNODE* p = ht->buckets[i] ;
-	while(p) {
-	    HNODE* q = p ;
-	    p = p->link ;
-            sprintf(buffer, LDFMT, q->ival) ;
-	    q->key = new_STRING(buffer) ;
-	    q->ival = hash(buffer) ;
-	    j = q->ival & hmask ;
-	    q->link = new_buckets[j] ;
-	    new_buckets[j] = q ;
-	    cnt-- ;
+    HSLOT* old_slots = ht->slots ;
+    unsigned cnt = ht->hmask+1 ;  /* number of old slots */
+    unsigned i ;
+    make_slots(ht, ht->hmask) ;
+    ht->str_keys = 1 ;
+    for(i=0; i < cnt; i++) {
+	if (old_slots[i].node) {
+	    HSLOT e = old_slots[i] ;
+	    HNODE* p = itable_node(ht, e.node) ;
+	    e.hfrag = int_to_str_key(p, p->key.ival) ;
+	    hslot_insert(ht, e, hslot_home(e.hfrag, ht->shift), 0) ;
 	}
     }
-    free(ht->buckets) ;
-    ht->buckets = new_buckets ;
+    zfree(old_slots, cnt * sizeof(HSLOT)) ;
 }
 @ %def itable_convert_i_to_s
 
+@
+[[int_to_str_key(p,ival)]] sets the key of [[*p]] to the string
+of [[ival]] and returns its [[hfrag]].
+
+<<hash table functions>>=
+static uint32_t int_to_str_key(HNODE* p, int64_t ival)
+{
+    char buffer[64] ;
+    int len = sprintf(buffer, LDFMT, ival) ;
+    p->key.word = len <= KEY_INLINE ? inline_key(buffer, len)
+                      : (uint64_t)(uintptr_t) new_STRING2(buffer, len) ;
+    return hash_frag(hash64(buffer, len)) ;
+}
+@ %def int_to_str_key
+
 <<hash table declarations and data>>=
 static void itable_convert_i_to_s(ITable*) ;
+static uint32_t int_to_str_key(HNODE*, int64_t) ;
 
 @
-\subsection{Doubling the Number of Hash Buckets}
-The whole point of making the number of buckets a power of two is to
-facilitate resizing.  If the number of buckets is [[2^n]]
-and [[h]] is the hash key, then [[h & 2^n-1]] is the hash bucket index.
-When the number of buckets doubles, the new bit-mask has one more bit
-turned on.  Elements of an old hash bucket, whose hash value have this bit
-turned on, get moved to a new bucket. Elements, with this bit turned off,
-stay in the same bucket.  On average only half the old bucket moves to the
-new bucket.
-If the old bucket is at [[buckets[i]]] for [[i < 2^n]], then the
-elements that move, all move to the new bucket at
-[[buckets[i+2^n]]].
+Function, [[itable_from_dvec(dv,size,str_keys)]], makes a hash table
+from the [[size]] elements of [[DVEC]], [[*dv]].  The vector becomes
+the nodes of the table and the elements stay where they are.
+The keys are integers, or strings if [[str_keys]] is set.
 
 <<hash table functions>>=
-static void double_num_buckets(ITable* htable)
-{
-   unsigned old_hmask = htable->hmask ;
-   unsigned new_hmask = (old_hmask<<1)+1 ;
-   HNODE** buckets = htable->buckets ;
-   buckets = (HNODE**)erealloc(buckets, sizeof(HNODE*) * (new_hmask+1)) ;
-   <<move about half the [[HNODE]]s>>
-   htable->hmask = new_hmask ;
-   htable->limit = (new_hmask+1) * MAX_AVE_BUCKET_SIZE ;
-   htable->buckets = buckets ;
-}
-@ %def double_the_hash_table
-
-<<move about half the [[HNODE]]s>>=
-{
-    HNODE* p ;  /* walks bucket[i] */
-    HNODE* q ;  /* trails p */
-    HNODE* tail ; /* builds bucket[j] from the back */
-    HNODE p0 ;  /* sentinel */
-    HNODE t0 ;  /* sentinel */
-    unsigned i, j ;
-
-    for(i=0, j=old_hmask+1; i < old_hmask+1; i++, j++) {
-        p = buckets[i] ;
-	q = &p0 ;
-	q->link = p ;
-	tail = &t0 ;
-	tail->link = 0 ;
-
-	while(p) {
-	    if (p->ival & (old_hmask+1)) {
-	        /* it moves */
-		q->link = p->link ;
-		tail = tail->link = p ;
-		tail->link = 0 ;
-		p = q->link ;
-	    }
-	    else {
-	        q = p ;
-		p = p->link ;
-	    }
+static ITable* itable_from_dvec(DVEC* dv, size_t size, int str_keys)
+{
+    ITable* ht = ZMALLOC(ITable) ;
+    unsigned hmask = INIT_HMASK ;
+    size_t i ;
+    while(hmask - (hmask>>2) < size) hmask = (hmask<<1)+1 ;
+    make_slots(ht, hmask) ;
+    ht->size = size ;
+    ht->str_keys = str_keys ;
+    ht->used = size ;
+    ht->free_nodes = 0 ;
+    ht->nodes = dv ;
+    for(i=0; i < size; i++) {
+        HNODE* p = dvec_node(dv, i) ;
+	int64_t ival = (int64_t) i + dv->origin ;
+	HSLOT e ;
+	e.node = (uint32_t) (i+1) ;
+	if (str_keys) {
+	    e.hfrag = int_to_str_key(p, ival) ;
 	}
-	buckets[i] = p0.link ;
-	buckets[j] = t0.link ;
+	else {
+	    p->key.ival = ival ;
+	    e.hfrag = hash_frag((uint64_t) ival) ;
+	}
+	hslot_insert(ht, e, hslot_home(e.hfrag, ht->shift), 0) ;
     }
+    return ht ;
 }
+@ %def itable_from_dvec
 
 <<hash table declarations and data>>=
-static void double_num_buckets(ITable*) ;
-        
+static ITable* itable_from_dvec(DVEC*, size_t, int) ;
+
 @
-\subsection{Loop Vectors}
-Creating index vectors for array loops walks over all the
-table nodes placing each lookup key in a vector.
+\subsection{Doubling the Number of Slots}
+When the table is 3/4 full, the number of slots doubles and
+each entry is inserted again from its home slot.  The home
+slots come from [[hfrag]], so nothing is rehashed, and the nodes
+are not looked at.
 
 <<hash table functions>>=
-static int64_t*  itable_i_vector(ITable* it)
+static void double_num_slots(ITable* ht)
 {
-    int64_t* ret = (int64_t*)zmalloc(sizeof(int64_t)*it->size) ;
-    unsigned r = 0 ;
+    HSLOT* old_slots = ht->slots ;
+    unsigned cnt = ht->hmask+1 ;  /* number of old slots */
     unsigned i ;
-    for(i=0; r < it->size; i++) {
-        HNODE* p = it->buckets[i] ;
-	while(p) {
-	    ret[r++] = p->ival ;
-	    p = p->link ;
+    make_slots(ht, (ht->hmask<<1)+1) ;
+    for(i=0; i < cnt; i++) {
+        if (old_slots[i].node) {
+	    hslot_insert(ht, old_slots[i],
+	                 hslot_home(old_slots[i].hfrag, ht->shift), 0) ;
 	}
     }
-    return ret ;
+    zfree(old_slots, cnt * sizeof(HSLOT)) ;
 }
-@ %def itable_i_vector
+@ %def double_num_slots
 
-<<hash table functions>>=
-static STRING**  itable_s_vector(ITable* it)
+<<hash table declarations and data>>=
+static void double_num_slots(ITable*) ;
+
+@
+\section{Spilling Arrays to Disk}
+With [[-W memory=]]{\it size}, [[mem_budget]] is the number of bytes
+that [[zmalloc()]] can have given out before arrays are written to
+disk, and [[mem_used]] is the number it has given out.  Once
+[[mem_used]] is over budget, the interpreter calls
+[[array_spill(base,sp)]] after each statement, at each pass of a
+[[for(i in A)]] loop and before each record.  The cells
+[[base[0]]] to [[sp[0]]] are the evaluation stack, which is where
+the address of an element is held while it is in use, e.g., the
+address of [[A[i]]] in [[A[i] = f()]] while [[f()]] runs.
+
+<<interface prototypes>>=
+void array_spill(CELL*, CELL*) ;
+
+@
+An [[AY_STR]] array that reaches [[SPILL_MIN]] elements goes on the
+list of big arrays, [[big_arrays]], and its [[big]] flag is set.
+[[array_spill()]] converts the big arrays to [[AY_SPILL]], largest
+first, and then writes to disk the partitions of [[AY_SPILL]] arrays
+that are in memory, least recently used first, until [[mem_used]]
+is an eighth under budget.  An array or partition stays in memory if
+an address on the stack points into its nodes, or if a loop is
+walking it in place.
+
+<<interface functions>>=
+void array_spill(CELL* base, CELL* sp)
 {
-    STRING** ret = (STRING**)zmalloc(sizeof(STRING*)*it->size) ;
-    unsigned r = 0 ;
-    unsigned i ;
-    for(i=0; r < it->size; i++) {
-        HNODE* p = it->buckets[i] ;
-	while(p) {
-	    ret[r++] = STRING_dup(p->key) ;
-	    p = p->link ;
+    size_t low = mem_budget - mem_budget/8 ;
+    SpillPart* p ;
+    while(mem_used > low && big_cnt > 0) {
+        ARRAY A = 0 ;
+	unsigned i ;
+	for(i = 0; i < big_cnt; i++) {
+	    ARRAY B = big_arrays[i] ;
+	    if (!B->loops && (A == 0 || B->size > A->size) &&
+	        !table_pinned((ITable*)B->ptr, base, sp)) A = B ;
+	}
+	if (A == 0 || !array_to_disk(A)) break ;
+    }
+    p = lru_last ;
+    while(mem_used > low && p) {
+        SpillPart* hold = p->prev ;
+	if (!table_pinned(p->ht, base, sp)) spill_store(p) ;
+	p = hold ;
+    }
+}
+@ %def array_spill
+
+<<local constants, defines and prototypes>>=
+#define SPILL_MIN  4096
+static ARRAY* big_arrays ;
+static unsigned big_cnt ;  /* number on the list */
+static unsigned big_max ;  /* room on the list */
+
+<<local functions>>=
+static void big_add(ARRAY A)
+{
+    if (big_cnt == big_max) {
+        unsigned new_max = big_max ? 2*big_max : 8 ;
+	if (big_arrays) {
+	    big_arrays = (ARRAY*)zrealloc(big_arrays,
+	              sizeof(ARRAY) * big_max, sizeof(ARRAY) * new_max) ;
+	}
+	else {
+	    big_arrays = (ARRAY*)zmalloc(sizeof(ARRAY) * new_max) ;
+	}
+	big_max = new_max ;
+    }
+    big_arrays[big_cnt++] = A ;
+    A->big = 1 ;
+}
+
+static void big_remove(ARRAY A)
+{
+    unsigned i = 0 ;
+    while(big_arrays[i] != A) i++ ;
+    big_arrays[i] = big_arrays[--big_cnt] ;
+    A->big = 0 ;
+}
+@ %def SPILL_MIN big_arrays big_cnt big_max big_add big_remove
+
+@
+Function [[table_pinned(ht,base,sp)]] returns [[1]] if the
+[[ptr]] of a cell on the stack points into a node of [[*ht]].
+The [[ptr]] of a cell that holds a number is left over from
+before, so this can find an address that is no longer in use,
+which only keeps the table in memory a little longer.
+
+<<local functions>>=
+static int table_pinned(ITable* ht, CELL* base, CELL* sp)
+{
+    DVEC* dv = ht->nodes ;
+    CELL* cp ;
+    for(cp = base; cp <= sp; cp++) {
+        uintptr_t a = (uintptr_t) cp->ptr ;
+	int k ;
+	for(k = 0; k < dv->nseg; k++) {
+	    uintptr_t lo = (uintptr_t) dv->seg[k] ;
+	    uintptr_t hi = (uintptr_t) (dv->seg[k] + node_hblock(dv->seg[k])->cnt) ;
+	    if (a >= lo && a < hi) return 1 ;
 	}
     }
+    return 0 ;
+}
+@ %def table_pinned
+
+@
+\subsection{Spilled Arrays}
+The elements of an [[AY_SPILL]] array are split on the hash value
+of their key into [[nparts]] partitions, a power of 2 picked when
+the array is spilled so that each has about [[SPILL_PART]] elements.
+In memory a partition is an [[ITable]].  On disk it is [[cnt]]
+records, [[bytes]] long, in the temporary file of the array starting
+at [[offset]], with [[room]] bytes for them, and each record is a
+[[SpillRec]] followed by the bytes of the key and then of the string
+value, if any.  The partitions in memory are on a list from
+[[lru_first]], most recently used, to [[lru_last]], and [[dirty]]
+is set on those that may have changed since they were read in.
+
+<<local constants, defines and prototypes>>=
+#define SPILL_PART  32
+#define SPILL_MAXPARTS  (1U << 24)
+typedef struct spill_part {
+    ITable* ht ;  /* the elements if in memory, else 0 */
+    struct spill* spill ;  /* the array this is part of */
+    struct spill_part* prev ;  /* list of partitions in memory */
+    struct spill_part* next ;
+    int64_t offset ;
+    size_t room ;
+    size_t bytes ;
+    size_t cnt ;
+    int dirty ;
+} SpillPart ;
+
+typedef struct spill {
+    FILE* fp ;
+    int64_t end ;  /* bytes of fp in use */
+    unsigned nparts ;
+    SpillPart* parts ;
+} Spill ;
+
+typedef struct spill_rec {
+    size_t klen ;  /* bytes of key */
+    size_t slen ;  /* bytes of string value */
+    double dval ;
+    int type ;  /* of the value */
+} SpillRec ;
+
+static SpillPart* lru_first ;
+static SpillPart* lru_last ;
+static char* spill_buff ;  /* records on their way to or from disk */
+static size_t spill_buff_size ;
+#define spill_part(S, s, len)  ((unsigned) hash64(s, len) & ((S)->nparts-1))
+@ %def SPILL_PART SPILL_MAXPARTS SpillPart Spill SpillRec lru_first lru_last
+@ %def spill_buff spill_buff_size spill_part
+
+@
+A lookup reads in the partition of the key if it is on disk.  So a
+program that uses some keys much more than others, or that walks a
+spilled array with [[for(i in A)]], runs close to memory speed,
+while one that uses keys at random reads a partition on most
+lookups; that is slow, but it finishes.
+Any lookup but [[NO_CREATE]] returns an element that can be
+changed, so it marks the partition [[dirty]].
+
+<<local functions>>=
+static CELL* spill_find(Spill* S, STRING* sval, int flag, size_t* sizep)
+{
+    unsigned k = spill_part(S, sval->str, sval->len) ;
+    ITable* ht = spill_table(S, k) ;
+    unsigned old_size = ht->size ;
+    size_t dummy ;
+    CELL* ret = itable_find(ht, sval, 0, flag, &dummy) ;
+    *sizep = *sizep + ht->size - old_size ;
+    if (flag != NO_CREATE) S->parts[k].dirty = 1 ;
     return ret ;
 }
-@ %def itable_s_vector
 
-<<hash table declarations and data>>=
-static int64_t* itable_i_vector(ITable*) ;
-static STRING** itable_s_vector(ITable*) ;
+static ITable* spill_table(Spill* S, unsigned k)
+{
+    SpillPart* p = S->parts + k ;
+    if (p->ht == 0) {
+        spill_load(p) ;
+    }
+    else if (p != lru_first) {
+        lru_unlink(p) ;
+	lru_push(p) ;
+    }
+    return p->ht ;
+}
+
+static void lru_push(SpillPart* p)
+{
+    p->prev = 0 ;
+    p->next = lru_first ;
+    if (lru_first) lru_first->prev = p ;
+    else lru_last = p ;
+    lru_first = p ;
+}
+
+static void lru_unlink(SpillPart* p)
+{
+    if (p->prev) p->prev->next = p->next ;
+    else lru_first = p->next ;
+    if (p->next) p->next->prev = p->prev ;
+    else lru_last = p->prev ;
+}
+@ %def spill_find spill_table lru_push lru_unlink
+
+@
+Function [[array_to_disk(A)]] converts [[AY_STR]] array [[A]] to
+[[AY_SPILL]] with all its partitions on disk, and returns [[1]].
+The nodes are put in order of partition with a counting sort of
+their indices, and then written out in that order.
+If there is no temporary file to be had, the budget is given up
+and the return is [[0]].
+
+<<local functions>>=
+static int array_to_disk(ARRAY A)
+{
+    ITable* ht = (ITable*)A->ptr ;
+    FILE* fp = spill_tmpfile() ;
+    Spill* S ;
+    uint32_t* order ;
+    size_t* pos ;
+    size_t i, n ;
+    unsigned k ;
+    if (fp == 0) {
+        errmsg(errno, "cannot open a temporary file, -W memory is ignored") ;
+	mem_budget = (size_t) -1 ;
+	return 0 ;
+    }
+    S = ZMALLOC(Spill) ;
+    S->fp = fp ;
+    S->end = 0 ;
+    S->nparts = 16 ;
+    while(S->nparts < A->size / SPILL_PART && S->nparts < SPILL_MAXPARTS) {
+        S->nparts <<= 1 ;
+    }
+    S->parts = (SpillPart*)zmalloc(sizeof(SpillPart) * S->nparts) ;
+    memset(S->parts, 0, sizeof(SpillPart) * S->nparts) ;
+    for(k = 0; k < S->nparts; k++) S->parts[k].spill = S ;
+    <<sort the node indices of [[ht]] by partition into [[order]]>>
+    for(i = 0, k = 0; k < S->nparts; k++) {
+        SpillPart* p = S->parts + k ;
+	size_t j ;
+	char* q ;
+	for(j = 0; j < p->cnt; j++) {
+	    p->bytes += spill_size(dvec_node(ht->nodes, order[i+j])) ;
+	}
+	q = spill_buffer(p->bytes) ;
+	for(j = 0; j < p->cnt; j++) {
+	    q += spill_put(q, dvec_node(ht->nodes, order[i++])) ;
+	}
+	p->offset = S->end ;
+	p->room = p->bytes ;
+	S->end += p->room ;
+	if (fwrite(spill_buff, 1, p->bytes, fp) != p->bytes) spill_error() ;
+    }
+    zfree(order, sizeof(uint32_t) * A->size) ;
+    zfree(pos, sizeof(size_t) * S->nparts) ;
+    big_remove(A) ;
+    itable_free(ht) ;
+    A->ptr = S ;
+    A->type = AY_SPILL ;
+    return 1 ;
+}
+@ %def array_to_disk
+
+<<sort the node indices of [[ht]] by partition into [[order]]>>=
+order = (uint32_t*)zmalloc(sizeof(uint32_t) * A->size) ;
+pos = (size_t*)zmalloc(sizeof(size_t) * S->nparts) ;
+for(i = 0; i < ht->used; i++) {
+    HNODE* p = dvec_node(ht->nodes, i) ;
+    if (p->cell.type != NODE_FREE) S->parts[node_part(S, p)].cnt++ ;
+}
+for(n = 0, k = 0; k < S->nparts; k++) {
+    pos[k] = n ;
+    n += S->parts[k].cnt ;
+}
+for(i = 0; i < ht->used; i++) {
+    HNODE* p = dvec_node(ht->nodes, i) ;
+    if (p->cell.type != NODE_FREE) order[pos[node_part(S, p)]++] = (uint32_t) i ;
+}
+
+@
+[[key_chars(w,buff,lenp)]] returns the bytes of the key in
+key word [[w]], using [[buff]] for a key kept in the word, and
+sets [[*lenp]] to their number.
+
+<<local functions>>=
+static const char* key_chars(uint64_t w, char* buff, size_t* lenp)
+{
+    if (key_is_inline(w)) {
+        size_t len = (w >> 1) & 0x7f ;
+	size_t i ;
+	for(i = 0; i < len; i++) buff[i] = (char)(w >> 8*(i+1)) ;
+	*lenp = len ;
+	return buff ;
+    }
+    *lenp = key_sval(w)->len ;
+    return key_sval(w)->str ;
+}
+
+static unsigned node_part(Spill* S, const HNODE* p)
+{
+    char buff[KEY_INLINE] ;
+    size_t len ;
+    const char* s = key_chars(p->key.word, buff, &len) ;
+    return spill_part(S, s, len) ;
+}
+@ %def key_chars node_part
+
+@
+Function [[rec_put(buff,key,klen,cp)]] puts the element with key
+[[key[0..klen-1]]] and value [[*cp]] as a record in [[buff]] and
+returns its size, and [[spill_put(buff,p)]] does that for node
+[[*p]].  [[spill_get(buff,ht)]] adds the element of the record in
+[[buff]] to [[*ht]], unless [[*ht]] has its key already, and returns
+the size of the record.  A partition goes
+to or from disk with one [[fwrite()]] or [[fread()]] of
+[[spill_buff]], which [[spill_buffer(bytes)]] makes big enough.
+
+<<local constants, defines and prototypes>>=
+#define value_is_string(t)  ((t) == C_STRING || (t) == C_STRNUM || (t) == C_MBSTRN)
+
+<<local functions>>=
+static size_t rec_put(char* buff, const char* key, size_t klen,
+                      const CELL* cp)
+{
+    SpillRec r ;
+    memset(&r, 0, sizeof(r)) ;
+    r.klen = klen ;
+    r.type = cp->type ;
+    if (r.type == C_DOUBLE || r.type == C_STRNUM) r.dval = cp->dval ;
+    if (value_is_string(r.type)) r.slen = string(cp)->len ;
+    memcpy(buff, &r, sizeof(r)) ;
+    memcpy(buff + sizeof(r), key, r.klen) ;
+    if (r.slen > 0) {
+        memcpy(buff + sizeof(r) + r.klen, string(cp)->str, r.slen) ;
+    }
+    return sizeof(r) + r.klen + r.slen ;
+}
+
+static size_t spill_put(char* buff, HNODE* p)
+{
+    char kbuff[KEY_INLINE] ;
+    size_t klen ;
+    const char* key = key_chars(p->key.word, kbuff, &klen) ;
+    return rec_put(buff, key, klen, &p->cell) ;
+}
+
+static size_t spill_get(const char* buff, ITable* ht)
+{
+    SpillRec r ;
+    STRING* key ;
+    CELL* cp ;
+    unsigned old_size = ht->size ;
+    size_t dummy ;
+    memcpy(&r, buff, sizeof(r)) ;
+    key = new_STRING2(buff + sizeof(r), r.klen) ;
+    cp = itable_find(ht, key, 0, CREATE, &dummy) ;
+    free_STRING(key) ;
+    if (ht->size != old_size) {
+        cp->type = r.type ;
+	cp->dval = r.dval ;
+	if (value_is_string(r.type)) {
+	    cp->ptr = (PTR) new_STRING2(buff + sizeof(r) + r.klen, r.slen) ;
+	}
+    }
+    return sizeof(r) + r.klen + r.slen ;
+}
+
+static char* spill_buffer(size_t bytes)
+{
+    if (bytes > spill_buff_size) {
+        size_t size = spill_buff_size ? spill_buff_size : 4096 ;
+	while(size < bytes) size <<= 1 ;
+	if (spill_buff) zfree(spill_buff, spill_buff_size) ;
+	spill_buff = (char*)zmalloc(size) ;
+	spill_buff_size = size ;
+    }
+    return spill_buff ;
+}
+
+static void spill_error(void)
+{
+    rt_error("read or write failed on the temporary file of an array") ;
+}
+@ %def value_is_string rec_put spill_put spill_get spill_buffer spill_error
+
+@
+[[spill_load(p)]] reads partition [[*p]] into memory and
+[[spill_store(p)]] writes it out, if it is [[dirty]], and frees its
+memory.  A partition that no longer fits in its room moves to the
+end of the file with half as much again to grow into.
+
+<<local functions>>=
+static void spill_load(SpillPart* p)
+{
+    FILE* fp = p->spill->fp ;
+    ITable* ht = make_empty_itable() ;
+    size_t i ;
+    if (p->cnt > ht->limit) {
+        unsigned hmask = ht->hmask ;
+	while(hmask - (hmask>>2) < p->cnt) hmask = (hmask<<1)+1 ;
+	zfree(ht->slots, (ht->hmask+1) * sizeof(HSLOT)) ;
+	make_slots(ht, hmask) ;
+    }
+    if (p->bytes > 0) {
+        char* q = spill_buffer(p->bytes) ;
+	if (spill_seek(fp, p->offset) != 0 ||
+	    fread(q, 1, p->bytes, fp) != p->bytes) spill_error() ;
+	for(i = 0; i < p->cnt; i++) q += spill_get(q, ht) ;
+    }
+    p->ht = ht ;
+    p->dirty = 0 ;
+    lru_push(p) ;
+}
+
+static void spill_store(SpillPart* p)
+{
+    Spill* S = p->spill ;
+    ITable* ht = p->ht ;
+    if (p->dirty) {
+        size_t bytes = 0 ;
+	size_t i ;
+	char* q ;
+	for(i = 0; i < ht->used; i++) {
+	    HNODE* r = dvec_node(ht->nodes, i) ;
+	    if (r->cell.type != NODE_FREE) bytes += spill_size(r) ;
+	}
+	if (bytes > p->room) {
+	    p->offset = S->end ;
+	    p->room = bytes + bytes/2 ;
+	    S->end += p->room ;
+	}
+	q = spill_buffer(bytes) ;
+	for(i = 0; i < ht->used; i++) {
+	    HNODE* r = dvec_node(ht->nodes, i) ;
+	    if (r->cell.type != NODE_FREE) q += spill_put(q, r) ;
+	}
+	if (bytes > 0 && (spill_seek(S->fp, p->offset) != 0 ||
+	    fwrite(spill_buff, 1, bytes, S->fp) != bytes)) spill_error() ;
+	p->bytes = bytes ;
+	p->cnt = ht->size ;
+    }
+    lru_unlink(p) ;
+    itable_free(ht) ;
+    p->ht = 0 ;
+}
+
+static size_t spill_size(const HNODE* p)
+{
+    uint64_t w = p->key.word ;
+    size_t size = sizeof(SpillRec) ;
+    size += key_is_inline(w) ? (w >> 1) & 0x7f : key_sval(w)->len ;
+    if (value_is_string(p->cell.type)) size += ((STRING*)p->cell.ptr)->len ;
+    return size ;
+}
+@ %def spill_load spill_store spill_size
+
+@
+Function [[spill_free(S)]] frees all memory of [[Spill]] [[*S]] and
+closes its file, which goes away with it.
+
+<<local functions>>=
+static void spill_free(Spill* S)
+{
+    unsigned k ;
+    for(k = 0; k < S->nparts; k++) {
+        SpillPart* p = S->parts + k ;
+	if (p->ht) {
+	    lru_unlink(p) ;
+	    itable_free(p->ht) ;
+	}
+    }
+    fclose(S->fp) ;
+    zfree(S->parts, sizeof(SpillPart) * S->nparts) ;
+    ZFREE(S) ;
+}
+@ %def spill_free
+
+@
+A temporary file from [[tmpfile()]] is removed when it is closed,
+or when [[mawk]] exits.  The Windows [[tmpfile()]] makes the file
+in the root directory, which is often not writable, so there the
+file is made in the directory named by [[TMP]] and opened with
+the Microsoft flags [[T]], to keep it in the cache if possible,
+and [[D]], to delete it on close.
+The file is not buffered, as it is read and written a partition
+at a time.
+
+<<local functions>>=
+static FILE* spill_tmpfile(void)
+{
+    FILE* fp ;
+#if defined(_WIN32) || defined(_WIN64)
+    char* name = _tempnam(0, "wmawk") ;
+    fp = name ? fopen(name, "w+bTD") : 0 ;
+    free(name) ;
+#else
+    fp = tmpfile() ;
+#endif
+    if (fp) setvbuf(fp, 0, _IONBF, 0) ;
+    return fp ;
+}
+@ %def spill_tmpfile
+
+<<local constants, defines and prototypes>>=
+#if defined(_WIN32) || defined(_WIN64)
+#define spill_seek(fp, off)  _fseeki64(fp, off, SEEK_SET)
+#else
+#define spill_seek(fp, off)  fseeko(fp, (off_t) (off), SEEK_SET)
+#endif
+@ %def spill_seek
+
+@
+A loop over an [[AY_SPILL]] array takes the keys of one partition at a
+time with [[spill_keys(al,ht)]].
+
+<<set [[i]] to the next index of spilled [[A]] or return [[0]]>>=
+{
+    Spill* S = (Spill*)al->A->ptr ;
+    STRING* sval ;
+    do {
+        while(al->next >= al->size) {
+	    aloop_free_keys(al) ;
+	    if (al->part == S->nparts) return 0 ;
+	    spill_keys(al, spill_table(S, al->part++)) ;
+	}
+	sval = al->ptr.sval[al->next++] ;
+    } while(!spill_find(S, sval, NO_CREATE, &al->A->size)) ;
+    cell_destroy(al->cp) ;
+    al->cp->type = C_STRING ;
+    al->cp->ptr = (PTR) STRING_dup(sval) ;
+}
+
+<<local functions>>=
+static void spill_keys(ALoop* al, ITable* ht)
+{
+    size_t i ;
+    unsigned j = 0 ;
+    al->next = 0 ;
+    al->size = ht->size ;
+    if (al->size == 0) return ;
+    al->ptr.sval = (STRING**)zmalloc(sizeof(STRING*) * al->size) ;
+    for(i = 0; i < ht->used; i++) {
+        HNODE* p = dvec_node(ht->nodes, i) ;
+	if (p->cell.type != NODE_FREE) al->ptr.sval[j++] = node_key(p) ;
+    }
+}
+@ %def spill_keys
+
+<<local constants, defines and prototypes>>=
+static void big_add(ARRAY) ;
+static void big_remove(ARRAY) ;
+static int table_pinned(ITable*, CELL*, CELL*) ;
+static CELL* spill_find(Spill*, STRING*, int, size_t*) ;
+static ITable* spill_table(Spill*, unsigned) ;
+static void lru_push(SpillPart*) ;
+static void lru_unlink(SpillPart*) ;
+static int array_to_disk(ARRAY) ;
+static const char* key_chars(uint64_t, char*, size_t*) ;
+static unsigned node_part(Spill*, const struct hnode*) ;
+static size_t rec_put(char*, const char*, size_t, const CELL*) ;
+static size_t spill_put(char*, struct hnode*) ;
+static size_t spill_get(const char*, ITable*) ;
+static char* spill_buffer(size_t) ;
+static void spill_error(void) ;
+static void spill_load(SpillPart*) ;
+static void spill_store(SpillPart*) ;
+static size_t spill_size(const struct hnode*) ;
+static void spill_free(Spill*) ;
+static FILE* spill_tmpfile(void) ;
+static void spill_keys(ALoop*, ITable*) ;
+
+@
+\section{Array Files}
+The built-in [[writea(file, A)]] writes array [[A]] to [[file]] as a
+hash table, and [[reada(file, A)]] makes [[A]] an [[AY_MAPPED]]
+array of the elements in such a file by mapping it into memory, so a
+large lookup table is ready at once and only the pages that lookups
+touch are read from disk.  Both return [[1]], or [[0]] if the file
+cannot be written or is not an array file.
+The names and arguments are those of the [[rwarray]] extension of
+[[gawk]], but the files are not the same.
+
+<<interface prototypes>>=
+int array_dump(ARRAY, const char*) ;
+int array_attach(ARRAY, const char*) ;
+
+@
+An array file is a [[MapHead]], then a table of [[nslots]]
+[[MapSlot]]s, then the [[size]] elements as records in the format
+of spilled partitions.  A slot holds the [[hash64()]] value of the
+key of a record and the offset of the record, with [[0]] for an
+empty slot, and a key is found by linear probing from slot
+[[hval & (nslots-1)]].  There are at least twice as many slots as
+elements.  A file made on a machine with other byte order or
+[[size_t]] is not accepted.
+
+<<local constants, defines and prototypes>>=
+#define MAP_MAGIC  "wmawk2A"
+#define MAP_ORDER  0x01020304
+typedef struct map_head {
+    char magic[8] ;
+    uint32_t order ;  /* MAP_ORDER as written */
+    uint32_t rec_size ;  /* sizeof(SpillRec) */
+    uint64_t size ;  /* number of elements */
+    uint64_t nslots ;  /* a power of 2 */
+    uint64_t end ;  /* size of the file */
+} MapHead ;
+
+typedef struct map_slot {
+    uint64_t hval ;
+    uint64_t offset ;
+} MapSlot ;
+@ %def MAP_MAGIC MAP_ORDER MapHead MapSlot
+
+@
+[[array_dump(A,name)]] writes the records after room for the
+header and slots, filling the slots as it goes, and then goes back
+to write them.  The keys of an [[AY_SPLIT]] or [[AY_INT]] array are
+made strings the way [[int_to_str_key()]] makes them.  Each
+partition of an [[AY_SPILL]] array that was on disk goes back to
+disk when it has been written.
+The file is written under a temporary name in the same directory and
+then renamed to [[name]], so an array that [[reada()]] mapped from
+the old file keeps it.  On Windows the rename fails while the old
+file is mapped, and then nothing is written.
+
+<<interface functions>>=
+int array_dump(ARRAY A, const char* name)
+{
+    DumpFile df ;
+    MapHead head ;
+    size_t i ;
+    int ok ;
+    size_t tmp_size = strlen(name) + 32 ;
+    char* tmp = (char*)zmalloc(tmp_size) ;
+    if (A->type == AY_MAPPED) map_to_str(A) ;
+    sprintf(tmp, "%s.%d.tmp", name, (int) getpid()) ;
+    if ((df.fp = fopen(tmp, "wb")) == 0) {
+	zfree(tmp, tmp_size) ;
+	return 0 ;
+    }
+    df.nslots = 16 ;
+    while(df.nslots < 2 * (uint64_t) A->size) df.nslots <<= 1 ;
+    df.slots = (MapSlot*)zmalloc(sizeof(MapSlot) * df.nslots) ;
+    memset(df.slots, 0, sizeof(MapSlot) * df.nslots) ;
+    df.offset = sizeof(MapHead) + sizeof(MapSlot) * df.nslots ;
+    ok = spill_seek(df.fp, df.offset) == 0 ;
+    if (ok && A->type == AY_SPLIT) {
+	DVEC* dv = (DVEC*)A->ptr ;
+	for(i = 0; i < A->size; i++) {
+	    char buff[64] ;
+	    int len = sprintf(buff, LDFMT, (int64_t) i + dv->origin) ;
+	    dump_element(&df, buff, len, dvec_cell(dv, i)) ;
+	}
+    }
+    else if (ok && (A->type == AY_STR || A->type == AY_INT)) {
+	dump_table(&df, (ITable*)A->ptr) ;
+    }
+    else if (ok && A->type == AY_SPILL) {
+	Spill* S = (Spill*)A->ptr ;
+	unsigned k ;
+	for(k = 0; k < S->nparts; k++) {
+	    int on_disk = S->parts[k].ht == 0 ;
+	    dump_table(&df, spill_table(S, k)) ;
+	    if (on_disk) spill_store(S->parts + k) ;
+	}
+    }
+    memset(&head, 0, sizeof(head)) ;
+    strcpy(head.magic, MAP_MAGIC) ;
+    head.order = MAP_ORDER ;
+    head.rec_size = sizeof(SpillRec) ;
+    head.size = A->size ;
+    head.nslots = df.nslots ;
+    head.end = df.offset ;
+    ok = ok && !ferror(df.fp) && spill_seek(df.fp, 0) == 0 &&
+	 fwrite(&head, sizeof(head), 1, df.fp) == 1 &&
+	 fwrite(df.slots, sizeof(MapSlot), df.nslots, df.fp) == df.nslots ;
+    if (fclose(df.fp) != 0) ok = 0 ;
+    zfree(df.slots, sizeof(MapSlot) * df.nslots) ;
+    if (!ok || !dump_rename(tmp, name)) {
+	remove(tmp) ;
+	ok = 0 ;
+    }
+    zfree(tmp, tmp_size) ;
+    return ok ;
+}
+@ %def array_dump
+
+<<local constants, defines and prototypes>>=
+typedef struct dump_file {
+    FILE* fp ;
+    MapSlot* slots ;
+    uint64_t nslots ;
+    uint64_t offset ;  /* of the next record */
+} DumpFile ;
+
+#if defined(_WIN32) || defined(_WIN64)
+#define dump_rename(tmp, name)  \
+	MoveFileExA(tmp, name, MOVEFILE_REPLACE_EXISTING)
+#else
+#define dump_rename(tmp, name)  (rename(tmp, name) == 0)
+#endif
+@ %def DumpFile dump_rename
+
+<<local functions>>=
+static void dump_table(DumpFile* df, ITable* ht)
+{
+    size_t i ;
+    for(i = 0; i < ht->used; i++) {
+	HNODE* p = dvec_node(ht->nodes, i) ;
+	char buff[64] ;
+	const char* key ;
+	size_t len ;
+	if (p->cell.type == NODE_FREE) continue ;
+	if (ht->str_keys) key = key_chars(p->key.word, buff, &len) ;
+	else {
+	    len = sprintf(buff, LDFMT, p->key.ival) ;
+	    key = buff ;
+	}
+	dump_element(df, key, len, &p->cell) ;
+    }
+}
+
+static void dump_element(DumpFile* df, const char* key, size_t len,
+			 const CELL* cp)
+{
+    size_t bytes = sizeof(SpillRec) + len ;
+    uint64_t hval = hash64(key, len) ;
+    uint64_t i = hval & (df->nslots-1) ;
+    if (value_is_string(cp->type)) bytes += string(cp)->len ;
+    rec_put(spill_buffer(bytes), key, len, cp) ;
+    fwrite(spill_buff, 1, bytes, df->fp) ;
+    while(df->slots[i].offset) i = (i+1) & (df->nslots-1) ;
+    df->slots[i].hval = hval ;
+    df->slots[i].offset = df->offset ;
+    df->offset += bytes ;
+}
+@ %def dump_table dump_element
+
+@
+[[array_attach(A,name)]] maps file [[name]] and checks its header
+before [[A]] is cleared to become an [[AY_MAPPED]] array.  An
+[[AMap]] is the mapped file, and [[ht]], a table of the elements
+that have been looked up.  The table holds the [[CELL]] that a
+lookup returns, which the program can then change.
+
+<<local constants, defines and prototypes>>=
+typedef struct amap {
+    const char* base ;  /* the mapped file */
+    size_t len ;
+    ITable* ht ;  /* the elements looked up */
+} AMap ;
+@ %def AMap
+
+<<interface functions>>=
+int array_attach(ARRAY A, const char* name)
+{
+    size_t len ;
+    const char* base = map_file(name, &len) ;
+    const MapHead* head = (const MapHead*) base ;
+    AMap* M ;
+    if (base == 0) return 0 ;
+    if (len < sizeof(MapHead) ||
+	memcmp(head->magic, MAP_MAGIC, sizeof(MAP_MAGIC)) != 0 ||
+	head->order != MAP_ORDER || head->rec_size != sizeof(SpillRec) ||
+	head->end != len || head->nslots == 0 ||
+	(head->nslots & (head->nslots-1)) != 0 ||
+	head->size >= head->nslots ||
+	head->nslots > (len - sizeof(MapHead)) / sizeof(MapSlot)) {
+	unmap_file(base, len) ;
+	return 0 ;
+    }
+    array_clear(A) ;
+    if (head->size == 0) {
+	unmap_file(base, len) ;
+	return 1 ;
+    }
+    M = ZMALLOC(AMap) ;
+    M->base = base ;
+    M->len = len ;
+    M->ht = make_empty_itable() ;
+    A->ptr = M ;
+    A->size = (size_t) head->size ;
+    A->type = AY_MAPPED ;
+    return 1 ;
+}
+@ %def array_attach
+
+@
+A lookup in an [[AY_MAPPED]] array, [[map_find(M,sval)]], tries
+[[M->ht]], and then the file, and adds an element that is found
+in the file to [[M->ht]].  A lookup that creates an element adds
+just that element to [[M->ht]] and counts it in [[A->size]].  A
+delete and anything else that works on all of [[A]] first makes it
+an [[AY_STR]] array with [[map_to_str(A)]], which adds the elements
+of the file that are not in [[M->ht]] yet, so the elements that were
+looked up or created keep their values and addresses.
+
+<<local functions>>=
+static CELL* map_find(AMap* M, STRING* sval)
+{
+    size_t dummy ;
+    CELL* cp = itable_find(M->ht, sval, 0, NO_CREATE, &dummy) ;
+    const char* rec ;
+    if (cp == 0 && (rec = map_record(M, sval->str, sval->len)) != 0) {
+	spill_get(rec, M->ht) ;
+	cp = itable_find(M->ht, sval, 0, NO_CREATE, &dummy) ;
+    }
+    return cp ;
+}
+
+static const char* map_record(AMap* M, const char* s, size_t len)
+{
+    const MapHead* head = (const MapHead*) M->base ;
+    const MapSlot* slots = (const MapSlot*) (head + 1) ;
+    uint64_t hval = hash64(s, len) ;
+    uint64_t i = hval & (head->nslots-1) ;
+    uint64_t n ;
+    for(n = 0; n < head->nslots && slots[i].offset; n++) {
+	if (slots[i].hval == hval) {
+	    const char* rec = map_check(M, slots[i].offset) ;
+	    SpillRec r ;
+	    memcpy(&r, rec, sizeof(r)) ;
+	    if (r.klen == len && memcmp(rec + sizeof(r), s, len) == 0) {
+	        return rec ;
+	    }
+	}
+	i = (i+1) & (head->nslots-1) ;
+    }
+    return 0 ;
+}
+
+static void map_to_str(ARRAY A)
+{
+    AMap* M = (AMap*)A->ptr ;
+    const MapHead* head = (const MapHead*) M->base ;
+    const MapSlot* slots = (const MapSlot*) (head + 1) ;
+    uint64_t i ;
+    for(i = 0; i < head->nslots; i++) {
+	if (slots[i].offset) spill_get(map_check(M, slots[i].offset), M->ht) ;
+    }
+    A->ptr = M->ht ;
+    A->type = AY_STR ;
+    M->ht = 0 ;
+    map_free(M) ;
+}
+
+static void map_free(AMap* M)
+{
+    if (M->ht) itable_free(M->ht) ;
+    unmap_file(M->base, M->len) ;
+    ZFREE(M) ;
+}
+@ %def map_find map_record map_to_str map_free
+
+@
+Only the header is checked when a file is mapped, so a record is
+checked when it is used: it must be inside the file, its value must
+be one of the types [[rec_put()]] writes, and only a string value
+has bytes.
+
+<<local functions>>=
+static const char* map_check(AMap* M, uint64_t offset)
+{
+    SpillRec r ;
+    if (offset > M->len - sizeof(r)) map_error() ;
+    memcpy(&r, M->base + offset, sizeof(r)) ;
+    if (r.klen > M->len || r.slen > M->len ||
+	r.klen + r.slen > M->len - sizeof(r) - offset) map_error() ;
+    if (r.type < C_NOINIT || r.type > C_MBSTRN ||
+	(r.slen != 0 && !value_is_string(r.type))) map_error() ;
+    return M->base + offset ;
+}
+
+static void map_error(void)
+{
+    rt_error("an array file read with reada() is corrupt") ;
+}
+@ %def map_check map_error
+
+@
+[[map_file(name,lenp)]] maps file [[name]] read only, sets [[*lenp]]
+to its size and returns its address, or [[0]] if it cannot, and
+[[unmap_file(base,len)]] undoes that.  The mapping stays after the
+file is closed.  Lookups go all over the file, so the system is
+told not to read ahead.
+
+<<local functions>>=
+static const char* map_file(const char* name, size_t* lenp)
+{
+    struct stat st ;
+    const char* base = 0 ;
+    int fd = open(name, O_RDONLY) ;
+    if (fd == -1) return 0 ;
+    if (fstat(fd, &st) == 0 && st.st_size > 0 &&
+	(uint64_t) st.st_size <= (size_t) -1) {
+#if defined(_WIN32) || defined(_WIN64)
+	HANDLE h = CreateFileMapping((HANDLE) _get_osfhandle(fd), 0,
+	                             PAGE_READONLY, 0, 0, 0) ;
+	if (h) {
+	    base = (const char*) MapViewOfFile(h, FILE_MAP_READ, 0, 0, 0) ;
+	    CloseHandle(h) ;
+	}
+#else
+	void* p = mmap(0, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0) ;
+	if (p != MAP_FAILED) {
+	    posix_madvise(p, (size_t) st.st_size, POSIX_MADV_RANDOM) ;
+	    base = (const char*) p ;
+	}
+#endif
+	*lenp = (size_t) st.st_size ;
+    }
+    close(fd) ;
+    return base ;
+}
+
+static void unmap_file(const char* base, size_t len)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    UnmapViewOfFile(base) ;
+#else
+    munmap((void*) base, len) ;
+#endif
+}
+@ %def map_file unmap_file
+
+<<local constants, defines and prototypes>>=
+static void dump_table(DumpFile*, ITable*) ;
+static void dump_element(DumpFile*, const char*, size_t, const CELL*) ;
+static CELL* map_find(AMap*, STRING*) ;
+static const char* map_record(AMap*, const char*, size_t) ;
+static void map_to_str(ARRAY) ;
+static void map_free(AMap*) ;
+static const char* map_check(AMap*, uint64_t) ;
+static void map_error(void) ;
+static const char* map_file(const char*, size_t*) ;
+static void unmap_file(const char*, size_t) ;
+
 @
 \section{Source Files}
 
@@ -1049,12 +3088,21 @@ static STRING** itable_s_vector(ITable*) ;
 <<"array.c">>=
 /* array.c */
 <<blurb>>
+#define  ZTAG  ZT_ARRAY
 #include "mawk.h"
 #include "symtype.h"
 #include "memory.h"
 #include "split.h"
 #include "field.h"
 #include "bi_vars.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#endif
 <<local constants, defines and prototypes>>
 <<hash table declarations and data>>
 <<interface functions>>
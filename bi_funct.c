@@ -234,10 +234,11 @@ bi_index(CELL* sp)
 
 /*  substr(s, i, n)
     if l = length(s)  then get the characters
-    from  max(1,i) to min(l,n-i-1) inclusive */
+    from  max(1,i) to min(l,n-i-1) inclusive.
+    If slice is set, the result can be a C_SLICE of s */
 
-CELL *
-bi_substr(CELL* sp)
+static CELL *
+substr(CELL* sp, int slice)
 {
    int n_args, len ;
    register int i, n ;
@@ -276,16 +277,53 @@ bi_substr(CELL* sp)
       sp->ptr = (PTR) & null_str ;
       null_str.ref_cnt++ ;
    }
+   else if (n == len)		/* all of it */
+   {
+      return sp ;
+   }
+   else if (slice)		/* keep sval, see bi_substr_slice() */
+   {
+      SLICE s ;
+
+      s.off = i ;
+      s.len = n ;
+      sp->type = C_SLICE ;
+      slice_set(sp, s) ;
+      return sp ;
+   }
+   else if (sval->ref_cnt == 1 && STRING_SIZE(n) == STRING_SIZE(len))
+   {
+      /* a temporary, cut it down where it is */
+      memmove(sval->str, sval->str + i, n) ;
+      sval->str[n] = 0 ;
+      sval->len = n ;
+      return sp ;
+   }
    else	 /* got something */
    {
-      sp->ptr = (PTR) new_STRING0(n) ;
-      memcpy(string(sp)->str, sval->str + i, n) ;
+      sp->ptr = (PTR) new_STRING2(sval->str + i, n) ;
    }
 
    free_STRING(sval) ;
    return sp ;
 }
 
+CELL *
+bi_substr(CELL* sp)
+{
+   return substr(sp, 0) ;
+}
+
+/* The parser calls this instead of bi_substr() when the result is
+   an operand of cat or an argument of print, which take a C_SLICE.
+   Then the characters are copied once, to where they are used */
+
+CELL *
+bi_substr_slice(CELL* sp)
+{
+   return substr(sp, 1) ;
+}
+
 /*
   match(s,r)
   sp[0] holds r, sp[-1] holds s
@@ -326,6 +364,180 @@ bi_match(CELL* sp)
    return sp ;
 }
 
+/* A[n] = the text of group n, A[n, "start"] and A[n, "length"] */
+static void
+set_group(ARRAY A, int n, const char* str, size_t start, size_t len)
+{
+   CELL key[2] ;
+   CELL *cp ;
+   static const char* const names[2] = { "start", "length" } ;
+   int i ;
+
+   key[0].type = C_DOUBLE ;
+   key[0].dval = (double) n ;
+   cp = array_find(A, key, CREATE) ;
+   cp->type = C_STRING ;
+   cp->ptr = (PTR) new_STRING0(len) ;
+   memcpy(string(cp)->str, str + start, len) ;
+
+   for(i = 0; i < 2; i++) {
+      key[0].type = C_DOUBLE ;
+      key[0].dval = (double) n ;
+      key[1].type = C_STRING ;
+      key[1].ptr = (PTR) new_STRING(names[i]) ;
+      array_cat(key + 1, 2) ;
+      cp = array_find(A, key, CREATE) ;
+      free_STRING(string(key)) ;
+      cp->type = C_DOUBLE ;
+      cp->dval = i == 0 ? (double) (start + 1) : (double) len ;
+   }
+}
+
+/*
+  match(s,r,A)
+  sp[0] holds A, sp[-1] holds r, sp[-2] holds s
+  as match(s,r), and on a match A[0] is the matched text and A[n] the
+  text matched by the n-th ( ) group, with A[n, "start"] and
+  A[n, "length"].  The groups come from the same pass over s.
+*/
+
+CELL *
+bi_match3(CELL* sp)
+{
+   static ptrdiff_t* gv ;   /* group boundaries */
+   static int gv_size ;
+   ARRAY A = (ARRAY) sp->ptr ;
+   PTR re ;
+   int ngroups ;
+   char *p ;
+   size_t length ;
+
+   if ((--sp)->type != C_RE)  cast_to_RE(sp) ;
+   re = re_groups(sp->ptr) ;
+   if ((--sp)->type < C_STRING)	 cast1_to_s(sp) ;
+
+   ngroups = REgroups(re) ;
+   if (2 * ngroups > gv_size) {
+      if (gv) zfree(gv, gv_size * sizeof(ptrdiff_t)) ;
+      gv_size = 2 * ngroups ;
+      gv = (ptrdiff_t *) zmalloc(gv_size * sizeof(ptrdiff_t)) ;
+   }
+
+   cell_destroy(RSTART) ;
+   cell_destroy(RLENGTH) ;
+   RSTART->type = C_DOUBLE ;
+   RLENGTH->type = C_DOUBLE ;
+   array_clear(A) ;
+
+   p = REmatch_groups(string(sp)->str, string(sp)->len, re, &length, gv) ;
+
+   if (p)
+   {
+      const char* str = string(sp)->str ;
+      int n ;
+      sp->dval = (double) (p - str + 1) ;
+      RLENGTH->dval = (double) length ;
+      set_group(A, 0, str, p - str, length) ;
+      for(n = 1; n <= ngroups; n++) {
+	 if (gv[2*n-2] >= 0) {
+	    set_group(A, n, str, gv[2*n-2], gv[2*n-1] - gv[2*n-2]) ;
+	 }
+      }
+   }
+   else
+   {
+      sp->dval = 0.0 ;
+      RLENGTH->dval = -1.0 ;	 /* posix */
+   }
+
+   free_STRING(string(sp)) ;
+   sp->type = C_DOUBLE ;
+
+   RSTART->dval = sp->dval ;
+
+   return sp ;
+}
+
+/*
+  asort(A), asort(A,D) and asort(A,D,how), and the same for asorti.
+  sp[0] holds the number of args, A is in sp[-n_args], then D and how.
+  D[1..n] = the values (asort) or indices (asorti) of A in order how,
+  D is A if omitted.  Returns n.
+*/
+
+static CELL *
+asort_common(CELL* sp, int indices)
+{
+   int n_args = sp->type ;
+   const char* name = indices ? "asorti" : "asort" ;
+   int order = indices ? AL_IND_STR : AL_VAL_TYPE ;
+   ARRAY A, D ;
+
+   sp -= n_args ;
+   A = (ARRAY) sp[0].ptr ;
+   D = n_args > 1 ? (ARRAY) sp[1].ptr : A ;
+   if (n_args == 3)
+   {
+      int how ;
+      if (sp[2].type < C_STRING)  cast1_to_s(sp + 2) ;
+      how = array_order(string(sp + 2)->str) ;
+      if (how < 0)
+	 rt_error("%s: unknown order \"%s\"", name, string(sp + 2)->str) ;
+      if (how != AL_UNSORTED)  order = how ;
+      free_STRING(string(sp + 2)) ;
+   }
+
+   sp->type = C_DOUBLE ;
+   sp->dval = (double) array_sort(A, D, order, indices) ;
+   return sp ;
+}
+
+CELL *
+bi_asort(CELL* sp)
+{
+   return asort_common(sp, 0) ;
+}
+
+CELL *
+bi_asorti(CELL* sp)
+{
+   return asort_common(sp, 1) ;
+}
+
+/*
+  writea(file, A) and reada(file, A).
+  sp[0] holds A and sp[-1] the file name.
+  writea writes A to the file, reada makes A the array in the file,
+  see array_dump() and array_attach().  Return 1, or 0 on failure.
+*/
+
+static CELL *
+rwarray_common(CELL* sp, int (*f)(ARRAY, const char*))
+{
+   ARRAY A = (ARRAY) sp->ptr ;
+   int ok ;
+
+   sp-- ;
+   if (sp->type < C_STRING)  cast1_to_s(sp) ;
+   ok = (*f)(A, string(sp)->str) ;
+   free_STRING(string(sp)) ;
+   sp->type = C_DOUBLE ;
+   sp->dval = (double) ok ;
+   return sp ;
+}
+
+CELL *
+bi_writea(CELL* sp)
+{
+   return rwarray_common(sp, array_dump) ;
+}
+
+CELL *
+bi_reada(CELL* sp)
+{
+   return rwarray_common(sp, array_attach) ;
+}
+
 CELL *
 bi_toupper(CELL* sp)
 {
@@ -32,10 +32,16 @@ CELL * bi_length(CELL *) ;
 CELL* bi_alength(CELL*) ;   /* length/size of an array */
 CELL * bi_index(CELL *) ;
 CELL * bi_substr(CELL *) ;
+CELL * bi_substr_slice(CELL *) ;
 CELL * bi_sprintf(CELL *) ;
 CELL * bi_sprintf1(CELL *) ;
 CELL * bi_split(CELL *) ;
 CELL * bi_match(CELL *) ;
+CELL * bi_match3(CELL *) ;
+CELL * bi_asort(CELL *) ;
+CELL * bi_asorti(CELL *) ;
+CELL * bi_writea(CELL *) ;
+CELL * bi_reada(CELL *) ;
 CELL * bi_getline(CELL *) ;
 CELL * bi_sub(CELL *) ;
 CELL * bi_gsub(CELL *) ;
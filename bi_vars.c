@@ -26,6 +26,7 @@ you agree to not name that product mawk.
 
 /* the builtin variables */
 CELL  bi_vars[NUM_BI_VAR] ;
+ARRAY procinfo ;
 
 /* the order here must match the order in bi_vars.h */
 
@@ -61,6 +62,11 @@ void  bi_vars_init(void)
   s = insert("ENVIRON") ;
   s->type = ST_ENV ;
 
+  if (!traditional_flag) {
+    s = insert("PROCINFO") ;
+    s->type = ST_PROCINFO ;
+  }
+
   /* set defaults */
 
   FILENAME->type = C_STRING ;
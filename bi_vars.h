@@ -45,5 +45,8 @@ you agree to not name that product mawk.
 
 extern CELL bi_vars[NUM_BI_VAR] ;
 
+/* PROCINFO[], zero until the program uses it */
+extern struct array* procinfo ;
+
 
 #endif
@@ -32,7 +32,7 @@ Peter Miller 2/5/2026 added "fast path" to cast1_to_s().
 
 
 int mpow2[NUM_CELL_TYPES] =
-{1, 2, 4, 8, 16, 32, 64, 128, 256, 512} ;
+{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024} ;
 
 
 /* modern strtod accepts "inf" "nan" and hex numbers
@@ -113,6 +113,14 @@ cast1_to_d(CELL* cp)
 	 return ;
 
       case C_MBSTRN:
+	 /* usually a number, which check_strnum() may have cached */
+	 check_strnum(cp) ;
+	 if (cp->type == C_STRNUM) {
+	    free_STRING(string(cp)) ;
+	    break ;
+	 }
+	 /* fall thru */
+
       case C_STRING:
 	 {
 	    STRING* sval = (STRING *) cp->ptr ;
@@ -150,6 +158,62 @@ STRING*  slow_convfmt(const char* conv, double d, size_t need)
     return ret ;
 }
 
+/* The same numbers are converted over and over, e.g. keys built
+   from computed values, so the last few conversions are kept in a
+   direct mapped table, keyed by the bits of the double.  Integers
+   don't use CONVFMT, the other entries were made with num_str_fmt
+   and go when it changes.  num_str_fmt holds a reference, so a new
+   CONVFMT can't have the same address.
+*/
+
+#define	 NUM_STR_CACHE	256	/* a power of 2 */
+
+static struct num_str_entry {
+    uint64_t bits ;
+    STRING *sval ;
+} num_str_cache[NUM_STR_CACHE] ;
+
+static STRING *num_str_fmt ;
+
+static struct num_str_entry *
+num_str_entry(double d, uint64_t *bits)
+{
+    memcpy(bits, &d, sizeof(double)) ;
+    return num_str_cache +
+	((*bits * 0x9e3779b97f4a7c15u) >> 32 & (NUM_STR_CACHE - 1)) ;
+}
+
+static STRING *
+num_str_find(double d)
+{
+    uint64_t bits ;
+    struct num_str_entry *p = num_str_entry(d, &bits) ;
+
+    if (!is_int_double(d) && string(CONVFMT) != num_str_fmt) {
+	for (p = num_str_cache; p < num_str_cache + NUM_STR_CACHE; p++) {
+	    if (p->sval) {
+		free_STRING(p->sval) ;
+		p->sval = 0 ;
+	    }
+	}
+	if (num_str_fmt)  free_STRING(num_str_fmt) ;
+	num_str_fmt = STRING_dup(string(CONVFMT)) ;
+	return 0 ;
+    }
+    return p->sval && p->bits == bits ? p->sval : 0 ;
+}
+
+static void
+num_str_save(double d, STRING *sval)
+{
+    uint64_t bits ;
+    struct num_str_entry *p = num_str_entry(d, &bits) ;
+
+    if (p->sval)  free_STRING(p->sval) ;
+    p->bits = bits ;
+    p->sval = STRING_dup(sval) ;
+}
+
 void
 cast1_to_s(CELL* cp)
 {
@@ -162,6 +226,11 @@ cast1_to_s(CELL* cp)
       {
         char buffer[1024] ;
 	    double d = cp->dval ;
+	    STRING *hit = num_str_find(d) ;
+	    if (hit) {
+	       cp->ptr = STRING_dup(hit) ;
+	       break ;
+	    }
 	    if (is_int_double(d)) 
 			{int64_t di=(int64_t) d;
 #if 1 /* PMi: new code with fast "shortcut" - uses routines from ya-dconvert.h, deals quickly with integers -10,000,000 <int<100,000,000, the rest are handled by ya_sprintf - both fast paths combined give 45 % reduction in test time for createcsvbig_print-cast.awk giving 4.4* overall vs 2v0 */
@@ -270,6 +339,7 @@ cast1_to_s(CELL* cp)
 	      	}
 #endif	      	
          }
+	    num_str_save(d, string(cp)) ;
 	   break ;
       }
 
@@ -344,8 +414,8 @@ cast_for_split(CELL* cp)
 
 */
 
-void
-check_strnum(CELL* cp)
+static void
+test_strnum(CELL* cp)
 {
     unsigned char *test ;
     char** tp = (char**)&test ;
@@ -395,6 +465,41 @@ check_strnum(CELL* cp)
    }
 }
 
+/* A field is usually tested several times, e.g.
+      $3 > 0 { s += $3 ; if ($3 > m) m = $3 }
+   so the results of test_strnum() for the last few STRINGs are
+   kept.  An entry holds a reference to its STRING, so while it is
+   there the STRING can't be freed and reused, or appended to
+   in place, and the same pointer means the same value.
+*/
+
+#define	 STRNUM_CACHE  64	/* a power of 2 */
+
+static struct strnum_entry {
+    STRING *sval ;
+    int type ;
+    double dval ;
+} strnum_cache[STRNUM_CACHE] ;
+
+void
+check_strnum(CELL* cp)
+{
+    STRING *sval = string(cp) ;
+    struct strnum_entry *p =
+	strnum_cache + (((size_t) sval >> 4) & (STRNUM_CACHE - 1)) ;
+
+    if (p->sval == sval) {
+	cp->type = p->type ;
+	cp->dval = p->dval ;
+	return ;
+    }
+    test_strnum(cp) ;
+    if (p->sval)  free_STRING(p->sval) ;
+    p->sval = STRING_dup(sval) ;
+    p->type = cp->type ;
+    p->dval = cp->dval ;
+}
+
 /* cast a CELL to a replacement cell */
 
 void
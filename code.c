@@ -15,6 +15,7 @@ you agree to not name that product mawk.
 
 
 
+#define  ZTAG  ZT_CODE
 #include "mawk.h"
 #include "code.h"
 #include "init.h"
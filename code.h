@@ -125,6 +125,8 @@ enum {
     F_MOD_ASG,
     F_POW_ASG,
     _CAT,
+    _CATN,
+    _APPEND,
     _BUILTIN,
     _PRINT,
     _POST_INC,
@@ -149,6 +151,7 @@ enum {
     _MATCH0,
     _MATCH1,
     _MATCH2,
+    _RMATCH,
     _EXIT,
     _EXIT0,
     _NEXT,
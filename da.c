@@ -232,6 +232,15 @@ da(INST* start, FILE* fp)
 	    p++ ;
 	    break ;
 
+	 case _RMATCH:
+	    {
+	        const RULE_RE* r = (const RULE_RE*) p++->ptr ;
+	        fprintf(fp, "rmatch\t%u\t", r->idx) ;
+		visible_string(fp, re_uncompile(r->re), '/') ;
+		fputc('\n', fp) ;
+	    }
+	    break ;
+
 	 case _PUSHA:
 	    fprintf(fp, "pusha\t%s\n",
 		    reverse_find(ST_VAR, &p++->ptr)) ;
@@ -408,6 +417,14 @@ da(INST* start, FILE* fp)
 	    fprintf(fp,"a_cat\t%d\n", p++->op) ;
 	    break ;
 
+	 case _CATN:
+	    fprintf(fp, "catn\t%d\n", p++->op) ;
+	    break ;
+
+	 case _APPEND:
+	    fprintf(fp, "append\t%d\n", p++->op) ;
+	    break ;
+
 	 case _CALL:
 	    fprintf(fp, "call\t%s\t%d\n",
 		    ((FBLOCK *) p->ptr)->name, p[1].op) ;
@@ -450,6 +467,12 @@ special_cases[] =
     { bi_length, "length"} ,
     { bi_alength, "alength"} ,
     { bi_match, "match" } ,
+    { bi_match3, "match" } ,
+    { bi_substr_slice, "substr" } ,
+    { bi_asort, "asort" } ,
+    { bi_asorti, "asorti" } ,
+    { bi_writea, "writea" } ,
+    { bi_reada, "reada" } ,
     { bi_getline, "getline" } ,
     { bi_sub, "sub" } ,
     { bi_gsub, "gsub" } ,
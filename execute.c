@@ -57,6 +57,14 @@ CELL eval_stack[EVAL_STACK_SIZE] ;
 static CELL *stack_base = eval_stack ;
 static CELL *stack_danger = eval_stack + DANGER ;
 
+/* over the -W memory budget, write arrays to disk, but not while
+   the stack has moved as array_spill() only looks at eval_stack.
+   Here too a -W memstats report asked for by SIGUSR1 is printed */
+#define	 check_budget()	\
+	 if (mem_stats_signal)	mem_stats(stderr) ;\
+	 if (mem_used > mem_budget && stack_base == eval_stack)\
+	    array_spill(eval_stack, sp)
+
 #ifdef	DEBUG
 static void
 eval_overflow(void)
@@ -87,6 +95,24 @@ INST *next_label ;
 static CELL tc ;		 /*useful temp */
 static CELL unused ;             /*unuseful rarely used temp */
 
+/* the characters of an operand of cat, which is cast to a string
+   unless it is a C_SLICE, see bi_substr_slice() */
+static const char *
+cat_string(CELL *cp, size_t *lenp)
+{
+   if (cp->type == C_SLICE)
+   {
+      SLICE s ;
+
+      slice_get(cp, s) ;
+      *lenp = s.len ;
+      return string(cp)->str + s.off ;
+   }
+   if (cp->type < C_STRING)  cast1_to_s(cp) ;
+   *lenp = string(cp)->len ;
+   return string(cp)->str ;
+}
+
 void
 execute(
    INST *cdp ,		 /* code ptr, start execution here */
@@ -407,6 +433,7 @@ execute(
 	 case  ALOOP :
 	    {
 	       ALoop* al = aloop_stack ;
+	       check_budget() ;
 	       if (aloop_next(al)) {
 	           /* execute body of loop */
 		   cdp += cdp->op ;
@@ -430,6 +457,7 @@ execute(
 	 case _POP:
 	    cell_destroy(sp) ;
 	    sp-- ;
+	    check_budget() ;
 	    break ;
 
 	 case _ASSIGN:
@@ -774,16 +802,13 @@ execute(
 
 	 case _CAT:
 	    {
-	       unsigned len1, len2 ;
-	       char *str1, *str2 ;
+	       size_t len1, len2 ;
+	       const char *str1, *str2 ;
 	       STRING *b ;
 
 	       sp-- ;
-	       if (TEST2(sp) != TWO_STRINGS)  cast2_to_s(sp) ;
-	       str1 = string(sp)->str ;
-	       len1 = string(sp)->len ;
-	       str2 = string(sp + 1)->str ;
-	       len2 = string(sp + 1)->len ;
+	       str1 = cat_string(sp, &len1) ;
+	       str2 = cat_string(sp + 1, &len2) ;
 
 	       b = new_STRING0(len1 + len2) ;
 	       memcpy(b->str, str1, len1) ;
@@ -791,10 +816,94 @@ execute(
 	       free_STRING(string(sp)) ;
 	       free_STRING(string(sp + 1)) ;
 
+	       sp->type = C_STRING ;
 	       sp->ptr = (PTR) b ;
 	       break ;
 	    }
 
+	 case _CATN:
+	    /* a b c ... , the operand is the number of strings */
+	    {
+	       int n = cdp++->op ;
+	       size_t len = 0, k ;
+	       const char *s ;
+	       STRING *b ;
+	       char *q ;
+
+	       sp -= n - 1 ;
+	       for (cp = sp; cp < sp + n; cp++)
+	       {
+		  cat_string(cp, &k) ;
+		  len += k ;
+	       }
+	       b = new_STRING0(len) ;
+	       q = b->str ;
+	       for (cp = sp; cp < sp + n; cp++)
+	       {
+		  s = cat_string(cp, &k) ;
+		  memcpy(q, s, k) ;
+		  q += k ;
+		  free_STRING(string(cp)) ;
+	       }
+	       sp->type = C_STRING ;
+	       sp->ptr = (PTR) b ;
+	       break ;
+	    }
+
+	 case _APPEND:
+	    /* v = v x y ... , the operand is the number of strings on
+	       top of the stack, below them is the address of v.
+	       If v holds the only reference to its string, they are
+	       added in place, see STRING_SIZE() */
+	    {
+	       int n = cdp++->op ;
+	       size_t len1, len, k ;
+	       const char *s ;
+	       STRING *b ;
+	       char *q ;
+
+	       sp -= n ;
+	       len = 0 ;
+	       for (cp = sp + 1; cp <= sp + n; cp++)
+	       {
+		  cat_string(cp, &k) ;
+		  len += k ;
+	       }
+	       cp = (CELL *) sp->ptr ;
+	       if (cp->type < C_STRING)  cast1_to_s(cp) ;
+	       else  cp->type = C_STRING ;
+	       b = string(cp) ;
+	       len1 = b->len ;
+	       len += len1 ;
+	       if (b->ref_cnt == 1)
+	       {
+		  if (STRING_SIZE(len) != STRING_SIZE(len1))
+		     b = (STRING *) zrealloc_t(b, STRING_SIZE(len1),
+					       STRING_SIZE(len), ZT_STRING) ;
+	       }
+	       else
+	       {
+		  STRING *old = b ;
+		  b = new_STRING0(len) ;
+		  memcpy(b->str, old->str, len1) ;
+		  free_STRING(old) ;
+	       }
+	       cp->ptr = (PTR) b ;
+	       q = b->str + len1 ;
+	       for (cp = sp + 1; cp <= sp + n; cp++)
+	       {
+		  s = cat_string(cp, &k) ;
+		  memcpy(q, s, k) ;
+		  q += k ;
+		  free_STRING(string(cp)) ;
+	       }
+	       b->len = len ;
+	       b->str[len] = 0 ;
+	       sp->type = C_STRING ;
+	       sp->ptr = (PTR) STRING_dup(b) ;
+	       break ;
+	    }
+
 	 case _PUSHINT:
 	    inc_sp() ;
 	    sp->type = cdp++->op ;
@@ -1000,6 +1109,23 @@ execute(
 	    sp->dval = t ? 1.0 : 0.0 ;
 	    break ;
 
+	 case _RMATCH:
+	    /* main rule pattern, does $0 match the plain string at cdp?
+	       all of these are tested by one scan of $0, see re_cmpl.c */
+	    inc_sp() ;
+	    if (field->type >= C_STRING) {
+	       t = rule_test(string(field), cdp++->ptr) ;
+	    }
+	    else {
+	       cellcpy(sp, field) ;
+	       cast1_to_s(sp) ;
+	       t = rule_test(string(sp), cdp++->ptr) ;
+	       free_STRING(string(sp)) ;
+	    }
+	    sp->type = C_DOUBLE ;
+	    sp->dval = t ? 1.0 : 0.0 ;
+	    break ;
+
 	 case A_TEST:
 	    /* entry :	sp[0].ptr-> an array
 		    sp[-1]  is an expression
@@ -1046,14 +1172,14 @@ execute(
 	    cdp = end_start ;
 	    end_start = (INST *) 0 ;	 /* makes sure next exit exits */
 
-	    if (begin_start)  zfree(begin_start, begin_size) ;
-	    if (main_start)  zfree(main_start, main_size) ;
+	    if (begin_start)  zfree_t(begin_start, begin_size, ZT_CODE) ;
+	    if (main_start)  zfree_t(main_start, main_size, ZT_CODE) ;
 	    sp = eval_stack - 1 ;/* might be in user function */
 	    CLEAR_ALOOP_STACK() ; /* ditto */
 	    break ;
 
 	 case _JMAIN:		/* go from BEGIN code to MAIN code */
-	    zfree(begin_start, begin_size) ;
+	    zfree_t(begin_start, begin_size, ZT_CODE) ;
 	    begin_start = (INST *) 0 ;
 	    cdp = main_start ;
 	    break ;
@@ -1087,7 +1213,7 @@ execute(
 		  if (!end_start)  mawk_exit(0) ;
 
 		  cdp = end_start ;
-		  zfree(main_start, main_size) ;
+		  zfree_t(main_start, main_size, ZT_CODE) ;
 		  main_start = end_start = (INST *) 0 ;
 	       }
 	       else
@@ -1095,6 +1221,7 @@ execute(
 		  set_field0(p, len) ;
 		  cdp = restart_label ;
 		  rt_nr++ ; rt_fnr++ ;
+		  check_budget() ;
 	       }
 	    }
 	    break ;
@@ -1111,7 +1238,7 @@ execute(
 		  if (!end_start)  mawk_exit(0) ;
 
 		  cdp = end_start ;
-		  zfree(main_start, main_size) ;
+		  zfree_t(main_start, main_size, ZT_CODE) ;
 		  main_start = end_start = (INST *) 0 ;
 	       }
 	       else
@@ -1123,6 +1250,7 @@ execute(
 
 		  NR->dval += 1.0 ; rt_nr++ ;
 		  FNR->dval += 1.0 ; rt_fnr++ ;
+		  check_budget() ;
 	       }
 	    }
 	    break ;
@@ -1231,7 +1359,7 @@ execute(
 			if (sp >= local_p)
 			{
 			   array_clear((ARRAY)(sp->ptr)) ;
-			   ZFREE((ARRAY)sp->ptr) ;
+			   zfree_t(sp->ptr, sizeof(struct array), ZT_ARRAY) ;
 			}
 		     }
 		     else  cell_destroy(sp) ;
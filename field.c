@@ -206,11 +206,25 @@ field_init(void)
     string(OFMT)->ref_cnt++;
 }
 
+/* $0 is remade for every record.  If nothing else took a reference
+   to the last one, its STRING is reused when the new record needs
+   the same STRING_SIZE(), instead of being freed and allocated again */
+
 void
 set_field0(const char *s, size_t len)
 {
-    cell_destroy(&field[0]);
     nf = -1;
+    if (field[0].type == C_MBSTRN && len > 1) {
+	STRING *sval = string(field);
+
+	if (sval->ref_cnt == 1 && STRING_SIZE(len) == STRING_SIZE(sval->len)) {
+	    memmove(sval->str, s, len);
+	    sval->str[len] = 0;
+	    sval->len = len;
+	    return;
+	}
+    }
+    cell_destroy(&field[0]);
 
     if (len) {
 	field[0].type = C_MBSTRN;
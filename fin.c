@@ -16,6 +16,7 @@ you agree to not name that product mawk.
 
 /* fin.c */
 
+#define  ZTAG  ZT_FIN
 #include "mawk.h"
 #include "fin.h"
 #include "memory.h"
@@ -48,6 +49,7 @@ FINdopen(int fd, int main_flag)
    fin->flags = main_flag ? (MAIN_FLAG | START_FLAG) : START_FLAG ;
    fin->end = fin->start = fin->buff = (char *) emalloc(FINBUFFSZ) ;
    fin->buffsz = FINBUFFSZ ;
+   zcount(ZT_FIN, 0, FINBUFFSZ) ;
 
    if ((isatty(fd) && rs_shadow.type == SEP_CHAR && rs_shadow.c == '\n')
        || (interactive_flag && fd == 0) )
@@ -132,6 +134,7 @@ FINsemi_close(FIN* fin)
 
     if (fin->buff != &dead) {
         free(fin->buff) ;
+	zcount(ZT_FIN, fin->buffsz, 0) ;
 	fin->buff = &dead ;
 	/* belt and suspenders */
 	fin->start = fin->end = fin->buff ;
@@ -230,6 +233,7 @@ restart :
 			 //fprintf(stderr,"Line buffering input: growing buffer from %zu to %zu\n",oldsize,newsize);
 			 fin->start = fin->buff = (char *) erealloc(fin->buff, newsize) ;/* expand size of buffer, leaving original contentes intact */
 			 fin->buffsz = newsize ;
+			 zcount(ZT_FIN, oldsize, newsize) ;
 			 //fprintf(stderr,"line buffering input: reading another %zu characters\n",delta);
 			 fgets(fin->buff+strlen_sofar, (int)delta, fin->fp); /* get more of the line - note delta is limited to 256k so as long as ints are >=32 bits this will not overflow */
 			 p=fin->buff; /* start scaning at start of line again */
@@ -385,6 +389,7 @@ enlarge_fin_buffer(FIN* fin)
    fin->start =
       fin->buff = (char *) erealloc(fin->buff, newsize) ;
    fin->buffsz = newsize ;
+   zcount(ZT_FIN, oldsize, newsize) ;
 
    r = fillbuff(fin->fd, fin->buff + oldsize, delta) ;
    if (r < delta)  fin->flags |= EOF_FLAG ;
@@ -21,22 +21,104 @@ you agree to not name that product mawk.
 #include "symtype.h"
 
 /*
- * FNV-1a hash function
- * http://www.isthe.com/chongo/tech/comp/fnv/index.html
+ * 64 bit hash of s[0..len), used for array subscripts and the
+ * symbol table.  The input is read 8 bytes at a time and mixed with
+ * a 64x64 -> 128 bit multiply folded to 64 bits, as in wyhash.
+ * Long keys are hashed on two independent lanes.
  */
-unsigned
-hash(const char *s)
+
+#define HK0  0xa0761d6478bd642fULL
+#define HK1  0xe7037ed1a0b428dbULL
+#define HK2  0x8ebc6af09c88c6e3ULL
+#define HK3  0x589965cc75374cc3ULL
+
+static uint64_t
+hmix(uint64_t a, uint64_t b)
 {
-    /* FNV-1a */
-    register unsigned h = 2166136261U;
+#ifdef __SIZEOF_INT128__
+    __uint128_t r = (__uint128_t) a * b;
+    return (uint64_t) r ^ (uint64_t) (r >> 64);
+#else
+    uint64_t ha = a >> 32, la = (uint32_t) a;
+    uint64_t hb = b >> 32, lb = (uint32_t) b;
+    uint64_t m0 = ha * lb, m1 = la * hb;
+    uint64_t lo = la * lb;
+    uint64_t t = lo + (m0 << 32);
+    uint64_t hi = ha * hb + (m0 >> 32) + (m1 >> 32) + (t < lo);
+    lo = t + (m1 << 32);
+    hi += lo < t;
+    return lo ^ hi;
+#endif
+}
 
-    while (*s) {
-	h ^= (unsigned char) (*s++);
-	h *= 16777619U;
+static uint64_t
+rd64(const unsigned char *p)
+{
+    uint64_t x;
+    memcpy(&x, p, 8);
+    return x;
+}
+
+static uint64_t
+rd32(const unsigned char *p)
+{
+    uint32_t x;
+    memcpy(&x, p, 4);
+    return x;
+}
+
+uint64_t
+hash64(const char *s, size_t len)
+{
+    const unsigned char *p = (const unsigned char *) s;
+    size_t n = len;
+    uint64_t h = HK0 ^ len;
+    uint64_t a, b;
+
+    if (n > 32) {
+	uint64_t g = h ^ HK2;
+	do {
+	    h = hmix(rd64(p) ^ HK1, rd64(p + 8) ^ h);
+	    g = hmix(rd64(p + 16) ^ HK3, rd64(p + 24) ^ g);
+	    p += 32;
+	    n -= 32;
+	} while (n > 32);
+	h ^= g;
     }
-    return h;
+    while (n > 16) {
+	h = hmix(rd64(p) ^ HK1, rd64(p + 8) ^ h);
+	p += 16;
+	n -= 16;
+    }
+    /* the last 1 to 16 bytes, loads may overlap */
+    if (n >= 8) {
+	a = rd64(p);
+	b = rd64(p + n - 8);
+    } else if (n >= 4) {
+	a = rd32(p);
+	b = rd32(p + n - 4);
+    } else if (n > 0) {
+	a = ((uint64_t) p[0] << 16) | ((uint64_t) p[n >> 1] << 8) | p[n - 1];
+	b = 0;
+    } else {
+	a = b = 0;
+    }
+    h = hmix(a ^ HK1, b ^ h);
+    return hmix(h ^ HK2, len ^ HK3);
 }
 
+unsigned
+hash(const char *s)
+{
+    return (unsigned) hash64(s, strlen(s));
+}
+
+/*
+ * FNV-1a hash function
+ * http://www.isthe.com/chongo/tech/comp/fnv/index.html
+ * only used by srand(), so a string seed gives the same
+ * sequence as it always has
+ */
 unsigned
 hash2(const char *s, size_t len)
 {
@@ -31,8 +31,12 @@ static void  process_cmdline(int, char **) ;
 static void  set_ARGV(int, char **, int) ;
 static void  bad_option(const char *) ;
 static void  no_program(void) ;
+static int   is_option(const char *, const char *) ;
 static void  print_help(void) ;
 static void  catch_fpe(int) ;
+#ifdef SIGUSR1
+static void  catch_usr1(int) ;
+#endif
 
 extern void  print_version(void) ;
 extern int  is_cmdline_assign(char *) ;
@@ -116,6 +120,19 @@ no_program(void)
    mawk_exit(0) ;
 }
 
+/* does -W s start with name, compared in either case */
+static int
+is_option(const char* s, const char* name)
+{
+   while (*name)
+   {
+      int c = *s++ ;
+      if (c >= 'A' && c <= 'Z')  c += 'a' - 'A' ;
+      if (c != *name++)  return 0 ;
+   }
+   return 1 ;
+}
+
 #define optarg optarg_			/* remove conflict with optarg in <getopt.h> */
 
 
@@ -226,6 +243,38 @@ process_cmdline(int argc, char** argv)
 	    {  
 	       traditional_flag = 1 ;
 	    }	    
+	    else if (optarg[0] == 'L')
+	    {
+	       RE_linear_flag = 1 ;
+	    }
+	    else if (is_option(optarg, "mems"))
+	    {
+	       /* -W memstats */
+	       mem_stats_flag = 1 ;
+#ifdef SIGUSR1
+	       signal(SIGUSR1, catch_usr1) ;
+#endif
+	    }
+	    else if (optarg[0] == 'M')
+	    {
+	       /* -W memory=size, in megabytes unless it ends in k, m or g */
+	       char *p = strchr(optarg, '=') ;
+	       double x = p ? strtod(p + 1, &p) : 0.0 ;
+
+	       switch (p ? *p : 0)
+	       {
+		  case 'k': case 'K': x *= 1024.0 ; p++ ; break ;
+		  case 'g': case 'G': x *= 1024.0 ; /* fall thru */
+		  case 'm': case 'M': p++ ; /* fall thru */
+		  default: x *= 1024.0 * 1024.0 ; break ;
+	       }
+	       if (!p || *p || x < 1.0 || x >= (double) ((size_t) -1))
+	       {
+		  errmsg(0, "improper size: -W %s", optarg) ;
+		  mawk_exit(2) ;
+	       }
+	       mem_budget = (size_t) x ;
+	    }
 	    else  errmsg(0, "unknown option: -W %s", optarg) ;
 
 
@@ -396,6 +445,16 @@ static void catch_fpe(int x)
     mawk_exit(2) ;
 }
 
+#ifdef SIGUSR1
+/* with -W memstats, kill -USR1 asks for the report, which execute()
+   prints when it next checks the -W memory budget */
+static void catch_usr1(int x)
+{
+    mem_stats_signal = 1 ;
+    signal(x, catch_usr1) ;
+}
+#endif
+
 
 /*   HELP  */
 
@@ -446,6 +505,17 @@ static const char* const help[] = {
 "\t               from stdin.  Records from stdin are lines regardless of",
 "\t               the value of RS.",
 "",
+"\t-W linear      matches all regular expressions in time proportional to",
+"\t               the length of the string, normally only used for those",
+"\t               that could backtrack badly like (a*)*b.",
+"",
+"\t-W memory=size keeps memory use near size megabytes (or use a k, m or g",
+"\t               suffix) by writing large arrays to temporary files.",
+"",
+"\t-W memstats    writes memory use by strings, arrays, regular expressions,",
+"\t               code and input buffers, and by allocation size, to stderr",
+"\t               at exit, and on signal USR1 where there is one.",
+"",
 "\t-W posix       forces mawk not to consider '\\n' to be space and \\\\",
 "\t               is always \\ on the second scan of a replacement string.",
 "",
@@ -453,8 +523,10 @@ static const char* const help[] = {
 "",
 "\t-W version     displays mawk version and exits 0.",
 "",
-"Just the first letter for each option is enough.  For example, -Wv, -W v ",
-"and --v are equivalent to -W version or --version.",
+"Just the first letter for each option is enough, except -W memstats which",
+"needs -W mems.  Any other -W m... is -W memory, which needs its =size,",
+"e.g. -W m=100.  For example, -Wv, -W v and --v are equivalent to",
+"-W version or --version.",
 0 } ;
 
 static void
@@ -22,6 +22,7 @@ you agree to not name that product mawk.
 */
 
 
+#define  ZTAG  ZT_CODE
 #include "mawk.h"
 #include "symtype.h"
 #include "jmp.h"
@@ -59,6 +59,18 @@ keywords[] =
    { 0, 0 }
 } ;
 
+/* keywords not loaded with -W traditional */
+const
+static struct kw
+new_keywords[] =
+{
+   { "asort", ASORT },
+   { "asorti", ASORTI },
+   { "writea", WRITEA },
+   { "reada", READA },
+   { 0, 0 }
+} ;
+
 /* put keywords in the symbol table */
 void
 kw_init(void)
@@ -72,6 +84,13 @@ kw_init(void)
       q->type = ST_KEYWORD ;
       q->stval.kw = p++->kw ;
    }
+
+   for (p = new_keywords; p->text && !traditional_flag; p++)
+   {
+      q = insert(p->text) ;
+      q->type = ST_KEYWORD ;
+      q->stval.kw = p->kw ;
+   }
 }
 
 /* find a keyword to emit an error message */
@@ -82,6 +101,8 @@ find_kw_str(int kw_token)
 
    for (p = keywords; p->text; p++)
       if (p->kw == kw_token)  return p->text ;
+   for (p = new_keywords; p->text; p++)
+      if (p->kw == kw_token)  return p->text ;
    /* search failed */
    return (char *) 0 ;
 }
@@ -70,5 +70,6 @@ mawk_exit(int x)
             x = 2 ;
         }
     }
+    if (mem_stats_flag)  mem_stats(stderr) ;
     exit(x) ;
 }
@@ -48,6 +48,7 @@ extern  int   dump_RE ;
 
 extern  int  posix_space_flag , interactive_flag , traditional_flag;
 extern  int  posix_repl_scan_flag ;
+extern  int  RE_linear_flag ;
 
 /*----------------
  *  GLOBAL VARIABLES
@@ -89,6 +90,15 @@ extern  unsigned rt_nr , rt_fnr ; /* ditto */
 /* macro to get at the string part of a CELL */
 #define string(cp) ((STRING *)(cp)->ptr)
 
+/* a C_SLICE CELL is the len characters of string(cp) from off,
+   which are kept in the bytes of its dval, see bi_substr_slice() */
+typedef struct {
+    int off, len ;
+} SLICE ;
+
+#define slice_set(cp, s)  memcpy(&(cp)->dval, &(s), sizeof(SLICE))
+#define slice_get(cp, s)  memcpy(&(s), &(cp)->dval, sizeof(SLICE))
+
 #ifdef   DEBUG
 #define cell_destroy(cp)  DB_cell_destroy(cp)
 #else
@@ -17,13 +17,53 @@ you agree to not name that product mawk.
 
 /* memory.c */
 
+#define  ZTAG  ZT_STRING
 #include "mawk.h"
 #include "memory.h"
+#include <stdint.h>
 
 STRING null_str =
 {0, 1, ""} ;
 STRING* const the_empty_str = &null_str ;
 
+/* like null_str, the one character strings are shared and never
+   freed, so the most common short values, a flag, a digit or a
+   character from substr() or split(s, A, ""), need no allocation.
+   A ref_cnt starts at 1, so it never drops to 0 */
+
+#define  S1(c)   { 1, 1, { (char) (c), 0 } }
+#define  S4(c)   S1(c), S1((c)+1), S1((c)+2), S1((c)+3)
+#define  S16(c)  S4(c), S4((c)+4), S4((c)+8), S4((c)+12)
+#define  S64(c)  S16(c), S16((c)+16), S16((c)+32), S16((c)+48)
+
+static STRING char_str[256] =
+{ S64(0), S64(64), S64(128), S64(192) } ;
+
+/* Fields are mostly short codes and numbers that repeat from record
+   to record, so the strings of 2 to SHORT_STR_MAX characters made
+   last are kept in a direct mapped table and shared.  The table
+   holds a reference, so a shared string is never grown or changed
+   in place (that needs ref_cnt == 1), and a STRING pointer cached by
+   check_strnum() stays the same for the same text.
+   When the strings don't repeat, a lookup is only a cost, so after
+   a run of SHORT_STR_TRY lookups that nearly all missed, the next
+   SHORT_STR_SKIP short strings are made without the table.
+*/
+
+#define	 SHORT_STR_MAX	  7
+#define	 SHORT_STR_CACHE  1024	/* a power of 2 */
+#define	 SHORT_STR_TRY	  256
+#define	 SHORT_STR_SKIP	  16384
+
+static struct short_str_entry {
+    uint64_t key ;	/* the characters, and the length in byte 7 */
+    STRING *sval ;
+} short_str[SHORT_STR_CACHE] ;
+
+static unsigned short_str_tried ;
+static unsigned short_str_missed ;
+static unsigned short_str_skip ;
+
 static STRING *
 xnew_STRING(size_t len)
 {
@@ -49,6 +89,31 @@ new_STRING0(size_t len)
    }
 }
 
+static STRING *
+short_STRING(const char *s, size_t len)
+{
+    uint64_t key = 0 ;
+    struct short_str_entry *p ;
+
+    memcpy(&key, s, len) ;
+    ((unsigned char *) &key)[7] = (unsigned char) len ;
+    p = short_str +
+	((key * 0x9e3779b97f4a7c15u) >> 32 & (SHORT_STR_CACHE - 1)) ;
+    if (++short_str_tried == SHORT_STR_TRY) {
+	if (short_str_missed >= SHORT_STR_TRY - SHORT_STR_TRY / 8)
+	    short_str_skip = SHORT_STR_SKIP ;
+	short_str_tried = short_str_missed = 0 ;
+    }
+    if (p->key != key) {	/* a key is never 0 */
+	short_str_missed++ ;
+	if (p->sval)  free_STRING(p->sval) ;
+	p->key = key ;
+	p->sval = xnew_STRING(len) ;
+	memcpy(p->sval->str, s, len) ;
+    }
+    return STRING_dup(p->sval) ;
+}
+
 /* memcpy into a STRING */
 
 STRING*
@@ -57,8 +122,16 @@ new_STRING2(const char* s, size_t len)
     if (len == 0) {
         return STRING_dup(the_empty_str) ;
     }
+    else if (len == 1) {
+        return STRING_dup(&char_str[*(const unsigned char *) s]) ;
+    }
     else {
-        STRING* ret = xnew_STRING(len) ;
+        STRING* ret ;
+        if (len <= SHORT_STR_MAX) {
+            if (short_str_skip == 0)  return short_STRING(s, len) ;
+            short_str_skip-- ;
+        }
+        ret = xnew_STRING(len) ;
 	memcpy(ret->str, s, len) ;
 	return ret ;
     }
@@ -73,6 +146,20 @@ new_STRING(const char* s)
     return new_STRING2(s,len) ;
 }
 
+/* STRING_SIZE(len) of a long string, rounded up to an eighth
+   of a power of 2 */
+size_t
+string_size(size_t len)
+{
+    size_t b = STRING_BYTES(len) ;
+    size_t p = 512 ;
+    size_t step ;
+
+    while (p <= b / 2)  p <<= 1 ;
+    step = p / 8 ;
+    return (b + step - 1) / step * step ;
+}
+
 /* compare two strings in manner of strcmp  */
 int STRING_cmp(STRING* s1, STRING* s2) 
 {
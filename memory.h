@@ -36,7 +36,7 @@ void  DB_free_STRING(STRING *) ;
 
 #define  free_STRING(sval)   do { \
                                 if ( -- (sval)->ref_cnt == 0 )\
-                                    zfree(sval, STRING_SIZE((sval)->len)) ;\
+                                    zfree_t(sval, STRING_SIZE((sval)->len), ZT_STRING) ;\
 			     } while(0)
 #endif
 
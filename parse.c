@@ -1,23 +1,22 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* A Bison parser, made by GNU Bison 2.4.1.  */
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
-   
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -28,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -42,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.4.1"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -60,18 +63,12 @@
 /* Pull parsers.  */
 #define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
 
 
-/* Copy the first part of user declarations.  */
 
-/* Line 189 of yacc.c  */
+/* First part of user prologue.  */
 #line 17 "parse.y"
-#if defined(__MSVCRT__) && !defined(__USE_MINGW_ANSI_STDIO)
-#define __USE_MINGW_ANSI_STDIO 1 /* So mingw uses its printf not msvcrt */
-#endif
+
 #include <stdio.h>
 #include "mawk.h"
 #include "symtype.h"
@@ -83,6 +80,7 @@
 #include "field.h"
 #include "files.h"
 #include "printf.h"
+#include "repl.h"
 
 
 #define  YYMAXDEPTH	200
@@ -97,11 +95,16 @@ static void   field_A2I(void) ;
 static void   check_var(SYMTAB *) ;
 static void   check_array(SYMTAB *) ;
 static void   RE_as_arg(void) ;
+static int    x_can_change(INST *, INST *, INST *) ;
+static void   code_assign(int, int) ;
+static void   code_cat(CAT_REC *, int) ;
+static void   code_slice(INST *, INST *) ;
 int REempty(PTR) ;
 
 static int scope ;
 static FBLOCK *active_funct ;
       /* when scope is SCOPE_FUNCT  */
+static CAT_REC last_chain ;  /* the last cat_expr that became an expr */
 
 #define  code_address(x)  if( is_local(x) ) \
 			     code2op(L_PUSHA, (x)->offset) ;\
@@ -117,114 +120,138 @@ static FBLOCK *active_funct ;
 #define  CODE_FE_PUSHA()  code_ptr->ptr = (PTR) 0 ; code1(FE_PUSHA)
 
 
+#line 124 "y.tab.c"
 
-/* Line 189 of yacc.c  */
-#line 121 "y.tab.c"
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-/* Enabling traces.  */
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
 #endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
+#if YYDEBUG
+extern int yydebug;
 #endif
 
-
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     UNEXPECTED = 258,
-     BAD_DECIMAL = 259,
-     NL = 260,
-     SEMI_COLON = 261,
-     LBRACE = 262,
-     RBRACE = 263,
-     LBOX = 264,
-     RBOX = 265,
-     COMMA = 266,
-     IO_OUT = 267,
-     POW_ASG = 268,
-     MOD_ASG = 269,
-     DIV_ASG = 270,
-     MUL_ASG = 271,
-     SUB_ASG = 272,
-     ADD_ASG = 273,
-     ASSIGN = 274,
-     COLON = 275,
-     QMARK = 276,
-     OR = 277,
-     AND = 278,
-     IN = 279,
-     MATCH = 280,
-     GTE = 281,
-     GT = 282,
-     LTE = 283,
-     LT = 284,
-     NEQ = 285,
-     EQ = 286,
-     CAT = 287,
-     GETLINE = 288,
-     MINUS = 289,
-     PLUS = 290,
-     MOD = 291,
-     DIV = 292,
-     MUL = 293,
-     UMINUS = 294,
-     NOT = 295,
-     PIPE = 296,
-     IO_IN = 297,
-     POW = 298,
-     INC_or_DEC = 299,
-     FIELD = 300,
-     DOLLAR = 301,
-     RPAREN = 302,
-     LPAREN = 303,
-     DOUBLE = 304,
-     STRING_ = 305,
-     RE = 306,
-     ID = 307,
-     D_ID = 308,
-     FUNCT_ID = 309,
-     BUILTIN = 310,
-     LENGTH = 311,
-     PRINT = 312,
-     PRINTF = 313,
-     SPLIT = 314,
-     MATCH_FUNC = 315,
-     SUB = 316,
-     GSUB = 317,
-     SPRINTF = 318,
-     DO = 319,
-     WHILE = 320,
-     FOR = 321,
-     BREAK = 322,
-     CONTINUE = 323,
-     IF = 324,
-     ELSE = 325,
-     DELETE = 326,
-     BEGIN = 327,
-     END = 328,
-     EXIT = 329,
-     NEXT = 330,
-     NEXTFILE = 331,
-     RETURN = 332,
-     FUNCTION = 333
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    UNEXPECTED = 258,              /* UNEXPECTED  */
+    BAD_DECIMAL = 259,             /* BAD_DECIMAL  */
+    NL = 260,                      /* NL  */
+    SEMI_COLON = 261,              /* SEMI_COLON  */
+    LBRACE = 262,                  /* LBRACE  */
+    RBRACE = 263,                  /* RBRACE  */
+    LBOX = 264,                    /* LBOX  */
+    RBOX = 265,                    /* RBOX  */
+    COMMA = 266,                   /* COMMA  */
+    IO_OUT = 267,                  /* IO_OUT  */
+    ASSIGN = 268,                  /* ASSIGN  */
+    ADD_ASG = 269,                 /* ADD_ASG  */
+    SUB_ASG = 270,                 /* SUB_ASG  */
+    MUL_ASG = 271,                 /* MUL_ASG  */
+    DIV_ASG = 272,                 /* DIV_ASG  */
+    MOD_ASG = 273,                 /* MOD_ASG  */
+    POW_ASG = 274,                 /* POW_ASG  */
+    QMARK = 275,                   /* QMARK  */
+    COLON = 276,                   /* COLON  */
+    OR = 277,                      /* OR  */
+    AND = 278,                     /* AND  */
+    MATCH = 279,                   /* MATCH  */
+    EQ = 280,                      /* EQ  */
+    NEQ = 281,                     /* NEQ  */
+    LT = 282,                      /* LT  */
+    LTE = 283,                     /* LTE  */
+    GT = 284,                      /* GT  */
+    GTE = 285,                     /* GTE  */
+    CAT = 286,                     /* CAT  */
+    GETLINE = 287,                 /* GETLINE  */
+    PLUS = 288,                    /* PLUS  */
+    MINUS = 289,                   /* MINUS  */
+    MUL = 290,                     /* MUL  */
+    DIV = 291,                     /* DIV  */
+    MOD = 292,                     /* MOD  */
+    NOT = 293,                     /* NOT  */
+    UMINUS = 294,                  /* UMINUS  */
+    IO_IN = 295,                   /* IO_IN  */
+    PIPE = 296,                    /* PIPE  */
+    POW = 297,                     /* POW  */
+    INC_or_DEC = 298,              /* INC_or_DEC  */
+    DOLLAR = 299,                  /* DOLLAR  */
+    LPAREN = 300,                  /* LPAREN  */
+    RPAREN = 301,                  /* RPAREN  */
+    DOUBLE = 302,                  /* DOUBLE  */
+    STRING_ = 303,                 /* STRING_  */
+    RE = 304,                      /* RE  */
+    ID = 305,                      /* ID  */
+    D_ID = 306,                    /* D_ID  */
+    FUNCT_ID = 307,                /* FUNCT_ID  */
+    BUILTIN = 308,                 /* BUILTIN  */
+    LENGTH = 309,                  /* LENGTH  */
+    FIELD = 310,                   /* FIELD  */
+    PRINT = 311,                   /* PRINT  */
+    PRINTF = 312,                  /* PRINTF  */
+    SPLIT = 313,                   /* SPLIT  */
+    MATCH_FUNC = 314,              /* MATCH_FUNC  */
+    SUB = 315,                     /* SUB  */
+    GSUB = 316,                    /* GSUB  */
+    SPRINTF = 317,                 /* SPRINTF  */
+    ASORT = 318,                   /* ASORT  */
+    ASORTI = 319,                  /* ASORTI  */
+    WRITEA = 320,                  /* WRITEA  */
+    READA = 321,                   /* READA  */
+    DO = 322,                      /* DO  */
+    WHILE = 323,                   /* WHILE  */
+    FOR = 324,                     /* FOR  */
+    BREAK = 325,                   /* BREAK  */
+    CONTINUE = 326,                /* CONTINUE  */
+    IF = 327,                      /* IF  */
+    ELSE = 328,                    /* ELSE  */
+    IN = 329,                      /* IN  */
+    DELETE = 330,                  /* DELETE  */
+    BEGIN = 331,                   /* BEGIN  */
+    END = 332,                     /* END  */
+    EXIT = 333,                    /* EXIT  */
+    NEXT = 334,                    /* NEXT  */
+    NEXTFILE = 335,                /* NEXTFILE  */
+    RETURN = 336,                  /* RETURN  */
+    FUNCTION = 337                 /* FUNCTION  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define UNEXPECTED 258
 #define BAD_DECIMAL 259
 #define NL 260
@@ -235,82 +262,82 @@ static FBLOCK *active_funct ;
 #define RBOX 265
 #define COMMA 266
 #define IO_OUT 267
-#define POW_ASG 268
-#define MOD_ASG 269
-#define DIV_ASG 270
+#define ASSIGN 268
+#define ADD_ASG 269
+#define SUB_ASG 270
 #define MUL_ASG 271
-#define SUB_ASG 272
-#define ADD_ASG 273
-#define ASSIGN 274
-#define COLON 275
-#define QMARK 276
+#define DIV_ASG 272
+#define MOD_ASG 273
+#define POW_ASG 274
+#define QMARK 275
+#define COLON 276
 #define OR 277
 #define AND 278
-#define IN 279
-#define MATCH 280
-#define GTE 281
-#define GT 282
+#define MATCH 279
+#define EQ 280
+#define NEQ 281
+#define LT 282
 #define LTE 283
-#define LT 284
-#define NEQ 285
-#define EQ 286
-#define CAT 287
-#define GETLINE 288
+#define GT 284
+#define GTE 285
+#define CAT 286
+#define GETLINE 287
+#define PLUS 288
 #define MINUS 289
-#define PLUS 290
-#define MOD 291
-#define DIV 292
-#define MUL 293
+#define MUL 290
+#define DIV 291
+#define MOD 292
+#define NOT 293
 #define UMINUS 294
-#define NOT 295
+#define IO_IN 295
 #define PIPE 296
-#define IO_IN 297
-#define POW 298
-#define INC_or_DEC 299
-#define FIELD 300
-#define DOLLAR 301
-#define RPAREN 302
-#define LPAREN 303
-#define DOUBLE 304
-#define STRING_ 305
-#define RE 306
-#define ID 307
-#define D_ID 308
-#define FUNCT_ID 309
-#define BUILTIN 310
-#define LENGTH 311
-#define PRINT 312
-#define PRINTF 313
-#define SPLIT 314
-#define MATCH_FUNC 315
-#define SUB 316
-#define GSUB 317
-#define SPRINTF 318
-#define DO 319
-#define WHILE 320
-#define FOR 321
-#define BREAK 322
-#define CONTINUE 323
-#define IF 324
-#define ELSE 325
-#define DELETE 326
-#define BEGIN 327
-#define END 328
-#define EXIT 329
-#define NEXT 330
-#define NEXTFILE 331
-#define RETURN 332
-#define FUNCTION 333
-
-
-
-
+#define POW 297
+#define INC_or_DEC 298
+#define DOLLAR 299
+#define LPAREN 300
+#define RPAREN 301
+#define DOUBLE 302
+#define STRING_ 303
+#define RE 304
+#define ID 305
+#define D_ID 306
+#define FUNCT_ID 307
+#define BUILTIN 308
+#define LENGTH 309
+#define FIELD 310
+#define PRINT 311
+#define PRINTF 312
+#define SPLIT 313
+#define MATCH_FUNC 314
+#define SUB 315
+#define GSUB 316
+#define SPRINTF 317
+#define ASORT 318
+#define ASORTI 319
+#define WRITEA 320
+#define READA 321
+#define DO 322
+#define WHILE 323
+#define FOR 324
+#define BREAK 325
+#define CONTINUE 326
+#define IF 327
+#define ELSE 328
+#define IN 329
+#define DELETE 330
+#define BEGIN 331
+#define END 332
+#define EXIT 333
+#define NEXT 334
+#define NEXTFILE 335
+#define RETURN 336
+#define FUNCTION 337
+
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-
-/* Line 214 of yacc.c  */
-#line 64 "parse.y"
+#line 70 "parse.y"
 
 CELL *cp ;
 SYMTAB *stp ;
@@ -319,56 +346,270 @@ PF_CP  fp ;  /* ptr to a (print/printf) or (sub/gsub) function */
 BI_REC *bip ; /* ptr to info about a builtin */
 FBLOCK  *fbp  ; /* ptr to a function block */
 ARG2_REC *arg2p ;
+CAT_REC  cat ;
 CA_REC   *ca_p  ;
 int   ival ;
 PTR   ptr ;
 
+#line 355 "y.tab.c"
 
-
-/* Line 214 of yacc.c  */
-#line 328 "y.tab.c"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
 
-/* Copy the second part of user declarations.  */
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_UNEXPECTED = 3,                 /* UNEXPECTED  */
+  YYSYMBOL_BAD_DECIMAL = 4,                /* BAD_DECIMAL  */
+  YYSYMBOL_NL = 5,                         /* NL  */
+  YYSYMBOL_SEMI_COLON = 6,                 /* SEMI_COLON  */
+  YYSYMBOL_LBRACE = 7,                     /* LBRACE  */
+  YYSYMBOL_RBRACE = 8,                     /* RBRACE  */
+  YYSYMBOL_LBOX = 9,                       /* LBOX  */
+  YYSYMBOL_RBOX = 10,                      /* RBOX  */
+  YYSYMBOL_COMMA = 11,                     /* COMMA  */
+  YYSYMBOL_IO_OUT = 12,                    /* IO_OUT  */
+  YYSYMBOL_ASSIGN = 13,                    /* ASSIGN  */
+  YYSYMBOL_ADD_ASG = 14,                   /* ADD_ASG  */
+  YYSYMBOL_SUB_ASG = 15,                   /* SUB_ASG  */
+  YYSYMBOL_MUL_ASG = 16,                   /* MUL_ASG  */
+  YYSYMBOL_DIV_ASG = 17,                   /* DIV_ASG  */
+  YYSYMBOL_MOD_ASG = 18,                   /* MOD_ASG  */
+  YYSYMBOL_POW_ASG = 19,                   /* POW_ASG  */
+  YYSYMBOL_QMARK = 20,                     /* QMARK  */
+  YYSYMBOL_COLON = 21,                     /* COLON  */
+  YYSYMBOL_OR = 22,                        /* OR  */
+  YYSYMBOL_AND = 23,                       /* AND  */
+  YYSYMBOL_MATCH = 24,                     /* MATCH  */
+  YYSYMBOL_EQ = 25,                        /* EQ  */
+  YYSYMBOL_NEQ = 26,                       /* NEQ  */
+  YYSYMBOL_LT = 27,                        /* LT  */
+  YYSYMBOL_LTE = 28,                       /* LTE  */
+  YYSYMBOL_GT = 29,                        /* GT  */
+  YYSYMBOL_GTE = 30,                       /* GTE  */
+  YYSYMBOL_CAT = 31,                       /* CAT  */
+  YYSYMBOL_GETLINE = 32,                   /* GETLINE  */
+  YYSYMBOL_PLUS = 33,                      /* PLUS  */
+  YYSYMBOL_MINUS = 34,                     /* MINUS  */
+  YYSYMBOL_MUL = 35,                       /* MUL  */
+  YYSYMBOL_DIV = 36,                       /* DIV  */
+  YYSYMBOL_MOD = 37,                       /* MOD  */
+  YYSYMBOL_NOT = 38,                       /* NOT  */
+  YYSYMBOL_UMINUS = 39,                    /* UMINUS  */
+  YYSYMBOL_IO_IN = 40,                     /* IO_IN  */
+  YYSYMBOL_PIPE = 41,                      /* PIPE  */
+  YYSYMBOL_POW = 42,                       /* POW  */
+  YYSYMBOL_INC_or_DEC = 43,                /* INC_or_DEC  */
+  YYSYMBOL_DOLLAR = 44,                    /* DOLLAR  */
+  YYSYMBOL_LPAREN = 45,                    /* LPAREN  */
+  YYSYMBOL_RPAREN = 46,                    /* RPAREN  */
+  YYSYMBOL_DOUBLE = 47,                    /* DOUBLE  */
+  YYSYMBOL_STRING_ = 48,                   /* STRING_  */
+  YYSYMBOL_RE = 49,                        /* RE  */
+  YYSYMBOL_ID = 50,                        /* ID  */
+  YYSYMBOL_D_ID = 51,                      /* D_ID  */
+  YYSYMBOL_FUNCT_ID = 52,                  /* FUNCT_ID  */
+  YYSYMBOL_BUILTIN = 53,                   /* BUILTIN  */
+  YYSYMBOL_LENGTH = 54,                    /* LENGTH  */
+  YYSYMBOL_FIELD = 55,                     /* FIELD  */
+  YYSYMBOL_PRINT = 56,                     /* PRINT  */
+  YYSYMBOL_PRINTF = 57,                    /* PRINTF  */
+  YYSYMBOL_SPLIT = 58,                     /* SPLIT  */
+  YYSYMBOL_MATCH_FUNC = 59,                /* MATCH_FUNC  */
+  YYSYMBOL_SUB = 60,                       /* SUB  */
+  YYSYMBOL_GSUB = 61,                      /* GSUB  */
+  YYSYMBOL_SPRINTF = 62,                   /* SPRINTF  */
+  YYSYMBOL_ASORT = 63,                     /* ASORT  */
+  YYSYMBOL_ASORTI = 64,                    /* ASORTI  */
+  YYSYMBOL_WRITEA = 65,                    /* WRITEA  */
+  YYSYMBOL_READA = 66,                     /* READA  */
+  YYSYMBOL_DO = 67,                        /* DO  */
+  YYSYMBOL_WHILE = 68,                     /* WHILE  */
+  YYSYMBOL_FOR = 69,                       /* FOR  */
+  YYSYMBOL_BREAK = 70,                     /* BREAK  */
+  YYSYMBOL_CONTINUE = 71,                  /* CONTINUE  */
+  YYSYMBOL_IF = 72,                        /* IF  */
+  YYSYMBOL_ELSE = 73,                      /* ELSE  */
+  YYSYMBOL_IN = 74,                        /* IN  */
+  YYSYMBOL_DELETE = 75,                    /* DELETE  */
+  YYSYMBOL_BEGIN = 76,                     /* BEGIN  */
+  YYSYMBOL_END = 77,                       /* END  */
+  YYSYMBOL_EXIT = 78,                      /* EXIT  */
+  YYSYMBOL_NEXT = 79,                      /* NEXT  */
+  YYSYMBOL_NEXTFILE = 80,                  /* NEXTFILE  */
+  YYSYMBOL_RETURN = 81,                    /* RETURN  */
+  YYSYMBOL_FUNCTION = 82,                  /* FUNCTION  */
+  YYSYMBOL_YYACCEPT = 83,                  /* $accept  */
+  YYSYMBOL_program = 84,                   /* program  */
+  YYSYMBOL_program_block = 85,             /* program_block  */
+  YYSYMBOL_PA_block = 86,                  /* PA_block  */
+  YYSYMBOL_87_1 = 87,                      /* $@1  */
+  YYSYMBOL_88_2 = 88,                      /* $@2  */
+  YYSYMBOL_89_3 = 89,                      /* $@3  */
+  YYSYMBOL_90_4 = 90,                      /* $@4  */
+  YYSYMBOL_91_5 = 91,                      /* $@5  */
+  YYSYMBOL_block = 92,                     /* block  */
+  YYSYMBOL_block_or_separator = 93,        /* block_or_separator  */
+  YYSYMBOL_statement_list = 94,            /* statement_list  */
+  YYSYMBOL_statement = 95,                 /* statement  */
+  YYSYMBOL_separator = 96,                 /* separator  */
+  YYSYMBOL_expr = 97,                      /* expr  */
+  YYSYMBOL_98_6 = 98,                      /* $@6  */
+  YYSYMBOL_99_7 = 99,                      /* $@7  */
+  YYSYMBOL_100_8 = 100,                    /* $@8  */
+  YYSYMBOL_101_9 = 101,                    /* $@9  */
+  YYSYMBOL_cat_expr = 102,                 /* cat_expr  */
+  YYSYMBOL_p_expr = 103,                   /* p_expr  */
+  YYSYMBOL_lvalue = 104,                   /* lvalue  */
+  YYSYMBOL_arglist = 105,                  /* arglist  */
+  YYSYMBOL_args = 106,                     /* args  */
+  YYSYMBOL_builtin = 107,                  /* builtin  */
+  YYSYMBOL_string_comma = 108,             /* string_comma  */
+  YYSYMBOL_mark = 109,                     /* mark  */
+  YYSYMBOL_pmark = 110,                    /* pmark  */
+  YYSYMBOL_printf_args = 111,              /* printf_args  */
+  YYSYMBOL_pr_args = 112,                  /* pr_args  */
+  YYSYMBOL_print_args = 113,               /* print_args  */
+  YYSYMBOL_print_list = 114,               /* print_list  */
+  YYSYMBOL_arg2 = 115,                     /* arg2  */
+  YYSYMBOL_pr_direction = 116,             /* pr_direction  */
+  YYSYMBOL_if_front = 117,                 /* if_front  */
+  YYSYMBOL_else = 118,                     /* else  */
+  YYSYMBOL_do = 119,                       /* do  */
+  YYSYMBOL_while_front = 120,              /* while_front  */
+  YYSYMBOL_for1 = 121,                     /* for1  */
+  YYSYMBOL_for2 = 122,                     /* for2  */
+  YYSYMBOL_for3 = 123,                     /* for3  */
+  YYSYMBOL_array_loop_front = 124,         /* array_loop_front  */
+  YYSYMBOL_field = 125,                    /* field  */
+  YYSYMBOL_split_front = 126,              /* split_front  */
+  YYSYMBOL_split_back = 127,               /* split_back  */
+  YYSYMBOL_asort_or_asorti = 128,          /* asort_or_asorti  */
+  YYSYMBOL_asort_array = 129,              /* asort_array  */
+  YYSYMBOL_asort_back = 130,               /* asort_back  */
+  YYSYMBOL_writea_or_reada = 131,          /* writea_or_reada  */
+  YYSYMBOL_re_arg = 132,                   /* re_arg  */
+  YYSYMBOL_return_statement = 133,         /* return_statement  */
+  YYSYMBOL_getline = 134,                  /* getline  */
+  YYSYMBOL_fvalue = 135,                   /* fvalue  */
+  YYSYMBOL_getline_file = 136,             /* getline_file  */
+  YYSYMBOL_sub_or_gsub = 137,              /* sub_or_gsub  */
+  YYSYMBOL_sub_back = 138,                 /* sub_back  */
+  YYSYMBOL_function_def = 139,             /* function_def  */
+  YYSYMBOL_funct_start = 140,              /* funct_start  */
+  YYSYMBOL_funct_head = 141,               /* funct_head  */
+  YYSYMBOL_f_arglist = 142,                /* f_arglist  */
+  YYSYMBOL_f_args = 143,                   /* f_args  */
+  YYSYMBOL_outside_error = 144,            /* outside_error  */
+  YYSYMBOL_call_args = 145,                /* call_args  */
+  YYSYMBOL_ca_front = 146,                 /* ca_front  */
+  YYSYMBOL_ca_back = 147                   /* ca_back  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
 
 
-/* Line 264 of yacc.c  */
-#line 340 "y.tab.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -376,55 +617,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
-# if YYENABLE_NLS
+# if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -441,11 +733,11 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
 #     endif
 #    endif
 #   endif
@@ -453,8 +745,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -468,111 +760,117 @@ YYID (yyi)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  98
+#define YYFINAL  104
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1351
+#define YYLAST   1477
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  79
+#define YYNTOKENS  83
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  59
+#define YYNNTS  65
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  183
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  364
+#define YYNRULES  200
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  394
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   337
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   333
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -607,748 +905,648 @@ static const yytype_uint8 yytranslate[] =
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
       65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78
+      75,    76,    77,    78,    79,    80,    81,    82
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     8,    10,    12,    15,    17,    18,
-      22,    23,    27,    28,    32,    33,    34,    41,    45,    49,
-      51,    53,    55,    58,    60,    63,    65,    68,    71,    74,
-      76,    79,    82,    84,    86,    88,    92,    96,   100,   104,
-     108,   112,   116,   120,   124,   128,   132,   136,   140,   144,
-     145,   150,   151,   156,   157,   158,   166,   168,   171,   173,
-     175,   177,   181,   183,   187,   191,   195,   199,   203,   207,
-     210,   213,   216,   218,   221,   224,   227,   230,   232,   233,
-     235,   237,   241,   247,   252,   259,   265,   268,   269,   275,
-     281,   288,   297,   298,   300,   302,   306,   309,   313,   317,
-     318,   321,   326,   329,   331,   336,   338,   346,   351,   354,
-     359,   363,   368,   370,   373,   375,   378,   382,   388,   394,
-     400,   407,   415,   419,   426,   429,   431,   434,   441,   444,
-     448,   450,   454,   458,   462,   466,   470,   474,   478,   481,
-     487,   489,   493,   495,   499,   504,   509,   516,   518,   521,
-     525,   528,   532,   534,   537,   540,   544,   549,   551,   553,
-     555,   558,   562,   569,   571,   573,   575,   579,   582,   587,
-     590,   593,   594,   596,   598,   602,   604,   608,   611,   614,
-     616,   620,   624,   627
+       0,   150,   150,   151,   154,   155,   156,   159,   165,   164,
+     171,   170,   177,   176,   193,   209,   192,   222,   224,   230,
+     231,   237,   238,   242,   243,   245,   247,   253,   256,   259,
+     263,   269,   277,   277,   280,   281,   282,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   292,   293,   295,   323,
+     322,   330,   329,   336,   337,   336,   342,   344,   348,   350,
+     352,   360,   364,   368,   369,   370,   371,   372,   373,   374,
+     376,   378,   380,   383,   391,   398,   402,   409,   418,   419,
+     422,   424,   429,   448,   452,   463,   471,   485,   488,   502,
+     510,   520,   533,   538,   543,   544,   548,   555,   556,   557,
+     561,   565,   567,   571,   576,   580,   581,   588,   593,   597,
+     601,   609,   614,   620,   640,   666,   690,   691,   695,   696,
+     713,   717,   730,   735,   746,   759,   771,   788,   796,   807,
+     821,   838,   840,   849,   863,   865,   869,   873,   874,   875,
+     876,   877,   878,   879,   885,   889,   896,   898,   930,   937,
+     938,   941,   948,   949,   950,   955,   963,   964,   973,   978,
+     983,   987,  1035,  1039,  1048,  1071,  1074,  1077,  1080,  1085,
+    1092,  1098,  1103,  1108,  1115,  1117,  1117,  1119,  1123,  1131,
+    1150,  1151,  1155,  1160,  1168,  1177,  1196,  1219,  1226,  1227,
+    1230,  1236,  1249,  1262,  1274,  1276,  1291,  1293,  1300,  1309,
+    1315
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-      80,     0,    -1,    81,    -1,    80,    81,    -1,    82,    -1,
-     129,    -1,   134,    88,    -1,    88,    -1,    -1,    72,    83,
-      88,    -1,    -1,    73,    84,    88,    -1,    -1,    93,    85,
-      89,    -1,    -1,    -1,    93,    11,    86,    93,    87,    89,
-      -1,     7,    90,     8,    -1,     7,     1,     8,    -1,    88,
-      -1,    92,    -1,    91,    -1,    90,    91,    -1,    88,    -1,
-      93,    92,    -1,    92,    -1,     1,    92,    -1,    67,    92,
-      -1,    68,    92,    -1,   123,    -1,    75,    92,    -1,    76,
-      92,    -1,     5,    -1,     6,    -1,    98,    -1,   100,    19,
-      93,    -1,   100,    18,    93,    -1,   100,    17,    93,    -1,
-     100,    16,    93,    -1,   100,    15,    93,    -1,   100,    14,
-      93,    -1,   100,    13,    93,    -1,    93,    31,    93,    -1,
-      93,    30,    93,    -1,    93,    29,    93,    -1,    93,    28,
-      93,    -1,    93,    27,    93,    -1,    93,    26,    93,    -1,
-      93,    25,    93,    -1,    -1,    93,    22,    94,    93,    -1,
-      -1,    93,    23,    95,    93,    -1,    -1,    -1,    93,    21,
-      96,    93,    20,    97,    93,    -1,    99,    -1,    98,    99,
-      -1,    49,    -1,    50,    -1,    52,    -1,    48,    93,    47,
-      -1,    51,    -1,    99,    35,    99,    -1,    99,    34,    99,
-      -1,    99,    38,    99,    -1,    99,    37,    99,    -1,    99,
-      36,    99,    -1,    99,    43,    99,    -1,    40,    99,    -1,
-      35,    99,    -1,    34,    99,    -1,   103,    -1,    52,    44,
-      -1,    44,   100,    -1,   119,    44,    -1,    44,   119,    -1,
-      52,    -1,    -1,   102,    -1,    93,    -1,   102,    11,    93,
-      -1,    55,   105,    48,   101,    47,    -1,    63,   105,    48,
-      47,    -1,    63,   105,    48,   104,   102,    47,    -1,    63,
-     105,    48,   102,    47,    -1,    50,    11,    -1,    -1,    57,
-     106,   108,   110,    92,    -1,    58,   106,   108,   110,    92,
-      -1,    58,   106,   104,   107,   110,    92,    -1,    58,   106,
-      48,   104,   107,    47,   110,    92,    -1,    -1,   102,    -1,
-     101,    -1,    48,   109,    47,    -1,    48,    47,    -1,    93,
-      11,    93,    -1,   109,    11,    93,    -1,    -1,    12,    93,
-      -1,    69,    48,    93,    47,    -1,   111,    91,    -1,    70,
-      -1,   111,    91,   112,    91,    -1,    64,    -1,   113,    91,
-      65,    48,    93,    47,    92,    -1,    65,    48,    93,    47,
-      -1,   114,    91,    -1,   115,   116,   117,    91,    -1,    66,
-      48,     6,    -1,    66,    48,    93,     6,    -1,     6,    -1,
-      93,     6,    -1,    47,    -1,    93,    47,    -1,    93,    24,
-      52,    -1,    48,   109,    47,    24,    52,    -1,    52,   105,
-       9,   102,    10,    -1,    52,   105,     9,   102,    10,    -1,
-      52,   105,     9,   102,    10,    44,    -1,    71,    52,   105,
-       9,   102,    10,    92,    -1,    71,    52,    92,    -1,    66,
-      48,    52,    24,    52,    47,    -1,   118,    91,    -1,    45,
-      -1,    46,    53,    -1,    46,    53,   105,     9,   102,    10,
-      -1,    46,    99,    -1,    48,   119,    47,    -1,   119,    -1,
-     119,    19,    93,    -1,   119,    18,    93,    -1,   119,    17,
-      93,    -1,   119,    16,    93,    -1,   119,    15,    93,    -1,
-     119,    14,    93,    -1,   119,    13,    93,    -1,   120,   121,
-      -1,    59,    48,    93,    11,    52,    -1,    47,    -1,    11,
-      93,    47,    -1,    56,    -1,    56,    48,    47,    -1,    56,
-      48,    93,    47,    -1,    56,    48,    52,    47,    -1,    60,
-      48,    93,    11,   122,    47,    -1,    93,    -1,    74,    92,
-      -1,    74,    93,    92,    -1,    77,    92,    -1,    77,    93,
-      92,    -1,   124,    -1,   124,   125,    -1,   126,    99,    -1,
-      99,    41,    33,    -1,    99,    41,    33,   125,    -1,    33,
-      -1,   100,    -1,   119,    -1,   124,    42,    -1,   124,   125,
-      42,    -1,   127,    48,   122,    11,    93,   128,    -1,    61,
-      -1,    62,    -1,    47,    -1,    11,   125,    47,    -1,   130,
-      88,    -1,   131,    48,   132,    47,    -1,    78,    52,    -1,
-      78,    54,    -1,    -1,   133,    -1,    52,    -1,   133,    11,
-      52,    -1,     1,    -1,    54,   105,   135,    -1,    48,    47,
-      -1,   136,   137,    -1,    48,    -1,   136,    93,    11,    -1,
-     136,    52,    11,    -1,    93,    47,    -1,    52,    47,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   141,   141,   142,   145,   146,   147,   150,   156,   155,
-     162,   161,   168,   167,   175,   191,   174,   204,   206,   212,
-     213,   219,   220,   224,   225,   227,   229,   235,   238,   241,
-     245,   251,   259,   259,   262,   263,   264,   265,   266,   267,
-     268,   269,   270,   271,   272,   273,   274,   275,   277,   305,
-     304,   312,   311,   318,   319,   318,   324,   325,   329,   331,
-     333,   341,   345,   349,   350,   351,   352,   353,   354,   355,
-     357,   359,   361,   364,   372,   379,   383,   390,   399,   400,
-     403,   405,   410,   429,   433,   444,   452,   466,   469,   483,
-     491,   501,   514,   519,   524,   525,   529,   533,   538,   542,
-     543,   550,   555,   559,   563,   571,   576,   582,   602,   628,
-     652,   653,   657,   658,   675,   679,   692,   697,   708,   721,
-     733,   750,   758,   769,   783,   800,   802,   811,   825,   827,
-     831,   835,   836,   837,   838,   839,   840,   841,   847,   851,
-     858,   860,   895,   900,   905,   909,   957,   964,   987,   990,
-     993,   996,  1001,  1008,  1014,  1019,  1024,  1031,  1033,  1033,
-    1035,  1039,  1047,  1066,  1067,  1071,  1076,  1084,  1093,  1112,
-    1135,  1142,  1143,  1146,  1152,  1165,  1178,  1190,  1192,  1207,
-    1209,  1216,  1225,  1231
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "UNEXPECTED", "BAD_DECIMAL", "NL",
-  "SEMI_COLON", "LBRACE", "RBRACE", "LBOX", "RBOX", "COMMA", "IO_OUT",
-  "POW_ASG", "MOD_ASG", "DIV_ASG", "MUL_ASG", "SUB_ASG", "ADD_ASG",
-  "ASSIGN", "COLON", "QMARK", "OR", "AND", "IN", "MATCH", "GTE", "GT",
-  "LTE", "LT", "NEQ", "EQ", "CAT", "GETLINE", "MINUS", "PLUS", "MOD",
-  "DIV", "MUL", "UMINUS", "NOT", "PIPE", "IO_IN", "POW", "INC_or_DEC",
-  "FIELD", "DOLLAR", "RPAREN", "LPAREN", "DOUBLE", "STRING_", "RE", "ID",
-  "D_ID", "FUNCT_ID", "BUILTIN", "LENGTH", "PRINT", "PRINTF", "SPLIT",
-  "MATCH_FUNC", "SUB", "GSUB", "SPRINTF", "DO", "WHILE", "FOR", "BREAK",
-  "CONTINUE", "IF", "ELSE", "DELETE", "BEGIN", "END", "EXIT", "NEXT",
-  "NEXTFILE", "RETURN", "FUNCTION", "$accept", "program", "program_block",
-  "PA_block", "$@1", "$@2", "$@3", "$@4", "$@5", "block",
-  "block_or_separator", "statement_list", "statement", "separator", "expr",
-  "$@6", "$@7", "$@8", "$@9", "cat_expr", "p_expr", "lvalue", "arglist",
-  "args", "builtin", "string_comma", "mark", "pmark", "printf_args",
-  "pr_args", "arg2", "pr_direction", "if_front", "else", "do",
+  "\"end of file\"", "error", "\"invalid token\"", "UNEXPECTED",
+  "BAD_DECIMAL", "NL", "SEMI_COLON", "LBRACE", "RBRACE", "LBOX", "RBOX",
+  "COMMA", "IO_OUT", "ASSIGN", "ADD_ASG", "SUB_ASG", "MUL_ASG", "DIV_ASG",
+  "MOD_ASG", "POW_ASG", "QMARK", "COLON", "OR", "AND", "MATCH", "EQ",
+  "NEQ", "LT", "LTE", "GT", "GTE", "CAT", "GETLINE", "PLUS", "MINUS",
+  "MUL", "DIV", "MOD", "NOT", "UMINUS", "IO_IN", "PIPE", "POW",
+  "INC_or_DEC", "DOLLAR", "LPAREN", "RPAREN", "DOUBLE", "STRING_", "RE",
+  "ID", "D_ID", "FUNCT_ID", "BUILTIN", "LENGTH", "FIELD", "PRINT",
+  "PRINTF", "SPLIT", "MATCH_FUNC", "SUB", "GSUB", "SPRINTF", "ASORT",
+  "ASORTI", "WRITEA", "READA", "DO", "WHILE", "FOR", "BREAK", "CONTINUE",
+  "IF", "ELSE", "IN", "DELETE", "BEGIN", "END", "EXIT", "NEXT", "NEXTFILE",
+  "RETURN", "FUNCTION", "$accept", "program", "program_block", "PA_block",
+  "$@1", "$@2", "$@3", "$@4", "$@5", "block", "block_or_separator",
+  "statement_list", "statement", "separator", "expr", "$@6", "$@7", "$@8",
+  "$@9", "cat_expr", "p_expr", "lvalue", "arglist", "args", "builtin",
+  "string_comma", "mark", "pmark", "printf_args", "pr_args", "print_args",
+  "print_list", "arg2", "pr_direction", "if_front", "else", "do",
   "while_front", "for1", "for2", "for3", "array_loop_front", "field",
-  "split_front", "split_back", "re_arg", "return_statement", "getline",
+  "split_front", "split_back", "asort_or_asorti", "asort_array",
+  "asort_back", "writea_or_reada", "re_arg", "return_statement", "getline",
   "fvalue", "getline_file", "sub_or_gsub", "sub_back", "function_def",
   "funct_start", "funct_head", "f_arglist", "f_args", "outside_error",
-  "call_args", "ca_front", "ca_back", 0
+  "call_args", "ca_front", "ca_back", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    79,    80,    80,    81,    81,    81,    82,    83,    82,
-      84,    82,    85,    82,    86,    87,    82,    88,    88,    89,
-      89,    90,    90,    91,    91,    91,    91,    91,    91,    91,
-      91,    91,    92,    92,    93,    93,    93,    93,    93,    93,
-      93,    93,    93,    93,    93,    93,    93,    93,    93,    94,
-      93,    95,    93,    96,    97,    93,    98,    98,    99,    99,
-      99,    99,    99,    99,    99,    99,    99,    99,    99,    99,
-      99,    99,    99,    99,    99,    99,    99,   100,   101,   101,
-     102,   102,   103,   103,   103,   103,   104,   105,    91,    91,
-      91,    91,   106,   107,   108,   108,   108,   109,   109,   110,
-     110,   111,    91,   112,    91,   113,    91,   114,    91,    91,
-     115,   115,   116,   116,   117,   117,    93,    93,   100,    99,
-      99,    91,    91,   118,    91,   119,   119,   119,   119,   119,
-      99,    93,    93,    93,    93,    93,    93,    93,    99,   120,
-     121,   121,    99,    99,    99,    99,    99,   122,    91,    91,
-     123,   123,    99,    99,    99,    99,    99,   124,   125,   125,
-     126,   126,    99,   127,   127,   128,   128,   129,   130,   131,
-     131,   132,   132,   133,   133,   134,    99,   135,   135,   136,
-     136,   136,   137,   137
-};
+#define YYPACT_NINF (-236)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-125)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
 {
-       0,     2,     1,     2,     1,     1,     2,     1,     0,     3,
-       0,     3,     0,     3,     0,     0,     6,     3,     3,     1,
-       1,     1,     2,     1,     2,     1,     2,     2,     2,     1,
-       2,     2,     1,     1,     1,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     0,
-       4,     0,     4,     0,     0,     7,     1,     2,     1,     1,
-       1,     3,     1,     3,     3,     3,     3,     3,     3,     2,
-       2,     2,     1,     2,     2,     2,     2,     1,     0,     1,
-       1,     3,     5,     4,     6,     5,     2,     0,     5,     5,
-       6,     8,     0,     1,     1,     3,     2,     3,     3,     0,
-       2,     4,     2,     1,     4,     1,     7,     4,     2,     4,
-       3,     4,     1,     2,     1,     2,     3,     5,     5,     5,
-       6,     7,     3,     6,     2,     1,     2,     6,     2,     3,
-       1,     3,     3,     3,     3,     3,     3,     3,     2,     5,
-       1,     3,     1,     3,     4,     4,     6,     1,     2,     3,
-       2,     3,     1,     2,     2,     3,     4,     1,     1,     1,
-       2,     3,     6,     1,     1,     1,     3,     2,     4,     2,
-       2,     0,     1,     1,     3,     1,     3,     2,     2,     1,
-       3,     3,     2,     2
+     419,  -236,   566,  -236,  1271,  1271,  1271,   149,  1061,  1306,
+    -236,  -236,  -236,   646,  -236,  -236,   -32,  -236,   -25,   -13,
+    -236,  -236,  -236,  -236,  -236,  -236,  -236,  -236,  -236,    29,
+     348,  -236,  -236,  -236,   420,  1271,   815,   317,  -236,   564,
+       6,    -9,    -5,   142,  1271,    39,  -236,    71,    54,    71,
+      33,  -236,  -236,  -236,  -236,  -236,    56,    73,    19,    19,
+      81,    55,   821,    19,    19,   821,  -236,   485,  -236,  -236,
+     241,   647,   647,   647,   856,   647,  -236,  1306,    60,    46,
+     100,    46,    46,    62,   132,  -236,  -236,   132,  -236,   709,
+      15,   752,  -236,   136,   102,   112,  1096,  1306,  1306,   118,
+      71,    71,  -236,  -236,  -236,  -236,  -236,  -236,  -236,  -236,
+    1306,  1306,  1306,  1306,  1306,  1306,  1306,   109,   195,   815,
+    1271,  1271,  1271,  1271,  1271,   151,  1271,  1306,  1306,  1306,
+    1306,  1306,  1306,  1306,  1306,  1306,  1306,  1306,  1306,  1306,
+    1306,  -236,  1306,  -236,  -236,   139,  1306,  -236,  -236,  -236,
+     155,    51,  1306,  -236,   141,  -236,  -236,  -236,  1341,  1376,
+    1306,   891,  -236,  -236,  1306,    19,  -236,   241,  -236,  -236,
+    -236,   241,    19,  -236,  -236,  -236,   125,   137,  -236,  -236,
+     273,  1131,  -236,   214,   203,   167,   206,   210,  1306,  -236,
+    1306,   161,  -236,  1306,   199,  -236,  1411,  1306,  -236,   788,
+     938,   565,   789,  1166,  -236,  -236,  1306,  1306,  1306,  1306,
+     202,  -236,  -236,  -236,  -236,  -236,  -236,  -236,  -236,  -236,
+    -236,   114,   114,    46,    46,    46,   149,   208,  1029,  1029,
+    1029,  1029,  1029,  1029,  1029,  1029,  1029,  1029,  1029,  1029,
+    1029,  1029,   949,  -236,   237,   817,  -236,  1029,   238,  -236,
+     211,   243,  1201,  1029,   246,   248,  1236,   261,  1029,  -236,
+     263,  1306,   246,   963,  -236,   344,   298,   974,  -236,   266,
+    -236,  -236,  -236,   647,   231,  -236,  -236,  1004,   647,  1306,
+    1306,  1306,  1029,  1029,   227,    98,  -236,   733,   734,  -236,
+     235,  -236,  -236,   233,  1306,  -236,    17,  1306,  1029,   484,
+      21,    30,  -236,  -236,   139,   239,   234,  1306,  -236,   240,
+    -236,    20,  1306,    19,  1306,  -236,  1306,    22,  -236,  1306,
+     263,   246,    19,  -236,   242,  -236,  -236,  1306,  -236,  1306,
+    -236,  -236,   159,   165,   200,  -236,   655,  -236,  -236,  -236,
+    -236,  -236,  -236,    24,  -236,    78,   195,  -236,   278,  -236,
+     245,   764,  -236,   161,  1029,  -236,  1029,   259,   161,  1029,
+      19,  -236,   260,   207,  1016,   265,  -236,  -236,  -236,   267,
+    -236,  -236,  -236,  1306,  1306,  -236,   149,  -236,  -236,   246,
+    -236,  -236,    19,    19,   264,  1029,  1029,   270,    19,  -236,
+    -236,  -236,  -236,  -236
 };
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       0,   175,     0,   157,     0,     0,     0,     0,   125,     0,
-       0,    58,    59,    62,    60,    87,    87,   142,     0,     0,
-     163,   164,    87,     8,    10,     0,     0,     2,     4,     7,
-      12,    34,    56,     0,    72,   130,     0,   152,     0,     0,
-       5,     0,     0,     0,     0,    32,    33,    92,    92,   105,
+       0,   192,     0,   174,     0,     0,     0,     0,     0,     0,
+      58,    59,    62,    60,    87,    87,   158,   131,     0,     0,
+     180,   181,    87,   149,   150,   156,   157,     8,    10,     0,
+       0,     2,     4,     7,    12,    34,    56,     0,    72,   136,
+       0,     0,     0,   169,     0,     0,     5,     0,     0,     0,
+       0,    32,    33,    92,    92,   111,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    23,     0,    21,    25,
+       0,     0,     0,     0,     0,     0,    29,     0,    60,    70,
+     136,    71,    69,     0,    77,    74,    76,   132,   134,     0,
+       0,   136,    73,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   186,   187,     1,     3,    14,    53,    49,    51,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    57,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      23,     0,    21,    25,     0,     0,     0,     0,     0,     0,
-      29,     0,    60,    71,   130,    70,    69,     0,    77,    74,
-      76,   126,   128,     0,     0,   130,    73,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   169,   170,     1,     3,
-      14,    53,    49,    51,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    57,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    75,     0,   140,   138,   160,
-     158,   159,   153,   154,     0,   167,   171,     6,    18,    26,
-      78,    78,     0,     0,    27,    28,     0,    87,   148,     0,
-      30,    31,   150,     0,     0,    17,    22,    24,   102,     0,
-     108,   112,     0,     0,   124,     0,     0,     0,     0,     0,
-       0,    61,     0,     0,   129,     0,   179,   176,     0,    78,
-     143,    60,     0,     0,     0,     0,     9,    11,     0,     0,
-       0,     0,   116,    48,    47,    46,    45,    44,    43,    42,
-      19,    13,    20,    64,    63,    67,    66,    65,   155,    68,
-      41,    40,    39,    38,    37,    36,    35,   137,   136,   135,
-     134,   133,   132,   131,     0,   161,   147,     0,   173,     0,
-     172,     0,    80,    94,    79,    99,     0,    59,     0,    99,
-       0,   110,    60,     0,     0,   122,     0,   149,   151,   103,
-       0,     0,   113,   114,     0,     0,     0,     0,     0,    97,
-      98,     0,     0,   177,    60,     0,   178,     0,   145,   144,
-       0,     0,    83,     0,     0,    15,     0,    50,    52,   156,
-     141,     0,   168,     0,    96,     0,     0,     0,     0,     0,
-      86,    93,    99,     0,   107,     0,   111,   101,     0,   104,
-       0,   115,   109,     0,     0,     0,   117,   119,   181,   183,
-     180,   182,    82,   139,     0,    85,     0,     0,    54,     0,
-     174,    95,    81,   100,    88,     0,     0,    89,     0,     0,
-       0,   119,   118,   127,   120,   146,    84,    16,     0,     0,
-     165,   162,    99,    90,   123,     0,     0,    55,     0,     0,
-     121,   106,   166,    91
+       0,    75,     0,   146,   144,     0,     0,   177,   175,   176,
+     170,   171,     0,   184,   188,     6,    18,    26,    97,    78,
+       0,     0,    27,    28,     0,    87,   165,     0,    30,    31,
+     167,     0,     0,    17,    22,    24,   108,     0,   114,   118,
+       0,     0,   130,     0,     0,     0,     0,     0,     0,    61,
+       0,     0,   135,     0,   196,   193,     0,    78,   159,    60,
+       0,     0,     0,     0,     9,    11,     0,     0,     0,     0,
+      48,    42,    43,    44,    45,    46,    47,   122,    19,    13,
+      20,    63,    64,    65,    66,    67,   172,    68,    35,    36,
+      37,    38,    39,    40,    41,   137,   138,   139,   140,   141,
+     142,   143,     0,   151,   152,     0,   178,   164,     0,   190,
+       0,   189,     0,   101,   105,    98,     0,    59,    80,    94,
+      79,     0,   105,     0,   116,    60,     0,     0,   128,     0,
+     166,   168,   109,     0,     0,   119,   120,     0,     0,     0,
+       0,     0,   103,   104,     0,     0,   194,    60,     0,   195,
+       0,   161,   160,     0,     0,    83,     0,     0,    15,     0,
+      50,    52,   173,   147,     0,     0,     0,     0,   185,     0,
+     100,     0,     0,     0,     0,    96,     0,     0,    86,     0,
+      93,   105,     0,   113,     0,   117,   107,     0,   110,     0,
+     121,   115,     0,     0,     0,   123,   125,   198,   200,   197,
+     199,    82,   145,     0,    85,     0,     0,    54,   153,   148,
+       0,     0,   191,    99,   106,    88,   102,     0,    95,    81,
+       0,    89,     0,     0,     0,   125,   124,   133,   126,     0,
+     162,    84,    16,     0,     0,   155,     0,   182,   179,   105,
+      90,   129,     0,     0,     0,    55,   154,     0,     0,   127,
+     112,   163,   183,    91
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -236,  -236,   279,  -236,  -236,  -236,  -236,  -236,  -236,    53,
+     -35,  -236,   -57,   115,     0,  -236,  -236,  -236,  -236,  -236,
+     218,    -6,   116,  -113,  -236,  -192,     7,   283,    27,  -236,
+    -236,  -236,  -233,  -235,  -236,  -236,  -236,  -236,  -236,  -236,
+    -236,  -236,    -1,  -236,  -236,  -236,    41,  -236,  -236,    52,
+    -236,  -236,  -214,  -236,  -236,  -236,  -236,  -236,  -236,  -236,
+    -236,  -236,  -236,  -236,  -236
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    26,    27,    28,    94,    95,   112,   198,   327,    60,
-     211,    61,    62,    63,   242,   200,   201,   199,   348,    31,
-      32,    33,   243,   244,    34,   248,    87,   150,   302,   245,
-     295,   298,    65,   260,    66,    67,    68,   173,   265,    69,
-      35,    36,   138,   237,    70,    37,   142,    38,    39,   351,
-      40,    41,    42,   239,   240,    43,   187,   188,   276
+       0,    30,    31,    32,   100,   101,   118,   206,   346,    66,
+     219,    67,    68,    69,   258,   208,   209,   207,   373,    35,
+      36,    37,   259,   260,    38,   261,    93,   158,   321,   262,
+     254,   255,    90,   313,    71,   273,    72,    73,    74,   181,
+     278,    75,    39,    40,   144,    41,   244,   305,    42,   248,
+      76,    43,   150,    44,    45,   378,    46,    47,    48,   250,
+     251,    49,   195,   196,   289
 };
 
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -241
-static const yytype_int16 yypact[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
 {
-     364,  -241,   544,  -241,   916,   916,   916,   139,  -241,   730,
-     947,  -241,  -241,  -241,   476,  -241,  -241,   -43,   -23,    -3,
-    -241,  -241,  -241,  -241,  -241,   -24,   301,  -241,  -241,  -241,
-    1255,   916,   140,   465,  -241,   547,     7,   120,   916,    24,
-    -241,    44,    41,    44,    15,  -241,  -241,  -241,  -241,  -241,
-      45,    55,   112,   112,    95,    98,   395,   112,   112,   395,
-    -241,   467,  -241,  -241,   618,   621,   621,   621,   668,   621,
-    -241,   947,   110,    59,   103,    59,    59,   100,    46,  -241,
-    -241,    46,  -241,    11,    13,   539,  -241,   146,   122,   131,
-     761,   947,   947,   138,    44,    44,  -241,  -241,  -241,  -241,
-    -241,  -241,  -241,  -241,   145,   947,   947,   947,   947,   947,
-     947,   947,    70,   140,   916,   916,   916,   916,   916,   172,
-     916,   947,   947,   947,   947,   947,   947,   947,   947,   947,
-     947,   947,   947,   947,   947,  -241,   947,  -241,  -241,  -241,
-    -241,  -241,   169,   126,   947,  -241,   161,  -241,  -241,  -241,
-     978,  1009,   947,   699,  -241,  -241,   947,   112,  -241,   618,
-    -241,  -241,  -241,   618,   112,  -241,  -241,  -241,   157,   164,
-    -241,  -241,  1208,   792,  -241,  1083,   222,   192,   233,   234,
-     947,  -241,   947,   220,  -241,   947,   198,  -241,  1040,   947,
-    -241,    69,  1094,  1276,  1297,   823,  -241,  -241,   947,   947,
-     947,   947,  -241,   190,  -241,  -241,  -241,  -241,  -241,  -241,
-    -241,  -241,  -241,    58,    58,    59,    59,    59,   139,   209,
-    1320,  1320,  1320,  1320,  1320,  1320,  1320,  1320,  1320,  1320,
-    1320,  1320,  1320,  1320,  1121,  -241,  1320,   243,  -241,   211,
-     245,   854,  1320,  -241,   248,   266,   885,   268,   947,   266,
-    1132,  -241,   367,  1234,  1159,  -241,   271,  -241,  -241,  -241,
-     621,   235,  -241,  -241,  1170,   621,   947,   947,   947,  1320,
-    1320,   230,     2,  -241,   219,   246,  -241,   238,  -241,  -241,
-     236,   947,  -241,    16,   947,  1320,  1309,   436,   543,  -241,
-    -241,   947,  -241,   240,  -241,    32,   947,   947,   112,   947,
-    -241,   248,   266,   112,  -241,   242,  -241,  -241,   947,  -241,
-     947,  -241,  -241,   179,   182,   185,  -241,   616,  -241,  -241,
-    -241,  -241,  -241,  -241,   239,  -241,    93,    70,  -241,   295,
-    -241,   220,  1320,  1320,  -241,   251,   112,  -241,   252,   215,
-    1197,   256,  -241,  -241,  -241,  -241,  -241,  -241,   947,   139,
-    -241,  -241,   266,  -241,  -241,   112,   112,  1320,   257,   112,
-    -241,  -241,  -241,  -241
+      34,    85,    70,    80,    80,    80,    86,    80,    91,    89,
+     174,   297,   302,    96,   176,   177,   178,   142,   182,   311,
+      97,    94,    95,   317,    51,    52,   190,   322,   319,    99,
+      34,   190,    98,   190,    80,   369,   145,   148,    51,    52,
+     146,   156,   149,    80,   109,   110,   111,   112,   113,   114,
+     115,   116,   143,    33,   110,   111,   112,   113,   114,   115,
+     116,   191,   167,   344,   316,   171,   353,    70,   358,   -87,
+     370,    70,    70,    70,   180,    70,    91,   183,     2,   102,
+     285,   103,   185,    33,   152,   184,   360,   125,   126,   319,
+     296,   186,  -125,   126,   187,   117,   200,   201,   202,   154,
+     153,   160,   155,    92,   117,   165,     8,    83,   336,   319,
+     210,   211,   212,   213,   214,   215,   216,    17,   161,    80,
+      80,    80,    80,    80,   371,    80,   164,   228,   229,   230,
+     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   -87,   242,   141,   388,   193,   245,   194,   320,   122,
+     123,   124,   247,   204,   205,   125,   126,   197,   253,   217,
+     263,   266,   387,   203,   267,   157,   332,   333,   334,   365,
+     319,   218,   269,   162,   163,   366,   319,   166,   168,   169,
+     170,   277,   147,   226,   345,   175,     8,    83,   282,   243,
+     283,   249,    84,     8,    83,   246,   288,    17,   272,    84,
+      51,    52,     2,   320,    17,   274,   298,   299,   300,   301,
+     367,   319,   279,   192,   363,   280,   328,   382,   319,   281,
+     148,   331,    79,    81,    82,   149,    88,   111,   112,   113,
+     114,   115,   116,   220,   107,   284,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   286,    51,    52,   304,   307,
+     126,    91,    89,   119,   309,    91,    89,   308,   312,   314,
+     189,   107,   151,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   318,    70,   319,   327,   329,   335,    70,   275,
+     268,   341,   270,   342,   350,   349,   271,   157,   117,   374,
+     352,   375,   362,   107,   247,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   325,   379,   381,   351,   368,   105,
+     391,   372,   354,   290,   356,   117,   392,   384,   107,   359,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   364,
+     127,   128,   129,   130,   131,   132,   133,   159,   221,   222,
+     223,   224,   225,   357,   227,   348,   343,   117,   104,     1,
+       0,     0,     0,   -87,     0,     2,     0,   -77,   -77,   -77,
+     -77,   -77,   -77,   -77,     0,     0,     0,     0,     0,     0,
+     148,     0,   117,   385,   386,   149,     0,     0,     0,     0,
+       3,     4,     5,     0,     0,     0,     6,    92,     0,     0,
+       0,     7,     8,     9,     0,    10,    11,    12,    13,   218,
+      14,    15,    16,    17,     0,     0,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,     0,     0,     0,   324,     0,
+       1,     0,     0,     0,    27,    28,     2,     0,   355,     0,
+      29,   106,     0,     0,     0,     0,     0,   361,     0,     0,
+     107,     0,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     3,     4,     5,     0,     0,     0,     6,     0,     0,
+       0,   220,     7,     8,     9,     0,    10,    11,    12,    13,
+       0,    14,    15,    16,    17,   380,     0,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,   172,     0,     0,     0,
+      51,    52,     2,   173,   117,    27,    28,   389,   390,     0,
+       0,    29,     0,   393,   107,   347,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     3,     4,     5,
+       0,     0,     0,     6,     0,     0,     0,     0,     7,     8,
+       9,     0,    10,    11,    12,    13,     0,    14,    15,    16,
+      17,    53,    54,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    55,    56,    57,    58,    59,    60,   117,     0,
+      61,     0,     0,    62,    63,    64,    65,    50,     0,     0,
+       0,    51,    52,     2,     0,     0,   293,   134,   135,   136,
+     137,   138,   139,   140,     0,   107,     0,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     3,     4,
+       5,     0,     0,     0,     6,     0,     0,   141,     0,     7,
+       8,     9,     0,    10,    11,    12,    13,     0,    14,    15,
+      16,    17,    53,    54,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    55,    56,    57,    58,    59,    60,   117,
+       0,    61,     0,     0,    62,    63,    64,    65,   172,     0,
+       0,     0,    51,    52,     2,   -87,     0,     0,     0,   -77,
+     -77,   -77,   -77,   -77,   -77,   -77,     0,     0,  -124,  -124,
+    -124,  -124,  -124,  -124,  -124,     0,     0,     0,     0,     3,
+       4,     5,     0,     0,     0,     6,     0,     0,     0,    92,
+       7,     8,     9,     0,    10,    11,    12,    13,   368,    14,
+      15,    16,    17,    53,    54,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    55,    56,    57,    58,    59,    60,
+     188,     0,    61,     0,     0,    62,    63,    64,    65,   107,
+       0,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,   -87,     0,   337,   339,   -77,   -77,   -77,   -77,
+     -77,   -77,   -77,     0,   107,   189,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   134,   135,   136,   137,   138,
+     139,   140,     0,     0,     0,   376,    92,     0,     0,   338,
+     340,     0,     0,   117,   107,     0,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   141,     0,   -87,   192,     0,
+     294,   -77,   -77,   -77,   -77,   -77,   -77,   -77,   117,   107,
+     377,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,     0,     0,     0,    51,    52,   306,     0,
+       0,    92,     0,     0,   291,     0,     0,   107,   117,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   120,   121,
+     122,   123,   124,     3,     4,     5,   125,   126,     0,     6,
+       0,     0,   179,   117,     7,     8,     9,     0,    10,    11,
+      12,    13,     0,    14,    15,    16,    17,     0,     0,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,     3,     4,
+       5,   117,     0,     0,     6,     0,     0,   264,     0,     7,
+       8,     9,     0,    10,    11,    12,    13,     0,    14,    15,
+      16,    17,     0,     0,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,     3,     4,     5,     0,     0,     0,     6,
+       0,     0,     0,     0,     7,     8,     9,     0,    10,    11,
+      12,   265,     0,    14,    15,    16,    17,     0,     0,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,   107,     0,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   107,
+       0,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,   107,   292,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   107,   303,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,   323,
+       0,     0,   117,     0,     0,     0,     0,     0,     0,     0,
+     326,     0,     0,   117,   107,     0,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,   107,   117,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,   117,   107,
+     330,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,   383,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   117,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     117,     0,     0,     3,     4,     5,     0,     0,     0,     6,
+       0,     0,     0,   117,     7,     8,    77,     0,    10,    11,
+      12,    78,    87,    14,    15,    16,    17,     0,     0,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,     3,     4,
+       5,     0,     0,     0,     6,     0,     0,     0,     0,     7,
+       8,     9,   198,    10,    11,    12,   199,     0,    14,    15,
+      16,    17,     0,     0,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,     3,     4,     5,     0,     0,     0,     6,
+       0,     0,     0,     0,     7,     8,     9,   276,    10,    11,
+      12,    13,     0,    14,    15,    16,    17,     0,     0,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,     3,     4,
+       5,     0,     0,     0,     6,     0,     0,     0,     0,     7,
+       8,     9,   295,    10,   257,    12,    13,     0,    14,    15,
+      16,    17,     0,     0,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,     3,     4,     5,     0,     0,     0,     6,
+       0,     0,     0,     0,     7,     8,     9,   310,    10,    11,
+      12,    13,     0,    14,    15,    16,    17,     0,     0,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,     3,     4,
+       5,     0,     0,     0,     6,     0,     0,     0,     0,     7,
+       8,     9,   315,    10,   257,    12,    13,     0,    14,    15,
+      16,    17,     0,     0,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,     3,     4,     5,     0,     0,     0,     6,
+       0,     0,     0,     0,     7,     8,    77,     0,    10,    11,
+      12,    78,     0,    14,    15,    16,    17,     0,     0,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,     3,     4,
+       5,     0,     0,     0,     6,     0,     0,     0,     0,     7,
+       8,     9,     0,    10,    11,    12,    13,     0,    14,    15,
+      16,    17,     0,     0,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,     3,     4,     5,     0,     0,     0,     6,
+       0,     0,     0,     0,     7,     8,   252,     0,    10,    11,
+      12,    13,     0,    14,    15,    16,    17,     0,     0,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,     3,     4,
+       5,     0,     0,     0,     6,     0,     0,     0,     0,     7,
+       8,   256,     0,    10,   257,    12,    13,     0,    14,    15,
+      16,    17,     0,     0,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,     3,     4,     5,     0,     0,     0,     6,
+       0,     0,     0,     0,     7,     8,     9,     0,    10,    11,
+      12,   287,     0,    14,    15,    16,    17,     0,     0,    18,
+      19,    20,    21,    22,    23,    24,    25,    26
 };
 
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] =
+static const yytype_int16 yycheck[] =
 {
-    -241,  -241,   261,  -241,  -241,  -241,  -241,  -241,  -241,     3,
-     -37,  -241,   -50,   150,     0,  -241,  -241,  -241,  -241,  -241,
-     133,    -6,   106,   -44,  -241,  -189,    -8,   255,     6,   160,
-     302,  -240,  -241,  -241,  -241,  -241,  -241,  -241,  -241,  -241,
-      43,  -241,  -241,    34,  -241,  -241,  -214,  -241,  -241,  -241,
-    -241,  -241,  -241,  -241,  -241,  -241,  -241,  -241,  -241
+       0,     7,     2,     4,     5,     6,     7,     8,     9,     9,
+      67,   203,   226,    45,    71,    72,    73,    11,    75,   252,
+      45,    14,    15,   256,     5,     6,    11,   262,    11,    22,
+      30,    11,    45,    11,    35,    11,    45,    43,     5,     6,
+      45,     8,    43,    44,    23,    24,    25,    26,    27,    28,
+      29,    30,    46,     0,    24,    25,    26,    27,    28,    29,
+      30,    46,    62,    46,   256,    65,    46,    67,    46,     9,
+      46,    71,    72,    73,    74,    75,    77,    77,     7,    50,
+     193,    52,    83,    30,    45,    78,   321,    41,    42,    11,
+     203,    84,    41,    42,    87,    74,    96,    97,    98,    45,
+      47,    45,    49,    43,    74,    50,    44,    45,    10,    11,
+     110,   111,   112,   113,   114,   115,   116,    55,    45,   120,
+     121,   122,   123,   124,    46,   126,    45,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,     9,   142,    43,   379,     9,   146,    45,   261,    35,
+      36,    37,   152,   100,   101,    41,    42,    45,   158,    50,
+     160,   161,   376,    45,   164,    50,   279,   280,   281,    10,
+      11,   118,   165,    58,    59,    10,    11,    62,    63,    64,
+      65,   181,    40,    32,   297,    70,    44,    45,   188,    50,
+     190,    50,    50,    44,    45,    40,   196,    55,    73,    50,
+       5,     6,     7,   316,    55,    68,   206,   207,   208,   209,
+      10,    11,     9,    46,   327,     9,   273,    10,    11,     9,
+     226,   278,     4,     5,     6,   226,     8,    25,    26,    27,
+      28,    29,    30,   118,    20,    74,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    46,     5,     6,    11,    11,
+      42,   252,   252,    35,    11,   256,   256,    46,    12,    11,
+      46,    20,    44,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    11,   273,    11,     9,    45,    50,   278,     6,
+     165,    46,   167,    50,    50,    46,   171,   172,    74,    11,
+      50,    46,    50,    20,   294,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,     6,    46,    46,   307,    43,    30,
+      46,   346,   312,   197,   314,    74,    46,    50,    20,   319,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,   329,
+      13,    14,    15,    16,    17,    18,    19,    54,   120,   121,
+     122,   123,   124,   316,   126,   304,   294,    74,     0,     1,
+      -1,    -1,    -1,     9,    -1,     7,    -1,    13,    14,    15,
+      16,    17,    18,    19,    -1,    -1,    -1,    -1,    -1,    -1,
+     376,    -1,    74,   373,   374,   376,    -1,    -1,    -1,    -1,
+      32,    33,    34,    -1,    -1,    -1,    38,    43,    -1,    -1,
+      -1,    43,    44,    45,    -1,    47,    48,    49,    50,   346,
+      52,    53,    54,    55,    -1,    -1,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    -1,    -1,    -1,    74,    -1,
+       1,    -1,    -1,    -1,    76,    77,     7,    -1,   313,    -1,
+      82,    11,    -1,    -1,    -1,    -1,    -1,   322,    -1,    -1,
+      20,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    32,    33,    34,    -1,    -1,    -1,    38,    -1,    -1,
+      -1,   346,    43,    44,    45,    -1,    47,    48,    49,    50,
+      -1,    52,    53,    54,    55,   360,    -1,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,     1,    -1,    -1,    -1,
+       5,     6,     7,     8,    74,    76,    77,   382,   383,    -1,
+      -1,    82,    -1,   388,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    -1,    -1,    32,    33,    34,
+      -1,    -1,    -1,    38,    -1,    -1,    -1,    -1,    43,    44,
+      45,    -1,    47,    48,    49,    50,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    74,    -1,
+      75,    -1,    -1,    78,    79,    80,    81,     1,    -1,    -1,
+      -1,     5,     6,     7,    -1,    -1,    11,    13,    14,    15,
+      16,    17,    18,    19,    -1,    20,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    -1,    -1,    32,    33,
+      34,    -1,    -1,    -1,    38,    -1,    -1,    43,    -1,    43,
+      44,    45,    -1,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    74,
+      -1,    75,    -1,    -1,    78,    79,    80,    81,     1,    -1,
+      -1,    -1,     5,     6,     7,     9,    -1,    -1,    -1,    13,
+      14,    15,    16,    17,    18,    19,    -1,    -1,    13,    14,
+      15,    16,    17,    18,    19,    -1,    -1,    -1,    -1,    32,
+      33,    34,    -1,    -1,    -1,    38,    -1,    -1,    -1,    43,
+      43,    44,    45,    -1,    47,    48,    49,    50,    43,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      11,    -1,    75,    -1,    -1,    78,    79,    80,    81,    20,
+      -1,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      -1,    -1,     9,    -1,    11,    11,    13,    14,    15,    16,
+      17,    18,    19,    -1,    20,    46,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    13,    14,    15,    16,    17,
+      18,    19,    -1,    -1,    -1,    11,    43,    -1,    -1,    46,
+      46,    -1,    -1,    74,    20,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    43,    -1,     9,    46,    -1,
+      11,    13,    14,    15,    16,    17,    18,    19,    74,    20,
+      46,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      -1,    -1,    -1,    -1,    -1,    -1,     5,     6,    11,    -1,
+      -1,    43,    -1,    -1,    46,    -1,    -1,    20,    74,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    33,    34,
+      35,    36,    37,    32,    33,    34,    41,    42,    -1,    38,
+      -1,    -1,     6,    74,    43,    44,    45,    -1,    47,    48,
+      49,    50,    -1,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    32,    33,
+      34,    74,    -1,    -1,    38,    -1,    -1,     6,    -1,    43,
+      44,    45,    -1,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    -1,    -1,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    32,    33,    34,    -1,    -1,    -1,    38,
+      -1,    -1,    -1,    -1,    43,    44,    45,    -1,    47,    48,
+      49,    50,    -1,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    20,    -1,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    20,
+      -1,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      -1,    -1,    -1,    20,    46,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    20,    46,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    -1,    74,    20,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    -1,    20,    74,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    -1,    74,    20,
+      46,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    74,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      74,    -1,    -1,    32,    33,    34,    -1,    -1,    -1,    38,
+      -1,    -1,    -1,    74,    43,    44,    45,    -1,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    32,    33,
+      34,    -1,    -1,    -1,    38,    -1,    -1,    -1,    -1,    43,
+      44,    45,    46,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    -1,    -1,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    32,    33,    34,    -1,    -1,    -1,    38,
+      -1,    -1,    -1,    -1,    43,    44,    45,    46,    47,    48,
+      49,    50,    -1,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    32,    33,
+      34,    -1,    -1,    -1,    38,    -1,    -1,    -1,    -1,    43,
+      44,    45,    46,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    -1,    -1,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    32,    33,    34,    -1,    -1,    -1,    38,
+      -1,    -1,    -1,    -1,    43,    44,    45,    46,    47,    48,
+      49,    50,    -1,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    32,    33,
+      34,    -1,    -1,    -1,    38,    -1,    -1,    -1,    -1,    43,
+      44,    45,    46,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    -1,    -1,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    32,    33,    34,    -1,    -1,    -1,    38,
+      -1,    -1,    -1,    -1,    43,    44,    45,    -1,    47,    48,
+      49,    50,    -1,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    32,    33,
+      34,    -1,    -1,    -1,    38,    -1,    -1,    -1,    -1,    43,
+      44,    45,    -1,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    -1,    -1,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    32,    33,    34,    -1,    -1,    -1,    38,
+      -1,    -1,    -1,    -1,    43,    44,    45,    -1,    47,    48,
+      49,    50,    -1,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    32,    33,
+      34,    -1,    -1,    -1,    38,    -1,    -1,    -1,    -1,    43,
+      44,    45,    -1,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    -1,    -1,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    32,    33,    34,    -1,    -1,    -1,    38,
+      -1,    -1,    -1,    -1,    43,    44,    45,    -1,    47,    48,
+      49,    50,    -1,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -119
-static const yytype_int16 yytable[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
 {
-      30,    79,    64,    29,   289,    90,   284,    88,    89,   303,
-      83,   166,   317,   296,    93,   168,   169,   170,   136,   174,
-      45,    46,   180,   148,   182,    91,    30,   296,    96,    29,
-      97,   140,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   182,   145,    92,   147,    74,    74,    74,
-      80,     2,    74,    85,   137,   -87,   159,   299,   181,   163,
-     183,    64,   336,   325,   176,    64,    64,    64,   172,    64,
-     178,   175,   144,   179,    74,    45,    46,     2,   -87,   331,
-     141,    74,   -77,   -77,   -77,   -77,   -77,   -77,   -77,   146,
-     192,   193,   194,   152,   116,   117,   118,   196,   197,   119,
-     119,   120,   120,   153,   296,   203,   204,   205,   206,   207,
-     208,   209,   359,    86,    85,   210,   278,    45,    46,   -87,
-     177,   220,   221,   222,   223,   224,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   358,   234,    73,    75,    76,
-     346,   272,    82,   156,   236,     8,     9,   135,    77,   256,
-     157,   283,   250,   253,    86,   185,   254,    74,    74,    74,
-      74,    74,   139,    74,   113,     8,     9,  -119,    77,   120,
-     186,   143,    78,   264,   114,   115,   116,   117,   118,   189,
-     269,   119,   270,   120,     8,     9,   195,    77,   275,   341,
-     296,    78,   342,   296,   149,   343,   296,   202,   285,   286,
-     287,   288,   154,   155,   301,   218,   158,   160,   161,   162,
-     309,   235,   140,   238,   167,   312,   106,   107,   108,   109,
-     110,   111,   313,   314,   315,   355,   296,   259,   -87,   261,
-     318,   266,   -77,   -77,   -77,   -77,   -77,   -77,   -77,   184,
-     326,    83,   267,   268,   271,   273,    83,   213,   214,   215,
-     216,   217,   120,   219,   291,   301,   293,   320,   292,   296,
-      64,   141,   212,    86,   339,    64,   319,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   297,   300,
-     308,   236,   316,   310,    85,   322,   345,    99,   323,    85,
-     347,   329,   330,   321,   338,   277,   332,   333,   352,   354,
-     344,    98,     1,   151,   362,   335,   349,   255,     2,   257,
-     340,   249,    84,   258,   149,   324,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,     0,     0,     0,
-     210,     0,     0,     0,     3,     4,     5,     0,     0,     0,
-       0,     6,   350,   140,     0,     7,     8,     9,   357,    10,
-      11,    12,    13,    14,     0,    15,    16,    17,     0,     0,
-      18,    19,    20,    21,    22,     1,     0,     0,     0,     0,
-       0,     2,     0,    23,    24,     0,   -87,     0,     0,    25,
-     -77,   -77,   -77,   -77,   -77,   -77,   -77,     0,     0,     0,
-       0,   305,   141,     0,     0,     0,     0,     3,     4,     5,
-      45,    46,     0,     0,     6,     0,     0,     0,     7,     8,
-       9,    86,    10,    11,    12,    13,    14,     0,    15,    16,
-      17,     0,     0,    18,    19,    20,    21,    22,     3,     4,
-       5,     0,     0,     0,     0,     6,    23,    24,     0,     7,
-       8,     9,    25,    10,    11,    12,    13,    14,   334,    15,
-      16,    17,     0,   337,    18,    19,    20,    21,    22,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   164,     0,
-       0,     0,    45,    46,     2,   165,     0,   212,   121,   122,
-     123,   124,   125,   126,   127,   -87,   353,     0,     0,   -77,
-     -77,   -77,   -77,   -77,   -77,   -77,     0,     0,     0,     0,
-       3,     4,     5,     0,     0,   360,   361,     6,     0,   363,
-       0,     7,     8,     9,     0,    10,    11,    12,    13,    14,
-      86,    15,    16,    17,    47,    48,    18,    19,    20,    21,
-      22,    49,    50,    51,    52,    53,    54,     0,    55,     0,
-       0,    56,    57,    58,    59,    44,     0,     0,     0,    45,
-      46,     2,   128,   129,   130,   131,   132,   133,   134,     0,
-     128,   129,   130,   131,   132,   133,   134,   104,   105,   106,
-     107,   108,   109,   110,   111,     0,     0,     3,     4,     5,
-       0,     0,     0,   135,     6,     0,   184,     0,     7,     8,
-       9,   135,    10,    11,    12,    13,    14,     0,    15,    16,
-      17,    47,    48,    18,    19,    20,    21,    22,    49,    50,
-      51,    52,    53,    54,     0,    55,     0,     0,    56,    57,
-      58,    59,   164,    45,    46,     0,    45,    46,     2,  -118,
-    -118,  -118,  -118,  -118,  -118,  -118,     0,     0,     0,   101,
-     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
-       0,     0,     0,     0,     3,     4,     5,     0,     0,     0,
-     344,     6,     0,     0,     0,     7,     8,     9,     0,    10,
-      11,    12,    13,    14,   171,    15,    16,    17,    47,    48,
-      18,    19,    20,    21,    22,    49,    50,    51,    52,    53,
-      54,     0,    55,     0,     0,    56,    57,    58,    59,     0,
-       0,     3,     4,     5,     0,   251,     0,     0,     6,     0,
-       0,     0,     7,     8,     9,     0,    10,    11,    12,    13,
-      14,     0,    15,    16,    17,     0,     0,    18,    19,    20,
-      21,    22,     3,     4,     5,     0,     0,     0,     0,     6,
-       0,     0,     0,     7,     8,     9,     0,    10,    11,    12,
-      13,   252,     0,    15,    16,    17,     0,     0,    18,    19,
-      20,    21,    22,     3,     4,     5,     0,     0,     0,     0,
-       6,     0,     0,     0,     7,     8,     9,     0,    71,    11,
-      12,    13,    72,    81,    15,    16,    17,     0,     0,    18,
-      19,    20,    21,    22,     3,     4,     5,     0,     0,     0,
-       0,     6,     0,     0,     0,     7,     8,     9,   190,    10,
-      11,    12,    13,   191,     0,    15,    16,    17,     0,     0,
-      18,    19,    20,    21,    22,     3,     4,     5,     0,     0,
-       0,     0,     6,     0,     0,     0,     7,     8,     9,   263,
-      10,    11,    12,    13,    14,     0,    15,    16,    17,     0,
-       0,    18,    19,    20,    21,    22,     3,     4,     5,     0,
-       0,     0,     0,     6,     0,     0,     0,     7,     8,     9,
-     282,    10,    11,   247,    13,    14,     0,    15,    16,    17,
-       0,     0,    18,    19,    20,    21,    22,     3,     4,     5,
-       0,     0,     0,     0,     6,     0,     0,     0,     7,     8,
-       9,   294,    10,    11,    12,    13,    14,     0,    15,    16,
-      17,     0,     0,    18,    19,    20,    21,    22,     3,     4,
-       5,     0,     0,     0,     0,     6,     0,     0,     0,     7,
-       8,     9,   294,    10,    11,   247,    13,    14,     0,    15,
-      16,    17,     0,     0,    18,    19,    20,    21,    22,     3,
-       4,     5,     0,     0,     0,     0,     6,     0,     0,     0,
-       7,     8,     9,     0,    71,    11,    12,    13,    72,     0,
-      15,    16,    17,     0,     0,    18,    19,    20,    21,    22,
-       3,     4,     5,     0,     0,     0,     0,     6,     0,     0,
-       0,     7,     8,     9,     0,    10,    11,    12,    13,    14,
-       0,    15,    16,    17,     0,     0,    18,    19,    20,    21,
-      22,     3,     4,     5,     0,     0,     0,     0,     6,     0,
-       0,     0,     7,     8,     9,     0,   241,    11,    12,    13,
-      14,     0,    15,    16,    17,     0,     0,    18,    19,    20,
-      21,    22,     3,     4,     5,     0,     0,     0,     0,     6,
-       0,     0,     0,     7,     8,     9,     0,   246,    11,   247,
-      13,    14,     0,    15,    16,    17,     0,     0,    18,    19,
-      20,    21,    22,     3,     4,     5,     0,     0,     0,     0,
-       6,     0,     0,     0,     7,     8,     9,     0,    10,    11,
-      12,    13,   274,     0,    15,    16,    17,     0,     0,    18,
-      19,    20,    21,    22,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   110,   111,   101,   102,   103,   104,   105,
-     106,   107,   108,   109,   110,   111,     0,     0,     0,     0,
-     181,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   279,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   101,   102,   103,   104,   105,   106,   107,
-     108,   109,   110,   111,     0,     0,     0,     0,   290,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   304,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-     110,   111,     0,     0,     0,     0,   307,     0,     0,     0,
-       0,     0,     0,     0,   262,     0,     0,   311,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   101,
-     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
-     306,     0,     0,     0,   356,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   101,   102,   103,   104,   105,
-     106,   107,   108,   109,   110,   111,   100,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   280,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   281,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   328,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-     110,   111
+       0,     1,     7,    32,    33,    34,    38,    43,    44,    45,
+      47,    48,    49,    50,    52,    53,    54,    55,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    76,    77,    82,
+      84,    85,    86,    92,    97,   102,   103,   104,   107,   125,
+     126,   128,   131,   134,   136,   137,   139,   140,   141,   144,
+       1,     5,     6,    56,    57,    67,    68,    69,    70,    71,
+      72,    75,    78,    79,    80,    81,    92,    94,    95,    96,
+      97,   117,   119,   120,   121,   124,   133,    45,    50,   103,
+     125,   103,   103,    45,    50,   104,   125,    51,   103,    97,
+     115,   125,    43,   109,   109,   109,    45,    45,    45,   109,
+      87,    88,    50,    52,     0,    85,    11,    20,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    74,    89,   103,
+      33,    34,    35,    36,    37,    41,    42,    13,    14,    15,
+      16,    17,    18,    19,    13,    14,    15,    16,    17,    18,
+      19,    43,    11,    46,   127,    45,    45,    40,   104,   125,
+     135,   103,    45,    92,    45,    92,     8,    96,   110,   110,
+      45,    45,    96,    96,    45,    50,    96,    97,    96,    96,
+      96,    97,     1,     8,    95,    96,    95,    95,    95,     6,
+      97,   122,    95,    97,   109,   125,   109,   109,    11,    46,
+      11,    46,    46,     9,    45,   145,   146,    45,    46,    50,
+      97,    97,    97,    45,    92,    92,    90,   100,    98,    99,
+      97,    97,    97,    97,    97,    97,    97,    50,    92,    93,
+      96,   103,   103,   103,   103,   103,    32,   103,    97,    97,
+      97,    97,    97,    97,    97,    97,    97,    97,    97,    97,
+      97,    97,    97,    50,   129,    97,    40,    97,   132,    50,
+     142,   143,    45,    97,   113,   114,    45,    48,    97,   105,
+     106,   108,   112,    97,     6,    50,    97,    97,    96,   109,
+      96,    96,    73,   118,    68,     6,    46,    97,   123,     9,
+       9,     9,    97,    97,    74,   106,    46,    50,    97,   147,
+     105,    46,    46,    11,    11,    46,   106,   108,    97,    97,
+      97,    97,   135,    46,    11,   130,    11,    11,    46,    11,
+      46,   115,    12,   116,    11,    46,   108,   115,    11,    11,
+     106,   111,   116,    46,    74,     6,    46,     9,    95,    45,
+      46,    95,   106,   106,   106,    50,    10,    11,    46,    11,
+      46,    46,    50,   132,    46,   106,    91,    21,   129,    46,
+      50,    97,    50,    46,    97,    96,    97,   111,    46,    97,
+     116,    96,    50,   106,    97,    10,    10,    10,    43,    11,
+      46,    46,    93,   101,    11,    46,    11,    46,   138,    46,
+      96,    46,    10,    46,    50,    97,    97,   135,   116,    96,
+      96,    46,    46,    96
 };
 
-static const yytype_int16 yycheck[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
 {
-       0,     7,     2,     0,   218,    48,   195,    15,    16,   249,
-      10,    61,    10,    11,    22,    65,    66,    67,    11,    69,
-       5,     6,    11,     8,    11,    48,    26,    11,    52,    26,
-      54,    37,    21,    22,    23,    24,    25,    26,    27,    28,
-      29,    30,    31,    11,    41,    48,    43,     4,     5,     6,
-       7,     7,     9,    10,    47,     9,    56,   246,    47,    59,
-      47,    61,   302,    47,    72,    65,    66,    67,    68,    69,
-      78,    71,    48,    81,    31,     5,     6,     7,     9,    47,
-      37,    38,    13,    14,    15,    16,    17,    18,    19,    48,
-      90,    91,    92,    48,    36,    37,    38,    94,    95,    41,
-      41,    43,    43,    48,    11,   105,   106,   107,   108,   109,
-     110,   111,   352,    44,    71,   112,    47,     5,     6,     9,
-      77,   121,   122,   123,   124,   125,   126,   127,   128,   129,
-     130,   131,   132,   133,   134,   349,   136,     4,     5,     6,
-      47,   185,     9,    48,   144,    45,    46,    44,    48,   157,
-      52,   195,   152,   153,    44,     9,   156,   114,   115,   116,
-     117,   118,    42,   120,    31,    45,    46,    41,    48,    43,
-      48,    38,    52,   173,    34,    35,    36,    37,    38,    48,
-     180,    41,   182,    43,    45,    46,    48,    48,   188,    10,
-      11,    52,    10,    11,    44,    10,    11,    52,   198,   199,
-     200,   201,    52,    53,   248,    33,    56,    57,    58,    59,
-     260,    42,   218,    52,    64,   265,    26,    27,    28,    29,
-      30,    31,   266,   267,   268,    10,    11,    70,     9,    65,
-      11,     9,    13,    14,    15,    16,    17,    18,    19,    47,
-     284,   241,     9,     9,    24,    47,   246,   114,   115,   116,
-     117,   118,    43,   120,    11,   299,    11,    11,    47,    11,
-     260,   218,   112,    44,   308,   265,    47,    21,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    12,    11,
-       9,   281,    52,    48,   241,    47,    47,    26,    52,   246,
-     327,   291,    52,    47,    52,   189,   296,   297,    47,    47,
-      44,     0,     1,    48,    47,   299,    11,   157,     7,   159,
-     310,   151,    10,   163,   164,   281,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    -1,    -1,    -1,
-     327,    -1,    -1,    -1,    33,    34,    35,    -1,    -1,    -1,
-      -1,    40,    47,   349,    -1,    44,    45,    46,   348,    48,
-      49,    50,    51,    52,    -1,    54,    55,    56,    -1,    -1,
-      59,    60,    61,    62,    63,     1,    -1,    -1,    -1,    -1,
-      -1,     7,    -1,    72,    73,    -1,     9,    -1,    -1,    78,
-      13,    14,    15,    16,    17,    18,    19,    -1,    -1,    -1,
-      -1,    24,   349,    -1,    -1,    -1,    -1,    33,    34,    35,
-       5,     6,    -1,    -1,    40,    -1,    -1,    -1,    44,    45,
-      46,    44,    48,    49,    50,    51,    52,    -1,    54,    55,
-      56,    -1,    -1,    59,    60,    61,    62,    63,    33,    34,
-      35,    -1,    -1,    -1,    -1,    40,    72,    73,    -1,    44,
-      45,    46,    78,    48,    49,    50,    51,    52,   298,    54,
-      55,    56,    -1,   303,    59,    60,    61,    62,    63,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,     1,    -1,
-      -1,    -1,     5,     6,     7,     8,    -1,   327,    13,    14,
-      15,    16,    17,    18,    19,     9,   336,    -1,    -1,    13,
-      14,    15,    16,    17,    18,    19,    -1,    -1,    -1,    -1,
-      33,    34,    35,    -1,    -1,   355,   356,    40,    -1,   359,
-      -1,    44,    45,    46,    -1,    48,    49,    50,    51,    52,
-      44,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    64,    65,    66,    67,    68,    69,    -1,    71,    -1,
-      -1,    74,    75,    76,    77,     1,    -1,    -1,    -1,     5,
-       6,     7,    13,    14,    15,    16,    17,    18,    19,    -1,
-      13,    14,    15,    16,    17,    18,    19,    24,    25,    26,
-      27,    28,    29,    30,    31,    -1,    -1,    33,    34,    35,
-      -1,    -1,    -1,    44,    40,    -1,    47,    -1,    44,    45,
-      46,    44,    48,    49,    50,    51,    52,    -1,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    68,    69,    -1,    71,    -1,    -1,    74,    75,
-      76,    77,     1,     5,     6,    -1,     5,     6,     7,    13,
-      14,    15,    16,    17,    18,    19,    -1,    -1,    -1,    21,
-      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
-      -1,    -1,    -1,    -1,    33,    34,    35,    -1,    -1,    -1,
-      44,    40,    -1,    -1,    -1,    44,    45,    46,    -1,    48,
-      49,    50,    51,    52,     6,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
-      69,    -1,    71,    -1,    -1,    74,    75,    76,    77,    -1,
-      -1,    33,    34,    35,    -1,     6,    -1,    -1,    40,    -1,
-      -1,    -1,    44,    45,    46,    -1,    48,    49,    50,    51,
-      52,    -1,    54,    55,    56,    -1,    -1,    59,    60,    61,
-      62,    63,    33,    34,    35,    -1,    -1,    -1,    -1,    40,
-      -1,    -1,    -1,    44,    45,    46,    -1,    48,    49,    50,
-      51,    52,    -1,    54,    55,    56,    -1,    -1,    59,    60,
-      61,    62,    63,    33,    34,    35,    -1,    -1,    -1,    -1,
-      40,    -1,    -1,    -1,    44,    45,    46,    -1,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    59,
-      60,    61,    62,    63,    33,    34,    35,    -1,    -1,    -1,
-      -1,    40,    -1,    -1,    -1,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    -1,    54,    55,    56,    -1,    -1,
-      59,    60,    61,    62,    63,    33,    34,    35,    -1,    -1,
-      -1,    -1,    40,    -1,    -1,    -1,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    -1,    54,    55,    56,    -1,
-      -1,    59,    60,    61,    62,    63,    33,    34,    35,    -1,
-      -1,    -1,    -1,    40,    -1,    -1,    -1,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    -1,    54,    55,    56,
-      -1,    -1,    59,    60,    61,    62,    63,    33,    34,    35,
-      -1,    -1,    -1,    -1,    40,    -1,    -1,    -1,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    -1,    54,    55,
-      56,    -1,    -1,    59,    60,    61,    62,    63,    33,    34,
-      35,    -1,    -1,    -1,    -1,    40,    -1,    -1,    -1,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    -1,    54,
-      55,    56,    -1,    -1,    59,    60,    61,    62,    63,    33,
-      34,    35,    -1,    -1,    -1,    -1,    40,    -1,    -1,    -1,
-      44,    45,    46,    -1,    48,    49,    50,    51,    52,    -1,
-      54,    55,    56,    -1,    -1,    59,    60,    61,    62,    63,
-      33,    34,    35,    -1,    -1,    -1,    -1,    40,    -1,    -1,
-      -1,    44,    45,    46,    -1,    48,    49,    50,    51,    52,
-      -1,    54,    55,    56,    -1,    -1,    59,    60,    61,    62,
-      63,    33,    34,    35,    -1,    -1,    -1,    -1,    40,    -1,
-      -1,    -1,    44,    45,    46,    -1,    48,    49,    50,    51,
-      52,    -1,    54,    55,    56,    -1,    -1,    59,    60,    61,
-      62,    63,    33,    34,    35,    -1,    -1,    -1,    -1,    40,
-      -1,    -1,    -1,    44,    45,    46,    -1,    48,    49,    50,
-      51,    52,    -1,    54,    55,    56,    -1,    -1,    59,    60,
-      61,    62,    63,    33,    34,    35,    -1,    -1,    -1,    -1,
-      40,    -1,    -1,    -1,    44,    45,    46,    -1,    48,    49,
-      50,    51,    52,    -1,    54,    55,    56,    -1,    -1,    59,
-      60,    61,    62,    63,    21,    22,    23,    24,    25,    26,
-      27,    28,    29,    30,    31,    21,    22,    23,    24,    25,
-      26,    27,    28,    29,    30,    31,    -1,    -1,    -1,    -1,
-      47,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    47,    21,    22,    23,    24,    25,    26,    27,    28,
-      29,    30,    31,    21,    22,    23,    24,    25,    26,    27,
-      28,    29,    30,    31,    -1,    -1,    -1,    -1,    47,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    47,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    -1,    -1,    -1,    -1,    47,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,     6,    -1,    -1,    47,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    21,
-      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
-       6,    -1,    -1,    -1,    47,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    21,    22,    23,    24,    25,
-      26,    27,    28,    29,    30,    31,    11,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    11,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    21,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    11,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31
+       0,    83,    84,    84,    85,    85,    85,    86,    87,    86,
+      88,    86,    89,    86,    90,    91,    86,    92,    92,    93,
+      93,    94,    94,    95,    95,    95,    95,    95,    95,    95,
+      95,    95,    96,    96,    97,    97,    97,    97,    97,    97,
+      97,    97,    97,    97,    97,    97,    97,    97,    97,    98,
+      97,    99,    97,   100,   101,    97,   102,   102,   103,   103,
+     103,   103,   103,   103,   103,   103,   103,   103,   103,   103,
+     103,   103,   103,   103,   103,   103,   103,   104,   105,   105,
+     106,   106,   107,   107,   107,   107,   108,   109,    95,    95,
+      95,    95,   110,   111,   112,   112,   112,   113,   113,   113,
+     113,   114,   114,   115,   115,   116,   116,   117,    95,   118,
+      95,   119,    95,   120,    95,    95,   121,   121,   122,   122,
+     123,   123,    97,    97,   104,   103,   103,    95,    95,   124,
+      95,   125,   125,   125,   125,   125,   103,    97,    97,    97,
+      97,    97,    97,    97,   103,   126,   127,   127,   103,   128,
+     128,   129,   130,   130,   130,   103,   131,   131,   103,   103,
+     103,   103,   103,   103,   132,    95,    95,   133,   133,   103,
+     103,   103,   103,   103,   134,   135,   135,   136,   136,   103,
+     137,   137,   138,   138,   139,   140,   141,   141,   142,   142,
+     143,   143,   144,   103,   145,   145,   146,   146,   146,   147,
+     147
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
-       0,     1,     7,    33,    34,    35,    40,    44,    45,    46,
-      48,    49,    50,    51,    52,    54,    55,    56,    59,    60,
-      61,    62,    63,    72,    73,    78,    80,    81,    82,    88,
-      93,    98,    99,   100,   103,   119,   120,   124,   126,   127,
-     129,   130,   131,   134,     1,     5,     6,    57,    58,    64,
-      65,    66,    67,    68,    69,    71,    74,    75,    76,    77,
-      88,    90,    91,    92,    93,   111,   113,   114,   115,   118,
-     123,    48,    52,    99,   119,    99,    99,    48,    52,   100,
-     119,    53,    99,    93,   109,   119,    44,   105,   105,   105,
-      48,    48,    48,   105,    83,    84,    52,    54,     0,    81,
-      11,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    85,    99,    34,    35,    36,    37,    38,    41,
-      43,    13,    14,    15,    16,    17,    18,    19,    13,    14,
-      15,    16,    17,    18,    19,    44,    11,    47,   121,    42,
-     100,   119,   125,    99,    48,    88,    48,    88,     8,    92,
-     106,   106,    48,    48,    92,    92,    48,    52,    92,    93,
-      92,    92,    92,    93,     1,     8,    91,    92,    91,    91,
-      91,     6,    93,   116,    91,    93,   105,   119,   105,   105,
-      11,    47,    11,    47,    47,     9,    48,   135,   136,    48,
-      47,    52,    93,    93,    93,    48,    88,    88,    86,    96,
-      94,    95,    52,    93,    93,    93,    93,    93,    93,    93,
-      88,    89,    92,    99,    99,    99,    99,    99,    33,    99,
-      93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
-      93,    93,    93,    93,    93,    42,    93,   122,    52,   132,
-     133,    48,    93,   101,   102,   108,    48,    50,   104,   108,
-      93,     6,    52,    93,    93,    92,   105,    92,    92,    70,
-     112,    65,     6,    47,    93,   117,     9,     9,     9,    93,
-      93,    24,   102,    47,    52,    93,   137,   101,    47,    47,
-      11,    11,    47,   102,   104,    93,    93,    93,    93,   125,
-      47,    11,    47,    11,    47,   109,    11,    12,   110,   104,
-      11,   102,   107,   110,    47,    24,     6,    47,     9,    91,
-      48,    47,    91,   102,   102,   102,    52,    10,    11,    47,
-      11,    47,    47,    52,   122,    47,   102,    87,    20,    93,
-      52,    47,    93,    93,    92,   107,   110,    92,    52,   102,
-      93,    10,    10,    10,    44,    47,    47,    89,    97,    11,
-      47,   128,    47,    92,    47,    10,    47,    93,   125,   110,
-      92,    92,    47,    92
+       0,     2,     1,     2,     1,     1,     2,     1,     0,     3,
+       0,     3,     0,     3,     0,     0,     6,     3,     3,     1,
+       1,     1,     2,     1,     2,     1,     2,     2,     2,     1,
+       2,     2,     1,     1,     1,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     0,
+       4,     0,     4,     0,     0,     7,     1,     2,     1,     1,
+       1,     3,     1,     3,     3,     3,     3,     3,     3,     2,
+       2,     2,     1,     2,     2,     2,     2,     1,     0,     1,
+       1,     3,     5,     4,     6,     5,     2,     0,     5,     5,
+       6,     8,     0,     1,     1,     3,     2,     0,     1,     3,
+       2,     1,     3,     3,     3,     0,     2,     4,     2,     1,
+       4,     1,     7,     4,     2,     4,     3,     4,     1,     2,
+       1,     2,     3,     5,     5,     5,     6,     7,     3,     6,
+       2,     1,     2,     6,     2,     3,     1,     3,     3,     3,
+       3,     3,     3,     3,     2,     5,     1,     3,     5,     1,
+       1,     1,     0,     2,     4,     6,     1,     1,     1,     3,
+       4,     4,     6,     8,     1,     2,     3,     2,     3,     1,
+       2,     2,     3,     4,     1,     1,     1,     2,     3,     6,
+       1,     1,     1,     3,     2,     4,     2,     2,     0,     1,
+       1,     3,     1,     3,     2,     2,     1,     3,     3,     2,
+       2
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
 
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#define YYFAIL		goto yyerrlab
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
-
-#ifndef YY_LOCATION_PRINT
-# if YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
-
-
-/* YYLEX -- calling `yylex' with the right arguments.  */
-
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -1358,80 +1556,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1439,16 +1615,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
-static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1459,63 +1627,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
-static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1530,342 +1691,78 @@ int yydebug;
 # define YYMAXDEPTH 10000
 #endif
 
-
-
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
 
-  if (! yyres)
-    return yystrlen (yystr);
 
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
 
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
-/* Prevent warnings from -Wmissing-prototypes.  */
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
 
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
 
-/*-------------------------.
-| yyparse or yypush_parse.  |
-`-------------------------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/*----------.
+| yyparse.  |
+`----------*/
+
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-
-
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks thru separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1873,133 +1770,140 @@ yyparse ()
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
-
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
   /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2014,8 +1918,8 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
@@ -2027,13 +1931,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2048,14 +1952,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -2068,63 +1972,63 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 7:
-
-/* Line 1455 of yacc.c  */
-#line 151 "parse.y"
-    { /* this do nothing action removes a vacuous warning
+  case 7: /* PA_block: block  */
+#line 160 "parse.y"
+             { /* this do nothing action removes a vacuous warning
                   from Bison */
              }
+#line 1981 "y.tab.c"
     break;
 
-  case 8:
-
-/* Line 1455 of yacc.c  */
-#line 156 "parse.y"
-    { be_setup(scope = SCOPE_BEGIN) ; }
+  case 8: /* $@1: %empty  */
+#line 165 "parse.y"
+                { be_setup(scope = SCOPE_BEGIN) ; }
+#line 1987 "y.tab.c"
     break;
 
-  case 9:
-
-/* Line 1455 of yacc.c  */
-#line 159 "parse.y"
-    { switch_code_to_main() ; }
+  case 9: /* PA_block: BEGIN $@1 block  */
+#line 168 "parse.y"
+                { switch_code_to_main() ; }
+#line 1993 "y.tab.c"
     break;
 
-  case 10:
-
-/* Line 1455 of yacc.c  */
-#line 162 "parse.y"
-    { be_setup(scope = SCOPE_END) ; }
+  case 10: /* $@2: %empty  */
+#line 171 "parse.y"
+                { be_setup(scope = SCOPE_END) ; }
+#line 1999 "y.tab.c"
     break;
 
-  case 11:
-
-/* Line 1455 of yacc.c  */
-#line 165 "parse.y"
-    { switch_code_to_main() ; }
+  case 11: /* PA_block: END $@2 block  */
+#line 174 "parse.y"
+                { switch_code_to_main() ; }
+#line 2005 "y.tab.c"
     break;
 
-  case 12:
+  case 12: /* $@3: %empty  */
+#line 177 "parse.y"
+             { INST *p1 = CDP((yyvsp[0].start)) ;
 
-/* Line 1455 of yacc.c  */
-#line 168 "parse.y"
-    { code_jmp(_JZ, (INST*)0) ; }
+               /* a plain /string/ pattern joins the combined scan
+                  of $0, see rule_pattern() in re_cmpl.c */
+               if ( p1 == code_ptr - 2 && p1->op == _MATCH0 )
+               { PTR rp = rule_pattern(p1[1].ptr) ;
+                 if ( rp ) { p1->op = _RMATCH ; p1[1].ptr = rp ; }
+               }
+               code_jmp(_JZ, (INST*)0) ;
+             }
+#line 2020 "y.tab.c"
     break;
 
-  case 13:
-
-/* Line 1455 of yacc.c  */
-#line 171 "parse.y"
-    { patch_jmp( code_ptr ) ; }
+  case 13: /* PA_block: expr $@3 block_or_separator  */
+#line 189 "parse.y"
+             { patch_jmp( code_ptr ) ; }
+#line 2026 "y.tab.c"
     break;
 
-  case 14:
-
-/* Line 1455 of yacc.c  */
-#line 175 "parse.y"
-    {
-	       INST *p1 = CDP((yyvsp[(1) - (2)].start)) ;
+  case 14: /* $@4: %empty  */
+#line 193 "parse.y"
+             {
+	       INST *p1 = CDP((yyvsp[-1].start)) ;
              int len ;
 
 	       code_push(p1, code_ptr - p1, scope, active_funct) ;
@@ -2135,225 +2039,204 @@ yyreduce:
                len = code_pop(code_ptr) ;
              code_ptr += len ;
                code1(_STOP) ;
-             p1 = CDP((yyvsp[(1) - (2)].start)) ;
+             p1 = CDP((yyvsp[-1].start)) ;
                p1[2].op = code_ptr - (p1+1) ;
              }
+#line 2046 "y.tab.c"
     break;
 
-  case 15:
-
-/* Line 1455 of yacc.c  */
-#line 191 "parse.y"
-    { code1(_STOP) ; }
+  case 15: /* $@5: %empty  */
+#line 209 "parse.y"
+             { code1(_STOP) ; }
+#line 2052 "y.tab.c"
     break;
 
-  case 16:
+  case 16: /* PA_block: expr COMMA $@4 expr $@5 block_or_separator  */
+#line 212 "parse.y"
+             {
+	       INST *p1 = CDP((yyvsp[-5].start)) ;
 
-/* Line 1455 of yacc.c  */
-#line 194 "parse.y"
-    {
-	       INST *p1 = CDP((yyvsp[(1) - (6)].start)) ;
-
-	       p1[3].op = CDP((yyvsp[(6) - (6)].start)) - (p1+1) ;
+	       p1[3].op = CDP((yyvsp[0].start)) - (p1+1) ;
                p1[4].op = code_ptr - (p1+1) ;
              }
+#line 2063 "y.tab.c"
     break;
 
-  case 17:
-
-/* Line 1455 of yacc.c  */
-#line 205 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (3)].start) ; }
+  case 17: /* block: LBRACE statement_list RBRACE  */
+#line 223 "parse.y"
+            { (yyval.start) = (yyvsp[-1].start) ; }
+#line 2069 "y.tab.c"
     break;
 
-  case 18:
-
-/* Line 1455 of yacc.c  */
-#line 207 "parse.y"
-    { (yyval.start) = code_offset ; /* does nothing won't be executed */
+  case 18: /* block: LBRACE error RBRACE  */
+#line 225 "parse.y"
+            { (yyval.start) = code_offset ; /* does nothing won't be executed */
               print_flag = getline_flag = paren_cnt = 0 ;
               yyerrok ; }
+#line 2077 "y.tab.c"
     break;
 
-  case 20:
-
-/* Line 1455 of yacc.c  */
-#line 214 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 20: /* block_or_separator: separator  */
+#line 232 "parse.y"
+                     { (yyval.start) = code_offset ;
                        code1(_PUSHINT) ; code1(0) ;
                        code2(_PRINT, bi_print) ;
                      }
+#line 2086 "y.tab.c"
     break;
 
-  case 24:
-
-/* Line 1455 of yacc.c  */
-#line 226 "parse.y"
-    { code1(_POP) ; }
+  case 24: /* statement: expr separator  */
+#line 244 "parse.y"
+             { code1(_POP) ; }
+#line 2092 "y.tab.c"
     break;
 
-  case 25:
-
-/* Line 1455 of yacc.c  */
-#line 228 "parse.y"
-    { (yyval.start) = code_offset ; }
+  case 25: /* statement: separator  */
+#line 246 "parse.y"
+             { (yyval.start) = code_offset ; }
+#line 2098 "y.tab.c"
     break;
 
-  case 26:
-
-/* Line 1455 of yacc.c  */
-#line 230 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 26: /* statement: error separator  */
+#line 248 "parse.y"
+              { (yyval.start) = code_offset ;
                 print_flag = getline_flag = 0 ;
                 paren_cnt = 0 ;
                 yyerrok ;
               }
+#line 2108 "y.tab.c"
     break;
 
-  case 27:
-
-/* Line 1455 of yacc.c  */
-#line 236 "parse.y"
-    { (yyval.start) = code_offset ; BC_insert('B', code_ptr+1) ;
+  case 27: /* statement: BREAK separator  */
+#line 254 "parse.y"
+             { (yyval.start) = code_offset ; BC_insert('B', code_ptr+1) ;
                code2(_JMP, 0) /* don't use code_jmp ! */ ; }
+#line 2115 "y.tab.c"
     break;
 
-  case 28:
-
-/* Line 1455 of yacc.c  */
-#line 239 "parse.y"
-    { (yyval.start) = code_offset ; BC_insert('C', code_ptr+1) ;
+  case 28: /* statement: CONTINUE separator  */
+#line 257 "parse.y"
+             { (yyval.start) = code_offset ; BC_insert('C', code_ptr+1) ;
                code2(_JMP, 0) ; }
+#line 2122 "y.tab.c"
     break;
 
-  case 29:
-
-/* Line 1455 of yacc.c  */
-#line 242 "parse.y"
-    { if ( scope != SCOPE_FUNCT )
+  case 29: /* statement: return_statement  */
+#line 260 "parse.y"
+             { if ( scope != SCOPE_FUNCT )
                      compile_error("return outside function body") ;
              }
+#line 2130 "y.tab.c"
     break;
 
-  case 30:
-
-/* Line 1455 of yacc.c  */
-#line 246 "parse.y"
-    { if ( scope != SCOPE_MAIN )
+  case 30: /* statement: NEXT separator  */
+#line 264 "parse.y"
+              { if ( scope != SCOPE_MAIN )
                    compile_error( "improper use of next" ) ;
                 (yyval.start) = code_offset ;
                 code1(_NEXT) ;
               }
+#line 2140 "y.tab.c"
     break;
 
-  case 31:
-
-/* Line 1455 of yacc.c  */
-#line 252 "parse.y"
-    { if ( scope != SCOPE_MAIN )
+  case 31: /* statement: NEXTFILE separator  */
+#line 270 "parse.y"
+              { if ( scope != SCOPE_MAIN )
                    compile_error( "improper use of nextfile" ) ;
                 (yyval.start) = code_offset ;
                 code1(_NEXTFILE) ;
               }
+#line 2150 "y.tab.c"
     break;
 
-  case 35:
-
-/* Line 1455 of yacc.c  */
-#line 263 "parse.y"
-    { code1(_ASSIGN) ; }
+  case 34: /* expr: cat_expr  */
+#line 280 "parse.y"
+                    { (yyval.start) = (yyvsp[0].cat).start ; last_chain = (yyvsp[0].cat) ; }
+#line 2156 "y.tab.c"
     break;
 
-  case 36:
-
-/* Line 1455 of yacc.c  */
-#line 264 "parse.y"
-    { code1(_ADD_ASG) ; }
+  case 35: /* expr: lvalue ASSIGN expr  */
+#line 281 "parse.y"
+                                 { code_assign((yyvsp[-2].start), (yyvsp[0].start)) ; }
+#line 2162 "y.tab.c"
     break;
 
-  case 37:
-
-/* Line 1455 of yacc.c  */
-#line 265 "parse.y"
-    { code1(_SUB_ASG) ; }
+  case 36: /* expr: lvalue ADD_ASG expr  */
+#line 282 "parse.y"
+                                 { code1(_ADD_ASG) ; }
+#line 2168 "y.tab.c"
     break;
 
-  case 38:
-
-/* Line 1455 of yacc.c  */
-#line 266 "parse.y"
-    { code1(_MUL_ASG) ; }
+  case 37: /* expr: lvalue SUB_ASG expr  */
+#line 283 "parse.y"
+                                 { code1(_SUB_ASG) ; }
+#line 2174 "y.tab.c"
     break;
 
-  case 39:
-
-/* Line 1455 of yacc.c  */
-#line 267 "parse.y"
-    { code1(_DIV_ASG) ; }
+  case 38: /* expr: lvalue MUL_ASG expr  */
+#line 284 "parse.y"
+                                 { code1(_MUL_ASG) ; }
+#line 2180 "y.tab.c"
     break;
 
-  case 40:
-
-/* Line 1455 of yacc.c  */
-#line 268 "parse.y"
-    { code1(_MOD_ASG) ; }
+  case 39: /* expr: lvalue DIV_ASG expr  */
+#line 285 "parse.y"
+                                 { code1(_DIV_ASG) ; }
+#line 2186 "y.tab.c"
     break;
 
-  case 41:
-
-/* Line 1455 of yacc.c  */
-#line 269 "parse.y"
-    { code1(_POW_ASG) ; }
+  case 40: /* expr: lvalue MOD_ASG expr  */
+#line 286 "parse.y"
+                                 { code1(_MOD_ASG) ; }
+#line 2192 "y.tab.c"
     break;
 
-  case 42:
-
-/* Line 1455 of yacc.c  */
-#line 270 "parse.y"
-    { code1(_EQ) ; }
+  case 41: /* expr: lvalue POW_ASG expr  */
+#line 287 "parse.y"
+                                 { code1(_POW_ASG) ; }
+#line 2198 "y.tab.c"
     break;
 
-  case 43:
-
-/* Line 1455 of yacc.c  */
-#line 271 "parse.y"
-    { code1(_NEQ) ; }
+  case 42: /* expr: expr EQ expr  */
+#line 288 "parse.y"
+                        { code1(_EQ) ; }
+#line 2204 "y.tab.c"
     break;
 
-  case 44:
-
-/* Line 1455 of yacc.c  */
-#line 272 "parse.y"
-    { code1(_LT) ; }
+  case 43: /* expr: expr NEQ expr  */
+#line 289 "parse.y"
+                        { code1(_NEQ) ; }
+#line 2210 "y.tab.c"
     break;
 
-  case 45:
-
-/* Line 1455 of yacc.c  */
-#line 273 "parse.y"
-    { code1(_LTE) ; }
+  case 44: /* expr: expr LT expr  */
+#line 290 "parse.y"
+                       { code1(_LT) ; }
+#line 2216 "y.tab.c"
     break;
 
-  case 46:
-
-/* Line 1455 of yacc.c  */
-#line 274 "parse.y"
-    { code1(_GT) ; }
+  case 45: /* expr: expr LTE expr  */
+#line 291 "parse.y"
+                        { code1(_LTE) ; }
+#line 2222 "y.tab.c"
     break;
 
-  case 47:
-
-/* Line 1455 of yacc.c  */
-#line 275 "parse.y"
-    { code1(_GTE) ; }
+  case 46: /* expr: expr GT expr  */
+#line 292 "parse.y"
+                       { code1(_GT) ; }
+#line 2228 "y.tab.c"
     break;
 
-  case 48:
+  case 47: /* expr: expr GTE expr  */
+#line 293 "parse.y"
+                        { code1(_GTE) ; }
+#line 2234 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 278 "parse.y"
-    {
-	    INST *p3 = CDP((yyvsp[(3) - (3)].start)) ;
+  case 48: /* expr: expr MATCH expr  */
+#line 296 "parse.y"
+          {
+	    INST *p3 = CDP((yyvsp[0].start)) ;
 
             if ( p3 == code_ptr - 2 )
             {
@@ -2374,512 +2257,500 @@ yyreduce:
             }
             else code1(_MATCH2) ;
 
-            if ( !(yyvsp[(2) - (3)].ival) ) code1(_NOT) ;
+            if ( !(yyvsp[-1].ival) ) code1(_NOT) ;
           }
+#line 2263 "y.tab.c"
     break;
 
-  case 49:
-
-/* Line 1455 of yacc.c  */
-#line 305 "parse.y"
-    { code1(_TEST) ;
+  case 49: /* $@6: %empty  */
+#line 323 "parse.y"
+              { code1(_TEST) ;
                 code_jmp(_LJNZ, (INST*)0) ;
               }
+#line 2271 "y.tab.c"
     break;
 
-  case 50:
-
-/* Line 1455 of yacc.c  */
-#line 309 "parse.y"
-    { code1(_TEST) ; patch_jmp(code_ptr) ; }
+  case 50: /* expr: expr OR $@6 expr  */
+#line 327 "parse.y"
+          { code1(_TEST) ; patch_jmp(code_ptr) ; }
+#line 2277 "y.tab.c"
     break;
 
-  case 51:
-
-/* Line 1455 of yacc.c  */
-#line 312 "parse.y"
-    { code1(_TEST) ;
+  case 51: /* $@7: %empty  */
+#line 330 "parse.y"
+              { code1(_TEST) ;
 		code_jmp(_LJZ, (INST*)0) ;
 	      }
+#line 2285 "y.tab.c"
     break;
 
-  case 52:
-
-/* Line 1455 of yacc.c  */
-#line 316 "parse.y"
-    { code1(_TEST) ; patch_jmp(code_ptr) ; }
-    break;
-
-  case 53:
-
-/* Line 1455 of yacc.c  */
-#line 318 "parse.y"
-    { code_jmp(_JZ, (INST*)0) ; }
-    break;
-
-  case 54:
-
-/* Line 1455 of yacc.c  */
-#line 319 "parse.y"
-    { code_jmp(_JMP, (INST*)0) ; }
-    break;
-
-  case 55:
-
-/* Line 1455 of yacc.c  */
-#line 321 "parse.y"
-    { patch_jmp(code_ptr) ; patch_jmp(CDP((yyvsp[(7) - (7)].start))) ; }
+  case 52: /* expr: expr AND $@7 expr  */
+#line 334 "parse.y"
+              { code1(_TEST) ; patch_jmp(code_ptr) ; }
+#line 2291 "y.tab.c"
     break;
 
-  case 57:
-
-/* Line 1455 of yacc.c  */
-#line 326 "parse.y"
-    { code1(_CAT) ; }
+  case 53: /* $@8: %empty  */
+#line 336 "parse.y"
+                     { code_jmp(_JZ, (INST*)0) ; }
+#line 2297 "y.tab.c"
     break;
 
-  case 58:
-
-/* Line 1455 of yacc.c  */
-#line 330 "parse.y"
-    {  (yyval.start) = code_offset ; code2(_PUSHD, (yyvsp[(1) - (1)].ptr)) ; }
+  case 54: /* $@9: %empty  */
+#line 337 "parse.y"
+                     { code_jmp(_JMP, (INST*)0) ; }
+#line 2303 "y.tab.c"
     break;
 
-  case 59:
-
-/* Line 1455 of yacc.c  */
-#line 332 "parse.y"
-    { (yyval.start) = code_offset ; code2(_PUSHS, (yyvsp[(1) - (1)].ptr)) ; }
-    break;
-
-  case 60:
-
-/* Line 1455 of yacc.c  */
-#line 334 "parse.y"
-    { check_var((yyvsp[(1) - (1)].stp)) ;
-            (yyval.start) = code_offset ;
-            if ( is_local((yyvsp[(1) - (1)].stp)) )
-            { code2op(L_PUSHI, (yyvsp[(1) - (1)].stp)->offset) ; }
-            else code2(_PUSHI, (yyvsp[(1) - (1)].stp)->stval.cp) ;
-          }
+  case 55: /* expr: expr QMARK $@8 expr COLON $@9 expr  */
+#line 339 "parse.y"
+         { patch_jmp(code_ptr) ; patch_jmp(CDP((yyvsp[0].start))) ; }
+#line 2309 "y.tab.c"
     break;
 
-  case 61:
-
-/* Line 1455 of yacc.c  */
-#line 342 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (3)].start) ; }
+  case 56: /* cat_expr: p_expr  */
+#line 343 "parse.y"
+            { (yyval.cat).start = (yyvsp[0].start) ; (yyval.cat).cnt = 1 ; }
+#line 2315 "y.tab.c"
     break;
 
-  case 62:
-
-/* Line 1455 of yacc.c  */
-#line 346 "parse.y"
-    { (yyval.start) = code_offset ; code2(_MATCH0, (yyvsp[(1) - (1)].ptr)) ; }
+  case 57: /* cat_expr: cat_expr p_expr  */
+#line 345 "parse.y"
+            { (yyval.cat) = (yyvsp[-1].cat) ; code_cat(&(yyval.cat), (yyvsp[0].start)) ; }
+#line 2321 "y.tab.c"
     break;
 
-  case 63:
-
-/* Line 1455 of yacc.c  */
+  case 58: /* p_expr: DOUBLE  */
 #line 349 "parse.y"
-    { code1(_ADD) ; }
-    break;
-
-  case 64:
-
-/* Line 1455 of yacc.c  */
-#line 350 "parse.y"
-    { code1(_SUB) ; }
+          {  (yyval.start) = code_offset ; code2(_PUSHD, (yyvsp[0].ptr)) ; }
+#line 2327 "y.tab.c"
     break;
 
-  case 65:
-
-/* Line 1455 of yacc.c  */
+  case 59: /* p_expr: STRING_  */
 #line 351 "parse.y"
-    { code1(_MUL) ; }
+          { (yyval.start) = code_offset ; code2(_PUSHS, (yyvsp[0].ptr)) ; }
+#line 2333 "y.tab.c"
     break;
 
-  case 66:
-
-/* Line 1455 of yacc.c  */
-#line 352 "parse.y"
-    { code1(_DIV) ; }
+  case 60: /* p_expr: ID  */
+#line 353 "parse.y"
+          { check_var((yyvsp[0].stp)) ;
+            (yyval.start) = code_offset ;
+            if ( is_local((yyvsp[0].stp)) )
+            { code2op(L_PUSHI, (yyvsp[0].stp)->offset) ; }
+            else code2(_PUSHI, (yyvsp[0].stp)->stval.cp) ;
+          }
+#line 2344 "y.tab.c"
     break;
 
-  case 67:
+  case 61: /* p_expr: LPAREN expr RPAREN  */
+#line 361 "parse.y"
+          { (yyval.start) = (yyvsp[-1].start) ; }
+#line 2350 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 353 "parse.y"
-    { code1(_MOD) ; }
+  case 62: /* p_expr: RE  */
+#line 365 "parse.y"
+            { (yyval.start) = code_offset ; code2(_MATCH0, (yyvsp[0].ptr)) ; }
+#line 2356 "y.tab.c"
     break;
 
-  case 68:
+  case 63: /* p_expr: p_expr PLUS p_expr  */
+#line 368 "parse.y"
+                                  { code1(_ADD) ; }
+#line 2362 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 354 "parse.y"
-    { code1(_POW) ; }
+  case 64: /* p_expr: p_expr MINUS p_expr  */
+#line 369 "parse.y"
+                               { code1(_SUB) ; }
+#line 2368 "y.tab.c"
     break;
 
-  case 69:
+  case 65: /* p_expr: p_expr MUL p_expr  */
+#line 370 "parse.y"
+                               { code1(_MUL) ; }
+#line 2374 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 356 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (2)].start) ; code1(_NOT) ; }
+  case 66: /* p_expr: p_expr DIV p_expr  */
+#line 371 "parse.y"
+                              { code1(_DIV) ; }
+#line 2380 "y.tab.c"
     break;
 
-  case 70:
+  case 67: /* p_expr: p_expr MOD p_expr  */
+#line 372 "parse.y"
+                              { code1(_MOD) ; }
+#line 2386 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 358 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (2)].start) ; code1(_UPLUS) ; }
+  case 68: /* p_expr: p_expr POW p_expr  */
+#line 373 "parse.y"
+                              { code1(_POW) ; }
+#line 2392 "y.tab.c"
     break;
 
-  case 71:
+  case 69: /* p_expr: NOT p_expr  */
+#line 375 "parse.y"
+                { (yyval.start) = (yyvsp[0].start) ; code1(_NOT) ; }
+#line 2398 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 360 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (2)].start) ; code1(_UMINUS) ; }
+  case 70: /* p_expr: PLUS p_expr  */
+#line 377 "parse.y"
+                { (yyval.start) = (yyvsp[0].start) ; code1(_UPLUS) ; }
+#line 2404 "y.tab.c"
     break;
 
-  case 73:
+  case 71: /* p_expr: MINUS p_expr  */
+#line 379 "parse.y"
+                { (yyval.start) = (yyvsp[0].start) ; code1(_UMINUS) ; }
+#line 2410 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 365 "parse.y"
-    { check_var((yyvsp[(1) - (2)].stp)) ;
+  case 73: /* p_expr: ID INC_or_DEC  */
+#line 384 "parse.y"
+           { check_var((yyvsp[-1].stp)) ;
              (yyval.start) = code_offset ;
-             code_address((yyvsp[(1) - (2)].stp)) ;
+             code_address((yyvsp[-1].stp)) ;
 
-             if ( (yyvsp[(2) - (2)].ival) == '+' )  code1(_POST_INC) ;
+             if ( (yyvsp[0].ival) == '+' )  code1(_POST_INC) ;
              else  code1(_POST_DEC) ;
            }
+#line 2422 "y.tab.c"
     break;
 
-  case 74:
-
-/* Line 1455 of yacc.c  */
-#line 373 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (2)].start) ;
-              if ( (yyvsp[(1) - (2)].ival) == '+' ) code1(_PRE_INC) ;
+  case 74: /* p_expr: INC_or_DEC lvalue  */
+#line 392 "parse.y"
+            { (yyval.start) = (yyvsp[0].start) ;
+              if ( (yyvsp[-1].ival) == '+' ) code1(_PRE_INC) ;
               else  code1(_PRE_DEC) ;
             }
+#line 2431 "y.tab.c"
     break;
 
-  case 75:
-
-/* Line 1455 of yacc.c  */
-#line 380 "parse.y"
-    { if ((yyvsp[(2) - (2)].ival) == '+' ) code1(F_POST_INC ) ;
+  case 75: /* p_expr: field INC_or_DEC  */
+#line 399 "parse.y"
+           { if ((yyvsp[0].ival) == '+' ) code1(F_POST_INC ) ;
              else  code1(F_POST_DEC) ;
            }
+#line 2439 "y.tab.c"
     break;
 
-  case 76:
-
-/* Line 1455 of yacc.c  */
-#line 384 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (2)].start) ;
-             if ( (yyvsp[(1) - (2)].ival) == '+' ) code1(F_PRE_INC) ;
+  case 76: /* p_expr: INC_or_DEC field  */
+#line 403 "parse.y"
+           { (yyval.start) = (yyvsp[0].start) ;
+             if ( (yyvsp[-1].ival) == '+' ) code1(F_PRE_INC) ;
              else  code1( F_PRE_DEC) ;
            }
+#line 2448 "y.tab.c"
     break;
 
-  case 77:
-
-/* Line 1455 of yacc.c  */
-#line 391 "parse.y"
-    { (yyval.start) = code_offset ;
-          check_var((yyvsp[(1) - (1)].stp)) ;
-          code_address((yyvsp[(1) - (1)].stp)) ;
+  case 77: /* lvalue: ID  */
+#line 410 "parse.y"
+        { (yyval.start) = code_offset ;
+          check_var((yyvsp[0].stp)) ;
+          code_address((yyvsp[0].stp)) ;
         }
+#line 2457 "y.tab.c"
     break;
 
-  case 78:
-
-/* Line 1455 of yacc.c  */
-#line 399 "parse.y"
-    { (yyval.ival) = 0 ; }
+  case 78: /* arglist: %empty  */
+#line 418 "parse.y"
+            { (yyval.ival) = 0 ; }
+#line 2463 "y.tab.c"
     break;
 
-  case 80:
-
-/* Line 1455 of yacc.c  */
-#line 404 "parse.y"
-    { (yyval.ival) = 1 ; }
+  case 80: /* args: expr  */
+#line 423 "parse.y"
+            { (yyval.ival) = 1 ; }
+#line 2469 "y.tab.c"
     break;
 
-  case 81:
-
-/* Line 1455 of yacc.c  */
-#line 406 "parse.y"
-    { (yyval.ival) = (yyvsp[(1) - (3)].ival) + 1 ; }
+  case 81: /* args: args COMMA expr  */
+#line 425 "parse.y"
+            { (yyval.ival) = (yyvsp[-2].ival) + 1 ; }
+#line 2475 "y.tab.c"
     break;
 
-  case 82:
-
-/* Line 1455 of yacc.c  */
-#line 411 "parse.y"
-    { BI_REC *p = (yyvsp[(1) - (5)].bip) ;
-          (yyval.start) = (yyvsp[(2) - (5)].start) ;
-          if ( (int)p->min_args > (yyvsp[(4) - (5)].ival) || (int)p->max_args < (yyvsp[(4) - (5)].ival) )
+  case 82: /* builtin: BUILTIN mark LPAREN arglist RPAREN  */
+#line 430 "parse.y"
+        { BI_REC *p = (yyvsp[-4].bip) ;
+          (yyval.start) = (yyvsp[-3].start) ;
+          if ( (int)p->min_args > (yyvsp[-1].ival) || (int)p->max_args < (yyvsp[-1].ival) )
             compile_error(
             "wrong number of arguments in call to %s" ,
             p->name ) ;
           if ( p->min_args != p->max_args ) /* variable args */
-              { code1(_PUSHINT) ;  code1((yyvsp[(4) - (5)].ival)) ; }
+              { code1(_PUSHINT) ;  code1((yyvsp[-1].ival)) ; }
           code2(_BUILTIN , p->fp) ;
         }
+#line 2490 "y.tab.c"
     break;
 
-  case 83:
-
-/* Line 1455 of yacc.c  */
-#line 430 "parse.y"
-    {   (yyval.start) = (yyvsp[(2) - (4)].start) ;
+  case 83: /* builtin: SPRINTF mark LPAREN RPAREN  */
+#line 449 "parse.y"
+          {   (yyval.start) = (yyvsp[-2].start) ;
 	      compile_error("no argments in call to sprintf()") ;
 	  }
+#line 2498 "y.tab.c"
     break;
 
-  case 84:
-
-/* Line 1455 of yacc.c  */
-#line 434 "parse.y"
-    {   /* the usual case */
-	      const Form* form = (Form*) (yyvsp[(4) - (6)].ptr) ;
-	      (yyval.start) = (yyvsp[(2) - (6)].start) ;
-	      if (form && form->num_args != (yyvsp[(5) - (6)].ival)) {
+  case 84: /* builtin: SPRINTF mark LPAREN string_comma args RPAREN  */
+#line 453 "parse.y"
+          {   /* the usual case */
+	      const Form* form = (Form*) (yyvsp[-2].ptr) ;
+	      (yyval.start) = (yyvsp[-4].start) ;
+	      if (form && form->num_args != (yyvsp[-1].ival)) {
    compile_error("wrong number of arguments to sprintf, needs %d, has %d",
-                    form->num_args+1, (yyvsp[(5) - (6)].ival)+1) ;
+                    form->num_args+1, (yyvsp[-1].ival)+1) ;
               }
-	      code2op(_PUSHINT, (yyvsp[(5) - (6)].ival) + 1) ;
+	      code2op(_PUSHINT, (yyvsp[-1].ival) + 1) ;
 	      code2(_BUILTIN, bi_sprintf) ;
 	  }
+#line 2513 "y.tab.c"
     break;
 
-  case 85:
-
-/* Line 1455 of yacc.c  */
-#line 445 "parse.y"
-    {
-	      (yyval.start) = (yyvsp[(2) - (5)].start) ;
-	      code2op(_PUSHINT, (yyvsp[(4) - (5)].ival)) ;
+  case 85: /* builtin: SPRINTF mark LPAREN args RPAREN  */
+#line 464 "parse.y"
+          {
+	      (yyval.start) = (yyvsp[-3].start) ;
+	      code2op(_PUSHINT, (yyvsp[-1].ival)) ;
 	      code2(_BUILTIN, bi_sprintf1) ;
 	  }
+#line 2523 "y.tab.c"
     break;
 
-  case 86:
-
-/* Line 1455 of yacc.c  */
-#line 453 "parse.y"
-    {
-	           STRING* str = (STRING*) (yyvsp[(1) - (2)].ptr) ;
+  case 86: /* string_comma: STRING_ COMMA  */
+#line 472 "parse.y"
+               {
+	           STRING* str = (STRING*) (yyvsp[-1].ptr) ;
 		   const Form* form = parse_form(str) ;
 		   free_STRING(str) ;
 		   (yyval.ptr) = (PTR) form ;
 		   code2(PUSHFM, form) ;
 		}
+#line 2535 "y.tab.c"
     break;
 
-  case 87:
-
-/* Line 1455 of yacc.c  */
-#line 466 "parse.y"
-    { (yyval.start) = code_offset ; }
+  case 87: /* mark: %empty  */
+#line 485 "parse.y"
+         { (yyval.start) = code_offset ; }
+#line 2541 "y.tab.c"
     break;
 
-  case 88:
-
-/* Line 1455 of yacc.c  */
-#line 470 "parse.y"
-    { code2(_PRINT, bi_print) ;
+  case 88: /* statement: PRINT pmark print_args pr_direction separator  */
+#line 489 "parse.y"
+            { code2(_PRINT, bi_print) ;
               print_flag = 0 ;
-              (yyval.start) = (yyvsp[(2) - (5)].start) ;
+              (yyval.start) = (yyvsp[-3].start) ;
             }
+#line 2550 "y.tab.c"
     break;
 
-  case 89:
-
-/* Line 1455 of yacc.c  */
-#line 484 "parse.y"
-    { code2(_PRINT, bi_printf1) ;
+  case 89: /* statement: PRINTF pmark pr_args pr_direction separator  */
+#line 503 "parse.y"
+            { code2(_PRINT, bi_printf1) ;
               print_flag = 0 ;
-              (yyval.start) = (yyvsp[(2) - (5)].start) ;
-	      if ((yyvsp[(3) - (5)].ival) == 0) {
+              (yyval.start) = (yyvsp[-3].start) ;
+	      if ((yyvsp[-2].ival) == 0) {
 	          compile_error("no arguments in call to printf") ;
 	      }
 	    }
+#line 2562 "y.tab.c"
     break;
 
-  case 90:
-
-/* Line 1455 of yacc.c  */
-#line 492 "parse.y"
-    {  const Form* form = (Form*) (yyvsp[(3) - (6)].ptr) ;
-	        if (form && form->num_args != (yyvsp[(4) - (6)].ival)) {
+  case 90: /* statement: PRINTF pmark string_comma printf_args pr_direction separator  */
+#line 511 "parse.y"
+             {  const Form* form = (Form*) (yyvsp[-3].ptr) ;
+	        if (form && form->num_args != (yyvsp[-2].ival)) {
    compile_error("wrong number of arguments to printf, needs %d, has %d",
-                    form->num_args+1, (yyvsp[(4) - (6)].ival)+1) ;
+                    form->num_args+1, (yyvsp[-2].ival)+1) ;
 		}
 	        code2(_PRINT, bi_printf) ;
 	        print_flag = 0 ;
-		(yyval.start) = (yyvsp[(2) - (6)].start) ;
+		(yyval.start) = (yyvsp[-4].start) ;
 	     }
+#line 2576 "y.tab.c"
     break;
 
-  case 91:
-
-/* Line 1455 of yacc.c  */
-#line 502 "parse.y"
-    {  const Form* form = (Form*) (yyvsp[(4) - (8)].ptr) ;
-	        if (form && form->num_args != (yyvsp[(5) - (8)].ival)) {
+  case 91: /* statement: PRINTF pmark LPAREN string_comma printf_args RPAREN pr_direction separator  */
+#line 521 "parse.y"
+             {  const Form* form = (Form*) (yyvsp[-4].ptr) ;
+	        if (form && form->num_args != (yyvsp[-3].ival)) {
    compile_error("wrong number of arguments to printf, needs %d, has %d",
-                    form->num_args+1, (yyvsp[(5) - (8)].ival)+1) ;
+                    form->num_args+1, (yyvsp[-3].ival)+1) ;
 		}
 	        code2(_PRINT, bi_printf) ;
 	        print_flag = 0 ;
-		(yyval.start) = (yyvsp[(2) - (8)].start) ;
+		(yyval.start) = (yyvsp[-6].start) ;
 	     }
+#line 2590 "y.tab.c"
     break;
 
-  case 92:
-
-/* Line 1455 of yacc.c  */
-#line 514 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 92: /* pmark: %empty  */
+#line 533 "parse.y"
+           { (yyval.start) = code_offset ;
 	     print_flag = 1 ;
 	   }
+#line 2598 "y.tab.c"
     break;
 
-  case 93:
-
-/* Line 1455 of yacc.c  */
-#line 520 "parse.y"
-    { code2op(_PUSHINT, (yyvsp[(1) - (1)].ival) + 1) ;
+  case 93: /* printf_args: args  */
+#line 539 "parse.y"
+           { code2op(_PUSHINT, (yyvsp[0].ival) + 1) ;
 	   }
+#line 2605 "y.tab.c"
     break;
 
-  case 94:
-
-/* Line 1455 of yacc.c  */
-#line 524 "parse.y"
-    { code2op(_PUSHINT, (yyvsp[(1) - (1)].ival)) ; }
+  case 94: /* pr_args: arglist  */
+#line 543 "parse.y"
+                   { code2op(_PUSHINT, (yyvsp[0].ival)) ; }
+#line 2611 "y.tab.c"
     break;
 
-  case 95:
-
-/* Line 1455 of yacc.c  */
-#line 526 "parse.y"
-    { (yyval.ival) = (yyvsp[(2) - (3)].arg2p)->cnt ; zfree((yyvsp[(2) - (3)].arg2p),sizeof(ARG2_REC)) ;
+  case 95: /* pr_args: LPAREN arg2 RPAREN  */
+#line 545 "parse.y"
+           { (yyval.ival) = (yyvsp[-1].arg2p)->cnt ; zfree((yyvsp[-1].arg2p),sizeof(ARG2_REC)) ;
              code2op(_PUSHINT, (yyval.ival)) ;
            }
+#line 2619 "y.tab.c"
     break;
 
-  case 96:
-
-/* Line 1455 of yacc.c  */
-#line 530 "parse.y"
-    { (yyval.ival)=0 ; code2op(_PUSHINT, 0) ; }
+  case 96: /* pr_args: LPAREN RPAREN  */
+#line 549 "parse.y"
+           { (yyval.ival)=0 ; code2op(_PUSHINT, 0) ; }
+#line 2625 "y.tab.c"
     break;
 
-  case 97:
-
-/* Line 1455 of yacc.c  */
-#line 534 "parse.y"
-    { (yyval.arg2p) = (ARG2_REC*) zmalloc(sizeof(ARG2_REC)) ;
-             (yyval.arg2p)->start = (yyvsp[(1) - (3)].start) ;
-             (yyval.arg2p)->cnt = 2 ;
-           }
+  case 97: /* print_args: %empty  */
+#line 555 "parse.y"
+              { (yyval.ival) = 0 ; code2op(_PUSHINT, 0) ; }
+#line 2631 "y.tab.c"
     break;
 
-  case 98:
+  case 98: /* print_args: print_list  */
+#line 556 "parse.y"
+                         { code2op(_PUSHINT, (yyvsp[0].ival)) ; }
+#line 2637 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 539 "parse.y"
-    { (yyval.arg2p) = (yyvsp[(1) - (3)].arg2p) ; (yyval.arg2p)->cnt++ ; }
+  case 99: /* print_args: LPAREN arg2 RPAREN  */
+#line 558 "parse.y"
+              { (yyval.ival) = (yyvsp[-1].arg2p)->cnt ; zfree((yyvsp[-1].arg2p),sizeof(ARG2_REC)) ;
+		code2op(_PUSHINT, (yyval.ival)) ;
+	      }
+#line 2645 "y.tab.c"
     break;
 
-  case 100:
+  case 100: /* print_args: LPAREN RPAREN  */
+#line 562 "parse.y"
+              { (yyval.ival)=0 ; code2op(_PUSHINT, 0) ; }
+#line 2651 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 544 "parse.y"
-    { code2op(_PUSHINT, (yyvsp[(1) - (2)].ival)) ; }
+  case 101: /* print_list: expr  */
+#line 566 "parse.y"
+              { (yyval.ival) = 1 ; code_slice(CDP((yyvsp[0].start)), code_ptr) ; }
+#line 2657 "y.tab.c"
     break;
 
-  case 101:
+  case 102: /* print_list: print_list COMMA expr  */
+#line 568 "parse.y"
+              { (yyval.ival) = (yyvsp[-2].ival) + 1 ; code_slice(CDP((yyvsp[0].start)), code_ptr) ; }
+#line 2663 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 551 "parse.y"
-    {  (yyval.start) = (yyvsp[(3) - (4)].start) ; eat_nl() ; code_jmp(_JZ, (INST*)0) ; }
+  case 103: /* arg2: expr COMMA expr  */
+#line 572 "parse.y"
+           { (yyval.arg2p) = (ARG2_REC*) zmalloc(sizeof(ARG2_REC)) ;
+             (yyval.arg2p)->start = (yyvsp[-2].start) ;
+             (yyval.arg2p)->cnt = 2 ;
+           }
+#line 2672 "y.tab.c"
     break;
 
-  case 102:
+  case 104: /* arg2: arg2 COMMA expr  */
+#line 577 "parse.y"
+            { (yyval.arg2p) = (yyvsp[-2].arg2p) ; (yyval.arg2p)->cnt++ ; }
+#line 2678 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 556 "parse.y"
-    { patch_jmp( code_ptr ) ;  }
+  case 106: /* pr_direction: IO_OUT expr  */
+#line 582 "parse.y"
+                { code2op(_PUSHINT, (yyvsp[-1].ival)) ; }
+#line 2684 "y.tab.c"
     break;
 
-  case 103:
+  case 107: /* if_front: IF LPAREN expr RPAREN  */
+#line 589 "parse.y"
+            {  (yyval.start) = (yyvsp[-1].start) ; eat_nl() ; code_jmp(_JZ, (INST*)0) ; }
+#line 2690 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 559 "parse.y"
-    { eat_nl() ; code_jmp(_JMP, (INST*)0) ; }
+  case 108: /* statement: if_front statement  */
+#line 594 "parse.y"
+                { patch_jmp( code_ptr ) ;  }
+#line 2696 "y.tab.c"
     break;
 
-  case 104:
+  case 109: /* else: ELSE  */
+#line 597 "parse.y"
+                { eat_nl() ; code_jmp(_JMP, (INST*)0) ; }
+#line 2702 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 564 "parse.y"
-    { patch_jmp(code_ptr) ;
-		  patch_jmp(CDP((yyvsp[(4) - (4)].start))) ;
+  case 110: /* statement: if_front statement else statement  */
+#line 602 "parse.y"
+                { patch_jmp(code_ptr) ;
+		  patch_jmp(CDP((yyvsp[0].start))) ;
 		}
+#line 2710 "y.tab.c"
     break;
 
-  case 105:
-
-/* Line 1455 of yacc.c  */
-#line 572 "parse.y"
-    { eat_nl() ; BC_new() ; }
+  case 111: /* do: DO  */
+#line 610 "parse.y"
+        { eat_nl() ; BC_new() ; }
+#line 2716 "y.tab.c"
     break;
 
-  case 106:
-
-/* Line 1455 of yacc.c  */
-#line 577 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (7)].start) ;
-          code_jmp(_JNZ, CDP((yyvsp[(2) - (7)].start))) ;
-          BC_clear(code_ptr, CDP((yyvsp[(5) - (7)].start))) ; }
+  case 112: /* statement: do statement WHILE LPAREN expr RPAREN separator  */
+#line 615 "parse.y"
+        { (yyval.start) = (yyvsp[-5].start) ;
+          code_jmp(_JNZ, CDP((yyvsp[-5].start))) ;
+          BC_clear(code_ptr, CDP((yyvsp[-2].start))) ; }
+#line 2724 "y.tab.c"
     break;
 
-  case 107:
-
-/* Line 1455 of yacc.c  */
-#line 583 "parse.y"
-    { eat_nl() ; BC_new() ;
-                  (yyval.start) = (yyvsp[(3) - (4)].start) ;
+  case 113: /* while_front: WHILE LPAREN expr RPAREN  */
+#line 621 "parse.y"
+                { eat_nl() ; BC_new() ;
+                  (yyval.start) = (yyvsp[-1].start) ;
 
                   /* check if const expression */
-                  if ( code_ptr - 2 == CDP((yyvsp[(3) - (4)].start)) &&
+                  if ( code_ptr - 2 == CDP((yyvsp[-1].start)) &&
                        code_ptr[-2].op == _PUSHD &&
                        *(double*)code_ptr[-1].ptr != 0.0
                      )
                      code_ptr -= 2 ;
                   else
-		  { INST *p3 = CDP((yyvsp[(3) - (4)].start)) ;
+		  { INST *p3 = CDP((yyvsp[-1].start)) ;
 		    code_push(p3, code_ptr-p3, scope, active_funct) ;
 		    code_ptr = p3 ;
                     code2(_JMP, (INST*)0) ; /* code2() not code_jmp() */
 		  }
                 }
+#line 2745 "y.tab.c"
     break;
 
-  case 108:
-
-/* Line 1455 of yacc.c  */
-#line 603 "parse.y"
-    {
+  case 114: /* statement: while_front statement  */
+#line 641 "parse.y"
+                {
 		  int  saved_offset ;
 		  int len ;
-		  INST *p1 = CDP((yyvsp[(1) - (2)].start)) ;
-		  INST *p2 = CDP((yyvsp[(2) - (2)].start)) ;
+		  INST *p1 = CDP((yyvsp[-1].start)) ;
+		  INST *p2 = CDP((yyvsp[0].start)) ;
 
                   if ( p1 != p2 )  /* real test in loop */
 		  {
@@ -2887,26 +2758,25 @@ yyreduce:
 		    saved_offset = code_offset ;
 		    len = code_pop(code_ptr) ;
 		    code_ptr += len ;
-		    code_jmp(_JNZ, CDP((yyvsp[(2) - (2)].start))) ;
+		    code_jmp(_JNZ, CDP((yyvsp[0].start))) ;
 		    BC_clear(code_ptr, CDP(saved_offset)) ;
 		  }
 		  else /* while(1) */
 		  {
 		    code_jmp(_JMP, p1) ;
-		    BC_clear(code_ptr, CDP((yyvsp[(2) - (2)].start))) ;
+		    BC_clear(code_ptr, CDP((yyvsp[0].start))) ;
 		  }
                 }
+#line 2771 "y.tab.c"
     break;
 
-  case 109:
-
-/* Line 1455 of yacc.c  */
-#line 629 "parse.y"
-    {
+  case 115: /* statement: for1 for2 for3 statement  */
+#line 667 "parse.y"
+                {
 		  int cont_offset = code_offset ;
                   unsigned len = code_pop(code_ptr) ;
-		  INST *p2 = CDP((yyvsp[(2) - (4)].start)) ;
-		  INST *p4 = CDP((yyvsp[(4) - (4)].start)) ;
+		  INST *p2 = CDP((yyvsp[-2].start)) ;
+		  INST *p4 = CDP((yyvsp[0].start)) ;
 
                   code_ptr += len ;
 
@@ -2915,7 +2785,7 @@ yyreduce:
                     p4[-1].op = code_ptr - p4 + 1 ;
 		    len = code_pop(code_ptr) ;
 		    code_ptr += len ;
-                    code_jmp(_JNZ, CDP((yyvsp[(4) - (4)].start))) ;
+                    code_jmp(_JNZ, CDP((yyvsp[0].start))) ;
 		  }
 		  else /*  for(;;) */
 		  code_jmp(_JMP, p4) ;
@@ -2923,341 +2793,309 @@ yyreduce:
 		  BC_clear(code_ptr, CDP(cont_offset)) ;
 
                 }
+#line 2797 "y.tab.c"
     break;
 
-  case 110:
-
-/* Line 1455 of yacc.c  */
-#line 652 "parse.y"
-    { (yyval.start) = code_offset ; }
+  case 116: /* for1: FOR LPAREN SEMI_COLON  */
+#line 690 "parse.y"
+                                    { (yyval.start) = code_offset ; }
+#line 2803 "y.tab.c"
     break;
 
-  case 111:
-
-/* Line 1455 of yacc.c  */
-#line 654 "parse.y"
-    { (yyval.start) = (yyvsp[(3) - (4)].start) ; code1(_POP) ; }
+  case 117: /* for1: FOR LPAREN expr SEMI_COLON  */
+#line 692 "parse.y"
+           { (yyval.start) = (yyvsp[-1].start) ; code1(_POP) ; }
+#line 2809 "y.tab.c"
     break;
 
-  case 112:
-
-/* Line 1455 of yacc.c  */
-#line 657 "parse.y"
-    { (yyval.start) = code_offset ; }
+  case 118: /* for2: SEMI_COLON  */
+#line 695 "parse.y"
+                        { (yyval.start) = code_offset ; }
+#line 2815 "y.tab.c"
     break;
 
-  case 113:
-
-/* Line 1455 of yacc.c  */
-#line 659 "parse.y"
-    {
-             if ( code_ptr - 2 == CDP((yyvsp[(1) - (2)].start)) &&
+  case 119: /* for2: expr SEMI_COLON  */
+#line 697 "parse.y"
+           {
+             if ( code_ptr - 2 == CDP((yyvsp[-1].start)) &&
                   code_ptr[-2].op == _PUSHD &&
                   * (double*) code_ptr[-1].ptr != 0.0
                 )
                     code_ptr -= 2 ;
              else
 	     {
-	       INST *p1 = CDP((yyvsp[(1) - (2)].start)) ;
+	       INST *p1 = CDP((yyvsp[-1].start)) ;
 	       code_push(p1, code_ptr-p1, scope, active_funct) ;
 	       code_ptr = p1 ;
 	       code2(_JMP, (INST*)0) ;
 	     }
            }
+#line 2834 "y.tab.c"
     break;
 
-  case 114:
-
-/* Line 1455 of yacc.c  */
-#line 676 "parse.y"
-    { eat_nl() ; BC_new() ;
+  case 120: /* for3: RPAREN  */
+#line 714 "parse.y"
+           { eat_nl() ; BC_new() ;
 	     code_push((INST*)0,0, scope, active_funct) ;
 	   }
+#line 2842 "y.tab.c"
     break;
 
-  case 115:
-
-/* Line 1455 of yacc.c  */
-#line 680 "parse.y"
-    { INST *p1 = CDP((yyvsp[(1) - (2)].start)) ;
+  case 121: /* for3: expr RPAREN  */
+#line 718 "parse.y"
+           { INST *p1 = CDP((yyvsp[-1].start)) ;
 
 	     eat_nl() ; BC_new() ;
              code1(_POP) ;
              code_push(p1, code_ptr - p1, scope, active_funct) ;
              code_ptr -= code_ptr - p1 ;
            }
+#line 2854 "y.tab.c"
     break;
 
-  case 116:
-
-/* Line 1455 of yacc.c  */
-#line 693 "parse.y"
-    { check_array((yyvsp[(3) - (3)].stp)) ;
-             code_array((yyvsp[(3) - (3)].stp)) ;
+  case 122: /* expr: expr IN ID  */
+#line 731 "parse.y"
+           { check_array((yyvsp[0].stp)) ;
+             code_array((yyvsp[0].stp)) ;
              code1(A_TEST) ;
             }
+#line 2863 "y.tab.c"
     break;
 
-  case 117:
-
-/* Line 1455 of yacc.c  */
-#line 698 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (5)].arg2p)->start ;
-             code2op(A_CAT, (yyvsp[(2) - (5)].arg2p)->cnt) ;
-             zfree((yyvsp[(2) - (5)].arg2p), sizeof(ARG2_REC)) ;
+  case 123: /* expr: LPAREN arg2 RPAREN IN ID  */
+#line 736 "parse.y"
+           { (yyval.start) = (yyvsp[-3].arg2p)->start ;
+             code2op(A_CAT, (yyvsp[-3].arg2p)->cnt) ;
+             zfree((yyvsp[-3].arg2p), sizeof(ARG2_REC)) ;
 
-             check_array((yyvsp[(5) - (5)].stp)) ;
-             code_array((yyvsp[(5) - (5)].stp)) ;
+             check_array((yyvsp[0].stp)) ;
+             code_array((yyvsp[0].stp)) ;
              code1(A_TEST) ;
            }
+#line 2876 "y.tab.c"
     break;
 
-  case 118:
+  case 124: /* lvalue: ID mark LBOX args RBOX  */
+#line 747 "parse.y"
+           {
+             if ( (yyvsp[-1].ival) > 1 )
+             { code2op(A_CAT, (yyvsp[-1].ival)) ; }
 
-/* Line 1455 of yacc.c  */
-#line 709 "parse.y"
-    {
-             if ( (yyvsp[(4) - (5)].ival) > 1 )
-             { code2op(A_CAT, (yyvsp[(4) - (5)].ival)) ; }
-
-             check_array((yyvsp[(1) - (5)].stp)) ;
-             if( is_local((yyvsp[(1) - (5)].stp)) )
-             { code2op(LAE_PUSHA, (yyvsp[(1) - (5)].stp)->offset) ; }
-             else code2(AE_PUSHA, (yyvsp[(1) - (5)].stp)->stval.array) ;
-             (yyval.start) = (yyvsp[(2) - (5)].start) ;
+             check_array((yyvsp[-4].stp)) ;
+             if( is_local((yyvsp[-4].stp)) )
+             { code2op(LAE_PUSHA, (yyvsp[-4].stp)->offset) ; }
+             else code2(AE_PUSHA, (yyvsp[-4].stp)->stval.array) ;
+             (yyval.start) = (yyvsp[-3].start) ;
            }
+#line 2891 "y.tab.c"
     break;
 
-  case 119:
+  case 125: /* p_expr: ID mark LBOX args RBOX  */
+#line 760 "parse.y"
+           {
+             if ( (yyvsp[-1].ival) > 1 )
+             { code2op(A_CAT, (yyvsp[-1].ival)) ; }
 
-/* Line 1455 of yacc.c  */
-#line 722 "parse.y"
-    {
-             if ( (yyvsp[(4) - (5)].ival) > 1 )
-             { code2op(A_CAT, (yyvsp[(4) - (5)].ival)) ; }
-
-             check_array((yyvsp[(1) - (5)].stp)) ;
-             if( is_local((yyvsp[(1) - (5)].stp)) )
-             { code2op(LAE_PUSHI, (yyvsp[(1) - (5)].stp)->offset) ; }
-             else code2(AE_PUSHI, (yyvsp[(1) - (5)].stp)->stval.array) ;
-             (yyval.start) = (yyvsp[(2) - (5)].start) ;
+             check_array((yyvsp[-4].stp)) ;
+             if( is_local((yyvsp[-4].stp)) )
+             { code2op(LAE_PUSHI, (yyvsp[-4].stp)->offset) ; }
+             else code2(AE_PUSHI, (yyvsp[-4].stp)->stval.array) ;
+             (yyval.start) = (yyvsp[-3].start) ;
            }
+#line 2906 "y.tab.c"
     break;
 
-  case 120:
+  case 126: /* p_expr: ID mark LBOX args RBOX INC_or_DEC  */
+#line 772 "parse.y"
+           {
+             if ( (yyvsp[-2].ival) > 1 )
+             { code2op(A_CAT,(yyvsp[-2].ival)) ; }
 
-/* Line 1455 of yacc.c  */
-#line 734 "parse.y"
-    {
-             if ( (yyvsp[(4) - (6)].ival) > 1 )
-             { code2op(A_CAT,(yyvsp[(4) - (6)].ival)) ; }
-
-             check_array((yyvsp[(1) - (6)].stp)) ;
-             if( is_local((yyvsp[(1) - (6)].stp)) )
-             { code2op(LAE_PUSHA, (yyvsp[(1) - (6)].stp)->offset) ; }
-             else code2(AE_PUSHA, (yyvsp[(1) - (6)].stp)->stval.array) ;
-             if ( (yyvsp[(6) - (6)].ival) == '+' )  code1(_POST_INC) ;
+             check_array((yyvsp[-5].stp)) ;
+             if( is_local((yyvsp[-5].stp)) )
+             { code2op(LAE_PUSHA, (yyvsp[-5].stp)->offset) ; }
+             else code2(AE_PUSHA, (yyvsp[-5].stp)->stval.array) ;
+             if ( (yyvsp[0].ival) == '+' )  code1(_POST_INC) ;
              else  code1(_POST_DEC) ;
 
-             (yyval.start) = (yyvsp[(2) - (6)].start) ;
+             (yyval.start) = (yyvsp[-4].start) ;
            }
+#line 2924 "y.tab.c"
     break;
 
-  case 121:
-
-/* Line 1455 of yacc.c  */
-#line 751 "parse.y"
-    {
-               (yyval.start) = (yyvsp[(3) - (7)].start) ;
-               if ( (yyvsp[(5) - (7)].ival) > 1 ) { code2op(A_CAT, (yyvsp[(5) - (7)].ival)) ; }
-               check_array((yyvsp[(2) - (7)].stp)) ;
-               code_array((yyvsp[(2) - (7)].stp)) ;
+  case 127: /* statement: DELETE ID mark LBOX args RBOX separator  */
+#line 789 "parse.y"
+             {
+               (yyval.start) = (yyvsp[-4].start) ;
+               if ( (yyvsp[-2].ival) > 1 ) { code2op(A_CAT, (yyvsp[-2].ival)) ; }
+               check_array((yyvsp[-5].stp)) ;
+               code_array((yyvsp[-5].stp)) ;
                code1(A_DEL) ;
              }
+#line 2936 "y.tab.c"
     break;
 
-  case 122:
-
-/* Line 1455 of yacc.c  */
-#line 759 "parse.y"
-    {
+  case 128: /* statement: DELETE ID separator  */
+#line 797 "parse.y"
+             {
 		(yyval.start) = code_offset ;
-		check_array((yyvsp[(2) - (3)].stp)) ;
-		code_array((yyvsp[(2) - (3)].stp)) ;
+		check_array((yyvsp[-1].stp)) ;
+		code_array((yyvsp[-1].stp)) ;
 		code1(DEL_A) ;
 	     }
+#line 2947 "y.tab.c"
     break;
 
-  case 123:
-
-/* Line 1455 of yacc.c  */
-#line 770 "parse.y"
-    { eat_nl() ; BC_new() ;
+  case 129: /* array_loop_front: FOR LPAREN ID IN ID RPAREN  */
+#line 808 "parse.y"
+                    { eat_nl() ; BC_new() ;
                       (yyval.start) = code_offset ;
 
-                      check_var((yyvsp[(3) - (6)].stp)) ;
-                      code_address((yyvsp[(3) - (6)].stp)) ;
-                      check_array((yyvsp[(5) - (6)].stp)) ;
-                      code_array((yyvsp[(5) - (6)].stp)) ;
+                      check_var((yyvsp[-3].stp)) ;
+                      code_address((yyvsp[-3].stp)) ;
+                      check_array((yyvsp[-1].stp)) ;
+                      code_array((yyvsp[-1].stp)) ;
 
                       code2(SET_ALOOP, (INST*)0) ;
                     }
+#line 2962 "y.tab.c"
     break;
 
-  case 124:
-
-/* Line 1455 of yacc.c  */
-#line 784 "parse.y"
-    {
-		INST *p2 = CDP((yyvsp[(2) - (2)].start)) ;
+  case 130: /* statement: array_loop_front statement  */
+#line 822 "parse.y"
+              {
+		INST *p2 = CDP((yyvsp[0].start)) ;
 
 	        p2[-1].op = code_ptr - p2 + 1 ;
                 BC_clear( code_ptr+2 , code_ptr) ;
 		code_jmp(ALOOP, p2) ;
 		code1(POP_AL) ;
               }
+#line 2975 "y.tab.c"
     break;
 
-  case 125:
-
-/* Line 1455 of yacc.c  */
-#line 801 "parse.y"
-    { (yyval.start) = code_offset ; code2(F_PUSHA, (yyvsp[(1) - (1)].cp)) ; }
+  case 131: /* field: FIELD  */
+#line 839 "parse.y"
+           { (yyval.start) = code_offset ; code2(F_PUSHA, (yyvsp[0].cp)) ; }
+#line 2981 "y.tab.c"
     break;
 
-  case 126:
-
-/* Line 1455 of yacc.c  */
-#line 803 "parse.y"
-    { check_var((yyvsp[(2) - (2)].stp)) ;
+  case 132: /* field: DOLLAR D_ID  */
+#line 841 "parse.y"
+           { check_var((yyvsp[0].stp)) ;
              (yyval.start) = code_offset ;
-             if ( is_local((yyvsp[(2) - (2)].stp)) )
-             { code2op(L_PUSHI, (yyvsp[(2) - (2)].stp)->offset) ; }
-             else code2(_PUSHI, (yyvsp[(2) - (2)].stp)->stval.cp) ;
+             if ( is_local((yyvsp[0].stp)) )
+             { code2op(L_PUSHI, (yyvsp[0].stp)->offset) ; }
+             else code2(_PUSHI, (yyvsp[0].stp)->stval.cp) ;
 
 	     CODE_FE_PUSHA() ;
            }
+#line 2994 "y.tab.c"
     break;
 
-  case 127:
-
-/* Line 1455 of yacc.c  */
-#line 812 "parse.y"
-    {
-             if ( (yyvsp[(5) - (6)].ival) > 1 )
-             { code2op(A_CAT, (yyvsp[(5) - (6)].ival)) ; }
+  case 133: /* field: DOLLAR D_ID mark LBOX args RBOX  */
+#line 850 "parse.y"
+           {
+             if ( (yyvsp[-1].ival) > 1 )
+             { code2op(A_CAT, (yyvsp[-1].ival)) ; }
 
-             check_array((yyvsp[(2) - (6)].stp)) ;
-             if( is_local((yyvsp[(2) - (6)].stp)) )
-             { code2op(LAE_PUSHI, (yyvsp[(2) - (6)].stp)->offset) ; }
-             else code2(AE_PUSHI, (yyvsp[(2) - (6)].stp)->stval.array) ;
+             check_array((yyvsp[-4].stp)) ;
+             if( is_local((yyvsp[-4].stp)) )
+             { code2op(LAE_PUSHI, (yyvsp[-4].stp)->offset) ; }
+             else code2(AE_PUSHI, (yyvsp[-4].stp)->stval.array) ;
 
 	     CODE_FE_PUSHA()  ;
 
-             (yyval.start) = (yyvsp[(3) - (6)].start) ;
+             (yyval.start) = (yyvsp[-3].start) ;
            }
+#line 3012 "y.tab.c"
     break;
 
-  case 128:
-
-/* Line 1455 of yacc.c  */
-#line 826 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (2)].start) ;  CODE_FE_PUSHA() ; }
+  case 134: /* field: DOLLAR p_expr  */
+#line 864 "parse.y"
+           { (yyval.start) = (yyvsp[0].start) ;  CODE_FE_PUSHA() ; }
+#line 3018 "y.tab.c"
     break;
 
-  case 129:
-
-/* Line 1455 of yacc.c  */
-#line 828 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (3)].start) ; }
+  case 135: /* field: LPAREN field RPAREN  */
+#line 866 "parse.y"
+           { (yyval.start) = (yyvsp[-1].start) ; }
+#line 3024 "y.tab.c"
     break;
 
-  case 130:
-
-/* Line 1455 of yacc.c  */
-#line 832 "parse.y"
-    { field_A2I() ; }
+  case 136: /* p_expr: field  */
+#line 870 "parse.y"
+            { field_A2I() ; }
+#line 3030 "y.tab.c"
     break;
 
-  case 131:
-
-/* Line 1455 of yacc.c  */
-#line 835 "parse.y"
-    { code1(F_ASSIGN) ; }
+  case 137: /* expr: field ASSIGN expr  */
+#line 873 "parse.y"
+                                 { code1(F_ASSIGN) ; }
+#line 3036 "y.tab.c"
     break;
 
-  case 132:
-
-/* Line 1455 of yacc.c  */
-#line 836 "parse.y"
-    { code1(F_ADD_ASG) ; }
+  case 138: /* expr: field ADD_ASG expr  */
+#line 874 "parse.y"
+                                 { code1(F_ADD_ASG) ; }
+#line 3042 "y.tab.c"
     break;
 
-  case 133:
-
-/* Line 1455 of yacc.c  */
-#line 837 "parse.y"
-    { code1(F_SUB_ASG) ; }
+  case 139: /* expr: field SUB_ASG expr  */
+#line 875 "parse.y"
+                                 { code1(F_SUB_ASG) ; }
+#line 3048 "y.tab.c"
     break;
 
-  case 134:
-
-/* Line 1455 of yacc.c  */
-#line 838 "parse.y"
-    { code1(F_MUL_ASG) ; }
+  case 140: /* expr: field MUL_ASG expr  */
+#line 876 "parse.y"
+                                 { code1(F_MUL_ASG) ; }
+#line 3054 "y.tab.c"
     break;
 
-  case 135:
-
-/* Line 1455 of yacc.c  */
-#line 839 "parse.y"
-    { code1(F_DIV_ASG) ; }
+  case 141: /* expr: field DIV_ASG expr  */
+#line 877 "parse.y"
+                                 { code1(F_DIV_ASG) ; }
+#line 3060 "y.tab.c"
     break;
 
-  case 136:
-
-/* Line 1455 of yacc.c  */
-#line 840 "parse.y"
-    { code1(F_MOD_ASG) ; }
+  case 142: /* expr: field MOD_ASG expr  */
+#line 878 "parse.y"
+                                 { code1(F_MOD_ASG) ; }
+#line 3066 "y.tab.c"
     break;
 
-  case 137:
-
-/* Line 1455 of yacc.c  */
-#line 841 "parse.y"
-    { code1(F_POW_ASG) ; }
+  case 143: /* expr: field POW_ASG expr  */
+#line 879 "parse.y"
+                                 { code1(F_POW_ASG) ; }
+#line 3072 "y.tab.c"
     break;
 
-  case 138:
-
-/* Line 1455 of yacc.c  */
-#line 848 "parse.y"
-    { code2(_BUILTIN, bi_split) ; }
+  case 144: /* p_expr: split_front split_back  */
+#line 886 "parse.y"
+            { code2(_BUILTIN, bi_split) ; }
+#line 3078 "y.tab.c"
     break;
 
-  case 139:
-
-/* Line 1455 of yacc.c  */
-#line 852 "parse.y"
-    { (yyval.start) = (yyvsp[(3) - (5)].start) ;
-              check_array((yyvsp[(5) - (5)].stp)) ;
-              code_array((yyvsp[(5) - (5)].stp))  ;
+  case 145: /* split_front: SPLIT LPAREN expr COMMA ID  */
+#line 890 "parse.y"
+            { (yyval.start) = (yyvsp[-2].start) ;
+              check_array((yyvsp[0].stp)) ;
+              code_array((yyvsp[0].stp))  ;
             }
+#line 3087 "y.tab.c"
     break;
 
-  case 140:
-
-/* Line 1455 of yacc.c  */
-#line 859 "parse.y"
-    { code2(_PUSHI, &fs_shadow) ; }
+  case 146: /* split_back: RPAREN  */
+#line 897 "parse.y"
+                { code2(_PUSHI, &fs_shadow) ; }
+#line 3093 "y.tab.c"
     break;
 
-  case 141:
-
-/* Line 1455 of yacc.c  */
-#line 861 "parse.y"
-    {
-                  if ( CDP((yyvsp[(2) - (3)].start)) == code_ptr - 2 )
+  case 147: /* split_back: COMMA expr RPAREN  */
+#line 899 "parse.y"
+                {
+                  if ( CDP((yyvsp[-1].start)) == code_ptr - 2 )
                   {
                     if (code_ptr[-2].op == _MATCH0) {
                         RE_as_arg() ;
@@ -3282,43 +3120,109 @@ yyreduce:
                     }
                   }
                 }
+#line 3124 "y.tab.c"
+    break;
+
+  case 148: /* p_expr: asort_or_asorti LPAREN asort_array asort_back RPAREN  */
+#line 931 "parse.y"
+           { (yyval.start) = (yyvsp[-2].start) ;
+             code2op(_PUSHINT, (yyvsp[-1].ival)) ;
+             code2(_BUILTIN, (yyvsp[-4].fp)) ;
+           }
+#line 3133 "y.tab.c"
+    break;
+
+  case 149: /* asort_or_asorti: ASORT  */
+#line 937 "parse.y"
+                           { (yyval.fp) = bi_asort ; }
+#line 3139 "y.tab.c"
+    break;
+
+  case 150: /* asort_or_asorti: ASORTI  */
+#line 938 "parse.y"
+                           { (yyval.fp) = bi_asorti ; }
+#line 3145 "y.tab.c"
+    break;
+
+  case 151: /* asort_array: ID  */
+#line 942 "parse.y"
+               { (yyval.start) = code_offset ;
+                 check_array((yyvsp[0].stp)) ;
+                 code_array((yyvsp[0].stp)) ;
+               }
+#line 3154 "y.tab.c"
+    break;
+
+  case 152: /* asort_back: %empty  */
+#line 948 "parse.y"
+                            { (yyval.ival) = 1 ; }
+#line 3160 "y.tab.c"
+    break;
+
+  case 153: /* asort_back: COMMA asort_array  */
+#line 949 "parse.y"
+                                  { (yyval.ival) = 2 ; }
+#line 3166 "y.tab.c"
+    break;
+
+  case 154: /* asort_back: COMMA asort_array COMMA expr  */
+#line 950 "parse.y"
+                                             { (yyval.ival) = 3 ; }
+#line 3172 "y.tab.c"
+    break;
+
+  case 155: /* p_expr: writea_or_reada LPAREN expr COMMA ID RPAREN  */
+#line 956 "parse.y"
+           { (yyval.start) = (yyvsp[-3].start) ;
+             check_array((yyvsp[-1].stp)) ;
+             code_array((yyvsp[-1].stp)) ;
+             code2(_BUILTIN, (yyvsp[-5].fp)) ;
+           }
+#line 3182 "y.tab.c"
     break;
 
-  case 142:
+  case 156: /* writea_or_reada: WRITEA  */
+#line 963 "parse.y"
+                           { (yyval.fp) = bi_writea ; }
+#line 3188 "y.tab.c"
+    break;
+
+  case 157: /* writea_or_reada: READA  */
+#line 964 "parse.y"
+                           { (yyval.fp) = bi_reada ; }
+#line 3194 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 896 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 158: /* p_expr: LENGTH  */
+#line 974 "parse.y"
+          { (yyval.start) = code_offset ;
 	    code2(_PUSHI,field) ;
             code2(_BUILTIN,bi_length) ;
 	  }
+#line 3203 "y.tab.c"
     break;
 
-  case 143:
-
-/* Line 1455 of yacc.c  */
-#line 901 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 159: /* p_expr: LENGTH LPAREN RPAREN  */
+#line 979 "parse.y"
+          { (yyval.start) = code_offset ;
 	    code2(_PUSHI,field) ;
             code2(_BUILTIN,bi_length) ;
 	  }
+#line 3212 "y.tab.c"
     break;
 
-  case 144:
-
-/* Line 1455 of yacc.c  */
-#line 906 "parse.y"
-    { (yyval.start) = (yyvsp[(3) - (4)].start) ;
+  case 160: /* p_expr: LENGTH LPAREN expr RPAREN  */
+#line 984 "parse.y"
+          { (yyval.start) = (yyvsp[-1].start) ;
             code2(_BUILTIN,bi_length) ;
 	  }
+#line 3220 "y.tab.c"
     break;
 
-  case 145:
-
-/* Line 1455 of yacc.c  */
-#line 910 "parse.y"
-    {
-	      SYMTAB* stp = (yyvsp[(3) - (4)].stp) ;
+  case 161: /* p_expr: LENGTH LPAREN ID RPAREN  */
+#line 988 "parse.y"
+          {
+	      SYMTAB* stp = (yyvsp[-1].stp) ;
 	      (yyval.start) = code_offset ;
 	      switch(stp->type) {
 	          case ST_VAR:
@@ -3358,23 +3262,31 @@ yyreduce:
 		       break ;
 	      }
 	   }
+#line 3266 "y.tab.c"
     break;
 
-  case 146:
-
-/* Line 1455 of yacc.c  */
-#line 958 "parse.y"
-    { (yyval.start) = (yyvsp[(3) - (6)].start) ;
+  case 162: /* p_expr: MATCH_FUNC LPAREN expr COMMA re_arg RPAREN  */
+#line 1036 "parse.y"
+        { (yyval.start) = (yyvsp[-3].start) ;
           code2(_BUILTIN, bi_match) ;
         }
+#line 3274 "y.tab.c"
     break;
 
-  case 147:
+  case 163: /* p_expr: MATCH_FUNC LPAREN expr COMMA re_arg COMMA ID RPAREN  */
+#line 1040 "parse.y"
+        { (yyval.start) = (yyvsp[-5].start) ;
+          check_array((yyvsp[-1].stp)) ;
+          code_array((yyvsp[-1].stp)) ;
+          code2(_BUILTIN, bi_match3) ;
+        }
+#line 3284 "y.tab.c"
+    break;
 
-/* Line 1455 of yacc.c  */
-#line 965 "parse.y"
-    {
-	       INST *p1 = CDP((yyvsp[(1) - (1)].start)) ;
+  case 164: /* re_arg: expr  */
+#line 1049 "parse.y"
+             {
+	       INST *p1 = CDP((yyvsp[0].start)) ;
 
                if ( p1 == code_ptr - 2 )
                {
@@ -3391,121 +3303,108 @@ yyreduce:
                  }
                }
              }
+#line 3307 "y.tab.c"
     break;
 
-  case 148:
-
-/* Line 1455 of yacc.c  */
-#line 988 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 165: /* statement: EXIT separator  */
+#line 1072 "parse.y"
+                    { (yyval.start) = code_offset ;
                       code1(_EXIT0) ; }
+#line 3314 "y.tab.c"
     break;
 
-  case 149:
-
-/* Line 1455 of yacc.c  */
-#line 991 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (3)].start) ; code1(_EXIT) ; }
+  case 166: /* statement: EXIT expr separator  */
+#line 1075 "parse.y"
+                    { (yyval.start) = (yyvsp[-1].start) ; code1(_EXIT) ; }
+#line 3320 "y.tab.c"
     break;
 
-  case 150:
-
-/* Line 1455 of yacc.c  */
-#line 994 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 167: /* return_statement: RETURN separator  */
+#line 1078 "parse.y"
+                    { (yyval.start) = code_offset ;
                       code1(_RET0) ; }
+#line 3327 "y.tab.c"
     break;
 
-  case 151:
-
-/* Line 1455 of yacc.c  */
-#line 997 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (3)].start) ; code1(_RET) ; }
+  case 168: /* return_statement: RETURN expr separator  */
+#line 1081 "parse.y"
+                    { (yyval.start) = (yyvsp[-1].start) ; code1(_RET) ; }
+#line 3333 "y.tab.c"
     break;
 
-  case 152:
-
-/* Line 1455 of yacc.c  */
-#line 1002 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 169: /* p_expr: getline  */
+#line 1086 "parse.y"
+          { (yyval.start) = code_offset ;
             code2(F_PUSHA, &field[0]) ;
             code1(_PUSHINT) ; code1(0) ;
             code2(_BUILTIN, bi_getline) ;
             getline_flag = 0 ;
           }
+#line 3344 "y.tab.c"
     break;
 
-  case 153:
-
-/* Line 1455 of yacc.c  */
-#line 1009 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (2)].start) ;
+  case 170: /* p_expr: getline fvalue  */
+#line 1093 "parse.y"
+          { (yyval.start) = (yyvsp[0].start) ;
             code1(_PUSHINT) ; code1(0) ;
             code2(_BUILTIN, bi_getline) ;
             getline_flag = 0 ;
           }
+#line 3354 "y.tab.c"
     break;
 
-  case 154:
-
-/* Line 1455 of yacc.c  */
-#line 1015 "parse.y"
-    { code1(_PUSHINT) ; code1(F_IN) ;
+  case 171: /* p_expr: getline_file p_expr  */
+#line 1099 "parse.y"
+          { code1(_PUSHINT) ; code1(F_IN) ;
             code2(_BUILTIN, bi_getline) ;
             /* getline_flag already off in yylex() */
           }
+#line 3363 "y.tab.c"
     break;
 
-  case 155:
-
-/* Line 1455 of yacc.c  */
-#line 1020 "parse.y"
-    { code2(F_PUSHA, &field[0]) ;
+  case 172: /* p_expr: p_expr PIPE GETLINE  */
+#line 1104 "parse.y"
+          { code2(F_PUSHA, &field[0]) ;
             code1(_PUSHINT) ; code1(PIPE_IN) ;
             code2(_BUILTIN, bi_getline) ;
           }
+#line 3372 "y.tab.c"
     break;
 
-  case 156:
-
-/* Line 1455 of yacc.c  */
-#line 1025 "parse.y"
-    {
+  case 173: /* p_expr: p_expr PIPE GETLINE fvalue  */
+#line 1109 "parse.y"
+          {
             code1(_PUSHINT) ; code1(PIPE_IN) ;
             code2(_BUILTIN, bi_getline) ;
           }
+#line 3381 "y.tab.c"
     break;
 
-  case 157:
-
-/* Line 1455 of yacc.c  */
-#line 1031 "parse.y"
-    { getline_flag = 1 ; }
+  case 174: /* getline: GETLINE  */
+#line 1115 "parse.y"
+                     { getline_flag = 1 ; }
+#line 3387 "y.tab.c"
     break;
 
-  case 160:
-
-/* Line 1455 of yacc.c  */
-#line 1036 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 177: /* getline_file: getline IO_IN  */
+#line 1120 "parse.y"
+                 { (yyval.start) = code_offset ;
                    code2(F_PUSHA, field+0) ;
                  }
+#line 3395 "y.tab.c"
     break;
 
-  case 161:
-
-/* Line 1455 of yacc.c  */
-#line 1040 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (3)].start) ; }
+  case 178: /* getline_file: getline fvalue IO_IN  */
+#line 1124 "parse.y"
+                 { (yyval.start) = (yyvsp[-1].start) ; }
+#line 3401 "y.tab.c"
     break;
 
-  case 162:
-
-/* Line 1455 of yacc.c  */
-#line 1048 "parse.y"
-    {
-	     INST *p5 = CDP((yyvsp[(5) - (6)].start)) ;
-	     INST *p6 = CDP((yyvsp[(6) - (6)].start)) ;
+  case 179: /* p_expr: sub_or_gsub LPAREN re_arg COMMA expr sub_back  */
+#line 1132 "parse.y"
+           {
+	     INST *p5 = CDP((yyvsp[-1].start)) ;
+	     INST *p6 = CDP((yyvsp[0].start)) ;
 
              if ( p6 - p5 == 2 && p5->op == _PUSHS  )
              { /* cast from STRING to REPL at compile time */
@@ -3516,91 +3415,84 @@ yyreduce:
                p5->op = _PUSHC ;
                p5[1].ptr = (PTR) cp ;
              }
-             code2(_BUILTIN, (yyvsp[(1) - (6)].fp)) ;
-             (yyval.start) = (yyvsp[(3) - (6)].start) ;
+             code2(_BUILTIN, (yyvsp[-5].fp)) ;
+             (yyval.start) = (yyvsp[-3].start) ;
            }
+#line 3422 "y.tab.c"
     break;
 
-  case 163:
-
-/* Line 1455 of yacc.c  */
-#line 1066 "parse.y"
-    { (yyval.fp) = bi_sub ; }
+  case 180: /* sub_or_gsub: SUB  */
+#line 1150 "parse.y"
+                    { (yyval.fp) = bi_sub ; }
+#line 3428 "y.tab.c"
     break;
 
-  case 164:
-
-/* Line 1455 of yacc.c  */
-#line 1067 "parse.y"
-    { (yyval.fp) = bi_gsub ; }
+  case 181: /* sub_or_gsub: GSUB  */
+#line 1151 "parse.y"
+                    { (yyval.fp) = bi_gsub ; }
+#line 3434 "y.tab.c"
     break;
 
-  case 165:
-
-/* Line 1455 of yacc.c  */
-#line 1072 "parse.y"
-    { (yyval.start) = code_offset ;
+  case 182: /* sub_back: RPAREN  */
+#line 1156 "parse.y"
+                { (yyval.start) = code_offset ;
                   code2(F_PUSHA, &field[0]) ;
                 }
+#line 3442 "y.tab.c"
     break;
 
-  case 166:
-
-/* Line 1455 of yacc.c  */
-#line 1077 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (3)].start) ; }
+  case 183: /* sub_back: COMMA fvalue RPAREN  */
+#line 1161 "parse.y"
+                { (yyval.start) = (yyvsp[-1].start) ; }
+#line 3448 "y.tab.c"
     break;
 
-  case 167:
-
-/* Line 1455 of yacc.c  */
-#line 1085 "parse.y"
-    {
-		   resize_fblock((yyvsp[(1) - (2)].fbp)) ;
+  case 184: /* function_def: funct_start block  */
+#line 1169 "parse.y"
+                 {
+		   resize_fblock((yyvsp[-1].fbp)) ;
                    restore_ids() ;
 		   switch_code_to_main() ;
                  }
+#line 3458 "y.tab.c"
     break;
 
-  case 168:
-
-/* Line 1455 of yacc.c  */
-#line 1094 "parse.y"
-    { eat_nl() ;
+  case 185: /* funct_start: funct_head LPAREN f_arglist RPAREN  */
+#line 1178 "parse.y"
+                 { eat_nl() ;
                    scope = SCOPE_FUNCT ;
-                   active_funct = (yyvsp[(1) - (4)].fbp) ;
+                   active_funct = (yyvsp[-3].fbp) ;
                    *main_code_p = active_code ;
 
-		   (yyvsp[(1) - (4)].fbp)->nargs = (yyvsp[(3) - (4)].ival) ;
-                   if ( (yyvsp[(3) - (4)].ival) )
-                        (yyvsp[(1) - (4)].fbp)->typev = (char *)
-			    memset( zmalloc((yyvsp[(3) - (4)].ival)), ST_LOCAL_NONE, (yyvsp[(3) - (4)].ival)) ;
-                   else (yyvsp[(1) - (4)].fbp)->typev = (char *) 0 ;
+		   (yyvsp[-3].fbp)->nargs = (yyvsp[-1].ival) ;
+                   if ( (yyvsp[-1].ival) )
+                        (yyvsp[-3].fbp)->typev = (char *)
+			    memset( zmalloc((yyvsp[-1].ival)), ST_LOCAL_NONE, (yyvsp[-1].ival)) ;
+                   else (yyvsp[-3].fbp)->typev = (char *) 0 ;
 
 		   code_ptr = code_base =
-                       (INST *) zmalloc(INST_BYTES(PAGESZ));
+                       (INST *) zmalloc_t(INST_BYTES(PAGESZ), ZT_CODE);
 		   code_limit = code_base + PAGESZ ;
 		   code_warn = code_limit - CODEWARN ;
                  }
+#line 3479 "y.tab.c"
     break;
 
-  case 169:
-
-/* Line 1455 of yacc.c  */
-#line 1113 "parse.y"
-    { FBLOCK  *fbp ;
+  case 186: /* funct_head: FUNCTION ID  */
+#line 1197 "parse.y"
+                 { FBLOCK  *fbp ;
 
-                   if ( (yyvsp[(2) - (2)].stp)->type == ST_NONE )
+                   if ( (yyvsp[0].stp)->type == ST_NONE )
                    {
-                         (yyvsp[(2) - (2)].stp)->type = ST_FUNCT ;
-                         fbp = (yyvsp[(2) - (2)].stp)->stval.fbp =
+                         (yyvsp[0].stp)->type = ST_FUNCT ;
+                         fbp = (yyvsp[0].stp)->stval.fbp =
                              (FBLOCK *) zmalloc(sizeof(FBLOCK)) ;
-                         fbp->name = (yyvsp[(2) - (2)].stp)->name ;
+                         fbp->name = (yyvsp[0].stp)->name ;
 			 fbp->code = (INST*) 0 ;
                    }
                    else
                    {
-                         type_error( (yyvsp[(2) - (2)].stp) ) ;
+                         type_error( (yyvsp[0].stp) ) ;
 
                          /* this FBLOCK will not be put in
                             the symbol table */
@@ -3609,57 +3501,52 @@ yyreduce:
                    }
                    (yyval.fbp) = fbp ;
                  }
+#line 3505 "y.tab.c"
     break;
 
-  case 170:
-
-/* Line 1455 of yacc.c  */
-#line 1136 "parse.y"
-    { (yyval.fbp) = (yyvsp[(2) - (2)].fbp) ;
-                   if ( (yyvsp[(2) - (2)].fbp)->code )
-                       compile_error("redefinition of %s" , (yyvsp[(2) - (2)].fbp)->name) ;
+  case 187: /* funct_head: FUNCTION FUNCT_ID  */
+#line 1220 "parse.y"
+                 { (yyval.fbp) = (yyvsp[0].fbp) ;
+                   if ( (yyvsp[0].fbp)->code )
+                       compile_error("redefinition of %s" , (yyvsp[0].fbp)->name) ;
                  }
+#line 3514 "y.tab.c"
     break;
 
-  case 171:
-
-/* Line 1455 of yacc.c  */
-#line 1142 "parse.y"
-    { (yyval.ival) = 0 ; }
+  case 188: /* f_arglist: %empty  */
+#line 1226 "parse.y"
+                          { (yyval.ival) = 0 ; }
+#line 3520 "y.tab.c"
     break;
 
-  case 173:
-
-/* Line 1455 of yacc.c  */
-#line 1147 "parse.y"
-    { (yyvsp[(1) - (1)].stp) = save_id((yyvsp[(1) - (1)].stp)->name) ;
-                (yyvsp[(1) - (1)].stp)->type = ST_LOCAL_NONE ;
-                (yyvsp[(1) - (1)].stp)->offset = 0 ;
+  case 190: /* f_args: ID  */
+#line 1231 "parse.y"
+              { (yyvsp[0].stp) = save_id((yyvsp[0].stp)->name) ;
+                (yyvsp[0].stp)->type = ST_LOCAL_NONE ;
+                (yyvsp[0].stp)->offset = 0 ;
                 (yyval.ival) = 1 ;
               }
+#line 3530 "y.tab.c"
     break;
 
-  case 174:
-
-/* Line 1455 of yacc.c  */
-#line 1153 "parse.y"
-    { if ( is_local((yyvsp[(3) - (3)].stp)) )
+  case 191: /* f_args: f_args COMMA ID  */
+#line 1237 "parse.y"
+              { if ( is_local((yyvsp[0].stp)) )
                   compile_error("%s is duplicated in argument list",
-                    (yyvsp[(3) - (3)].stp)->name) ;
+                    (yyvsp[0].stp)->name) ;
                 else
-                { (yyvsp[(3) - (3)].stp) = save_id((yyvsp[(3) - (3)].stp)->name) ;
-                  (yyvsp[(3) - (3)].stp)->type = ST_LOCAL_NONE ;
-                  (yyvsp[(3) - (3)].stp)->offset = (yyvsp[(1) - (3)].ival) ;
-                  (yyval.ival) = (yyvsp[(1) - (3)].ival) + 1 ;
+                { (yyvsp[0].stp) = save_id((yyvsp[0].stp)->name) ;
+                  (yyvsp[0].stp)->type = ST_LOCAL_NONE ;
+                  (yyvsp[0].stp)->offset = (yyvsp[-2].ival) ;
+                  (yyval.ival) = (yyvsp[-2].ival) + 1 ;
                 }
               }
+#line 3545 "y.tab.c"
     break;
 
-  case 175:
-
-/* Line 1455 of yacc.c  */
-#line 1166 "parse.y"
-    {  /* we may have to recover from a bungled function
+  case 192: /* outside_error: error  */
+#line 1250 "parse.y"
+                 {  /* we may have to recover from a bungled function
 		       definition */
 		   /* can have local ids, before code scope
 		      changes  */
@@ -3667,183 +3554,151 @@ yyreduce:
 
 		    switch_code_to_main() ;
 		 }
+#line 3558 "y.tab.c"
     break;
 
-  case 176:
+  case 193: /* p_expr: FUNCT_ID mark call_args  */
+#line 1263 "parse.y"
+           { (yyval.start) = (yyvsp[-1].start) ;
+             code2(_CALL, (yyvsp[-2].fbp)) ;
 
-/* Line 1455 of yacc.c  */
-#line 1179 "parse.y"
-    { (yyval.start) = (yyvsp[(2) - (3)].start) ;
-             code2(_CALL, (yyvsp[(1) - (3)].fbp)) ;
-
-             if ( (yyvsp[(3) - (3)].ca_p) )  code1((yyvsp[(3) - (3)].ca_p)->arg_num+1) ;
+             if ( (yyvsp[0].ca_p) )  code1((yyvsp[0].ca_p)->arg_num+1) ;
              else  code1(0) ;
 
-	     check_fcall((yyvsp[(1) - (3)].fbp), scope, code_move_level, active_funct,
-			 (yyvsp[(3) - (3)].ca_p), token_lineno) ;
+	     check_fcall((yyvsp[-2].fbp), scope, code_move_level, active_funct,
+			 (yyvsp[0].ca_p), token_lineno) ;
            }
+#line 3572 "y.tab.c"
     break;
 
-  case 177:
-
-/* Line 1455 of yacc.c  */
-#line 1191 "parse.y"
-    { (yyval.ca_p) = (CA_REC *) 0 ; }
+  case 194: /* call_args: LPAREN RPAREN  */
+#line 1275 "parse.y"
+               { (yyval.ca_p) = (CA_REC *) 0 ; }
+#line 3578 "y.tab.c"
     break;
 
-  case 178:
-
-/* Line 1455 of yacc.c  */
-#line 1193 "parse.y"
-    { (yyval.ca_p) = (yyvsp[(2) - (2)].ca_p) ;
-                 (yyval.ca_p)->link = (yyvsp[(1) - (2)].ca_p) ;
-                 (yyval.ca_p)->arg_num = (yyvsp[(1) - (2)].ca_p) ? (yyvsp[(1) - (2)].ca_p)->arg_num+1 : 0 ;
+  case 195: /* call_args: ca_front ca_back  */
+#line 1277 "parse.y"
+               { (yyval.ca_p) = (yyvsp[0].ca_p) ;
+                 (yyval.ca_p)->link = (yyvsp[-1].ca_p) ;
+                 (yyval.ca_p)->arg_num = (yyvsp[-1].ca_p) ? (yyvsp[-1].ca_p)->arg_num+1 : 0 ;
                }
+#line 3587 "y.tab.c"
     break;
 
-  case 179:
-
-/* Line 1455 of yacc.c  */
-#line 1208 "parse.y"
-    { (yyval.ca_p) = (CA_REC *) 0 ; }
+  case 196: /* ca_front: LPAREN  */
+#line 1292 "parse.y"
+              { (yyval.ca_p) = (CA_REC *) 0 ; }
+#line 3593 "y.tab.c"
     break;
 
-  case 180:
-
-/* Line 1455 of yacc.c  */
-#line 1210 "parse.y"
-    { (yyval.ca_p) = ZMALLOC(CA_REC) ;
-                (yyval.ca_p)->link = (yyvsp[(1) - (3)].ca_p) ;
+  case 197: /* ca_front: ca_front expr COMMA  */
+#line 1294 "parse.y"
+              { (yyval.ca_p) = ZMALLOC(CA_REC) ;
+                (yyval.ca_p)->link = (yyvsp[-2].ca_p) ;
                 (yyval.ca_p)->type = CA_EXPR  ;
-                (yyval.ca_p)->arg_num = (yyvsp[(1) - (3)].ca_p) ? (yyvsp[(1) - (3)].ca_p)->arg_num+1 : 0 ;
+                (yyval.ca_p)->arg_num = (yyvsp[-2].ca_p) ? (yyvsp[-2].ca_p)->arg_num+1 : 0 ;
 		(yyval.ca_p)->call_offset = code_offset ;
               }
+#line 3604 "y.tab.c"
     break;
 
-  case 181:
-
-/* Line 1455 of yacc.c  */
-#line 1217 "parse.y"
-    { (yyval.ca_p) = ZMALLOC(CA_REC) ;
-                (yyval.ca_p)->link = (yyvsp[(1) - (3)].ca_p) ;
-                (yyval.ca_p)->arg_num = (yyvsp[(1) - (3)].ca_p) ? (yyvsp[(1) - (3)].ca_p)->arg_num+1 : 0 ;
+  case 198: /* ca_front: ca_front ID COMMA  */
+#line 1301 "parse.y"
+              { (yyval.ca_p) = ZMALLOC(CA_REC) ;
+                (yyval.ca_p)->link = (yyvsp[-2].ca_p) ;
+                (yyval.ca_p)->arg_num = (yyvsp[-2].ca_p) ? (yyvsp[-2].ca_p)->arg_num+1 : 0 ;
 
-                code_call_id((yyval.ca_p), (yyvsp[(2) - (3)].stp)) ;
+                code_call_id((yyval.ca_p), (yyvsp[-1].stp)) ;
               }
+#line 3615 "y.tab.c"
     break;
 
-  case 182:
-
-/* Line 1455 of yacc.c  */
-#line 1226 "parse.y"
-    { (yyval.ca_p) = ZMALLOC(CA_REC) ;
+  case 199: /* ca_back: expr RPAREN  */
+#line 1310 "parse.y"
+              { (yyval.ca_p) = ZMALLOC(CA_REC) ;
                 (yyval.ca_p)->type = CA_EXPR ;
 		(yyval.ca_p)->call_offset = code_offset ;
               }
+#line 3624 "y.tab.c"
     break;
 
-  case 183:
-
-/* Line 1455 of yacc.c  */
-#line 1232 "parse.y"
-    { (yyval.ca_p) = ZMALLOC(CA_REC) ;
-                code_call_id((yyval.ca_p), (yyvsp[(1) - (2)].stp)) ;
+  case 200: /* ca_back: ID RPAREN  */
+#line 1316 "parse.y"
+              { (yyval.ca_p) = ZMALLOC(CA_REC) ;
+                code_call_id((yyval.ca_p), (yyvsp[-1].stp)) ;
               }
+#line 3632 "y.tab.c"
     break;
 
 
+#line 3636 "y.tab.c"
 
-/* Line 1455 of yacc.c  */
-#line 3756 "y.tab.c"
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (yymsg);
-	  }
-	else
-	  {
-	    yyerror (YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -3855,14 +3710,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -3875,39 +3729,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -3918,62 +3775,64 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined(yyoverflow) || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval);
-  /* Do not reclaim the symbols of the rule which action triggered
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
-
 
+  return yyresult;
+}
 
-/* Line 1675 of yacc.c  */
-#line 1240 "parse.y"
+#line 1324 "parse.y"
 
 
 /* resize the code for a user function */
 
 static void  resize_fblock( FBLOCK * fbp )
 {
-  CODEBLOCK *p = ZMALLOC(CODEBLOCK) ;
+  CODEBLOCK *p = (CODEBLOCK*) zmalloc_t(sizeof(CODEBLOCK), ZT_CODE) ;
   unsigned dummy ;
 
   code2op(_RET0, _HALT) ;
@@ -4077,6 +3936,103 @@ static void code_array(SYMTAB* p)
   else  code2(A_PUSHA, p->stval.array) ;
 }
 
+/* code the cat_expr  chain p_expr, p_expr starts at offset x.
+   A chain of two is coded  a b cat,  longer chains are coded
+   a b c ... catn n,  so the result is built with one allocation.
+   The operands are all on the eval stack, so n is at most MAX_CATN;
+   after that the result is the first operand of a new chain.
+*/
+
+static void code_cat(CAT_REC *chain, int x)
+{
+  if ( chain->cnt == 1 )  code_slice(CDP(chain->start), CDP(x)) ;
+  code_slice(CDP(x), code_ptr) ;
+
+  if ( chain->cnt == 1 || chain->cnt == MAX_CATN )
+  {
+    chain->second = x ;
+    chain->cnt = 2 ;
+    code1(_CAT) ;
+  }
+  else
+  {
+    /* remove the cat that ends chain, it is just before x */
+    int to = x - (chain->cnt == 2 ? 1 : 2) ;
+    unsigned len ;
+
+    code_push(CDP(x), code_ptr - CDP(x), scope, active_funct) ;
+    len = code_pop(CDP(to)) ;
+    code_ptr = CDP(to) + len ;
+    chain->cnt++ ;
+    code2op(_CATN, chain->cnt) ;
+  }
+  chain->end = code_offset ;
+}
+
+/* the value of the code from p to q is used once, by cat or print.
+   If it is a call of substr(), it can be a slice of its argument,
+   see bi_substr_slice().  q[-2] and q[-1] can be the operands of
+   other instructions, but then q[-1] is not the address of a
+   function.
+*/
+
+static void code_slice(INST *p, INST *q)
+{
+  if ( q - p >= 2 && q[-2].op == _BUILTIN &&
+       q[-1].ptr == (PTR) bi_substr )
+     q[-1].ptr = (PTR) bi_substr_slice ;
+}
+
+/* code the end of lvalue = expr, lvalue at offset lv and expr at ex.
+   If it is  v = v x y ... , the code is
+       pusha v  pushi v  <x>  <y> ...  cat (or catn)
+   which becomes
+       pusha v  <x>  <y> ...  append n
+   so v can grow in place.  v is then read after x y ..., so this is
+   not done if they can change v: if they take the address of v
+   (getline v, sub(r, s, v)) or call a function and v is global.  Nor
+   is it done if v is a builtin variable, which getline and match()
+   set.  The test looks at every word, so an operand can stop it, but
+   that is rare.
+*/
+
+static int  x_can_change(INST * p, INST * x, INST * end)
+{
+  if ( p->op == _PUSHA && (CELL *) p[1].ptr >= bi_vars &&
+       (CELL *) p[1].ptr < bi_vars + NUM_BI_VAR )  return 1 ;
+
+  for ( ; x < end ; x++ )
+  {
+    if ( x->op == _CALL && p->op == _PUSHA )  return 1 ;
+    if ( x->op == p->op && x + 1 < end &&
+         (p->op == _PUSHA ? x[1].ptr == p[1].ptr : x[1].op == p[1].op) )
+       return 1 ;
+  }
+  return 0 ;
+}
+
+static void code_assign(int lv, int ex)
+{
+  INST *p = CDP(lv) ;
+  INST *cat = code_ptr - (last_chain.cnt == 2 ? 1 : 2) ;
+
+  if ( ex == lv + 2 && last_chain.start == ex &&
+       last_chain.end == code_offset && last_chain.cnt >= 2 &&
+       last_chain.second == ex + 2 &&
+       ( (p[0].op == _PUSHA && p[2].op == _PUSHI && p[1].ptr == p[3].ptr) ||
+         (p[0].op == L_PUSHA && p[2].op == L_PUSHI && p[1].op == p[3].op) ) &&
+       !x_can_change(p, p + 4, cat) )
+  {
+    INST *x = p + 4 ;
+    unsigned len ;
+
+    code_push(x, cat - x, scope, active_funct) ;
+    len = code_pop(CDP(ex)) ;
+    code_ptr = CDP(ex) + len ;
+    code2op(_APPEND, last_chain.cnt - 1) ;
+  }
+  else  code1(_ASSIGN) ;
+}
 
 /* we've seen an ID as an argument to a user defined function */
 
@@ -4179,6 +4135,7 @@ parse(void)
    if ( yyparse() || compile_error_count != 0 ) mawk_exit(2) ;
 
    scan_cleanup() ;
+   rule_patterns_build() ;
    set_code() ;
    /* code must be set before call to resolve_fcalls() */
    if ( resolve_list )  resolve_fcalls() ;
@@ -4187,4 +4144,3 @@ parse(void)
    if ( dump_code_flag ) { dump_code() ; mawk_exit(0) ; }
 }
 
-
@@ -1,23 +1,22 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* A Bison parser, made by GNU Bison 2.4.1.  */
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-/* Skeleton interface for Bison's Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
-   
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -28,96 +27,121 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
-/* Tokens.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     UNEXPECTED = 258,
-     BAD_DECIMAL = 259,
-     NL = 260,
-     SEMI_COLON = 261,
-     LBRACE = 262,
-     RBRACE = 263,
-     LBOX = 264,
-     RBOX = 265,
-     COMMA = 266,
-     IO_OUT = 267,
-     POW_ASG = 268,
-     MOD_ASG = 269,
-     DIV_ASG = 270,
-     MUL_ASG = 271,
-     SUB_ASG = 272,
-     ADD_ASG = 273,
-     ASSIGN = 274,
-     COLON = 275,
-     QMARK = 276,
-     OR = 277,
-     AND = 278,
-     IN = 279,
-     MATCH = 280,
-     GTE = 281,
-     GT = 282,
-     LTE = 283,
-     LT = 284,
-     NEQ = 285,
-     EQ = 286,
-     CAT = 287,
-     GETLINE = 288,
-     MINUS = 289,
-     PLUS = 290,
-     MOD = 291,
-     DIV = 292,
-     MUL = 293,
-     UMINUS = 294,
-     NOT = 295,
-     PIPE = 296,
-     IO_IN = 297,
-     POW = 298,
-     INC_or_DEC = 299,
-     FIELD = 300,
-     DOLLAR = 301,
-     RPAREN = 302,
-     LPAREN = 303,
-     DOUBLE = 304,
-     STRING_ = 305,
-     RE = 306,
-     ID = 307,
-     D_ID = 308,
-     FUNCT_ID = 309,
-     BUILTIN = 310,
-     LENGTH = 311,
-     PRINT = 312,
-     PRINTF = 313,
-     SPLIT = 314,
-     MATCH_FUNC = 315,
-     SUB = 316,
-     GSUB = 317,
-     SPRINTF = 318,
-     DO = 319,
-     WHILE = 320,
-     FOR = 321,
-     BREAK = 322,
-     CONTINUE = 323,
-     IF = 324,
-     ELSE = 325,
-     DELETE = 326,
-     BEGIN = 327,
-     END = 328,
-     EXIT = 329,
-     NEXT = 330,
-     NEXTFILE = 331,
-     RETURN = 332,
-     FUNCTION = 333
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    UNEXPECTED = 258,              /* UNEXPECTED  */
+    BAD_DECIMAL = 259,             /* BAD_DECIMAL  */
+    NL = 260,                      /* NL  */
+    SEMI_COLON = 261,              /* SEMI_COLON  */
+    LBRACE = 262,                  /* LBRACE  */
+    RBRACE = 263,                  /* RBRACE  */
+    LBOX = 264,                    /* LBOX  */
+    RBOX = 265,                    /* RBOX  */
+    COMMA = 266,                   /* COMMA  */
+    IO_OUT = 267,                  /* IO_OUT  */
+    ASSIGN = 268,                  /* ASSIGN  */
+    ADD_ASG = 269,                 /* ADD_ASG  */
+    SUB_ASG = 270,                 /* SUB_ASG  */
+    MUL_ASG = 271,                 /* MUL_ASG  */
+    DIV_ASG = 272,                 /* DIV_ASG  */
+    MOD_ASG = 273,                 /* MOD_ASG  */
+    POW_ASG = 274,                 /* POW_ASG  */
+    QMARK = 275,                   /* QMARK  */
+    COLON = 276,                   /* COLON  */
+    OR = 277,                      /* OR  */
+    AND = 278,                     /* AND  */
+    MATCH = 279,                   /* MATCH  */
+    EQ = 280,                      /* EQ  */
+    NEQ = 281,                     /* NEQ  */
+    LT = 282,                      /* LT  */
+    LTE = 283,                     /* LTE  */
+    GT = 284,                      /* GT  */
+    GTE = 285,                     /* GTE  */
+    CAT = 286,                     /* CAT  */
+    GETLINE = 287,                 /* GETLINE  */
+    PLUS = 288,                    /* PLUS  */
+    MINUS = 289,                   /* MINUS  */
+    MUL = 290,                     /* MUL  */
+    DIV = 291,                     /* DIV  */
+    MOD = 292,                     /* MOD  */
+    NOT = 293,                     /* NOT  */
+    UMINUS = 294,                  /* UMINUS  */
+    IO_IN = 295,                   /* IO_IN  */
+    PIPE = 296,                    /* PIPE  */
+    POW = 297,                     /* POW  */
+    INC_or_DEC = 298,              /* INC_or_DEC  */
+    DOLLAR = 299,                  /* DOLLAR  */
+    LPAREN = 300,                  /* LPAREN  */
+    RPAREN = 301,                  /* RPAREN  */
+    DOUBLE = 302,                  /* DOUBLE  */
+    STRING_ = 303,                 /* STRING_  */
+    RE = 304,                      /* RE  */
+    ID = 305,                      /* ID  */
+    D_ID = 306,                    /* D_ID  */
+    FUNCT_ID = 307,                /* FUNCT_ID  */
+    BUILTIN = 308,                 /* BUILTIN  */
+    LENGTH = 309,                  /* LENGTH  */
+    FIELD = 310,                   /* FIELD  */
+    PRINT = 311,                   /* PRINT  */
+    PRINTF = 312,                  /* PRINTF  */
+    SPLIT = 313,                   /* SPLIT  */
+    MATCH_FUNC = 314,              /* MATCH_FUNC  */
+    SUB = 315,                     /* SUB  */
+    GSUB = 316,                    /* GSUB  */
+    SPRINTF = 317,                 /* SPRINTF  */
+    ASORT = 318,                   /* ASORT  */
+    ASORTI = 319,                  /* ASORTI  */
+    WRITEA = 320,                  /* WRITEA  */
+    READA = 321,                   /* READA  */
+    DO = 322,                      /* DO  */
+    WHILE = 323,                   /* WHILE  */
+    FOR = 324,                     /* FOR  */
+    BREAK = 325,                   /* BREAK  */
+    CONTINUE = 326,                /* CONTINUE  */
+    IF = 327,                      /* IF  */
+    ELSE = 328,                    /* ELSE  */
+    IN = 329,                      /* IN  */
+    DELETE = 330,                  /* DELETE  */
+    BEGIN = 331,                   /* BEGIN  */
+    END = 332,                     /* END  */
+    EXIT = 333,                    /* EXIT  */
+    NEXT = 334,                    /* NEXT  */
+    NEXTFILE = 335,                /* NEXTFILE  */
+    RETURN = 336,                  /* RETURN  */
+    FUNCTION = 337                 /* FUNCTION  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define UNEXPECTED 258
 #define BAD_DECIMAL 259
 #define NL 260
@@ -128,82 +152,82 @@
 #define RBOX 265
 #define COMMA 266
 #define IO_OUT 267
-#define POW_ASG 268
-#define MOD_ASG 269
-#define DIV_ASG 270
+#define ASSIGN 268
+#define ADD_ASG 269
+#define SUB_ASG 270
 #define MUL_ASG 271
-#define SUB_ASG 272
-#define ADD_ASG 273
-#define ASSIGN 274
-#define COLON 275
-#define QMARK 276
+#define DIV_ASG 272
+#define MOD_ASG 273
+#define POW_ASG 274
+#define QMARK 275
+#define COLON 276
 #define OR 277
 #define AND 278
-#define IN 279
-#define MATCH 280
-#define GTE 281
-#define GT 282
+#define MATCH 279
+#define EQ 280
+#define NEQ 281
+#define LT 282
 #define LTE 283
-#define LT 284
-#define NEQ 285
-#define EQ 286
-#define CAT 287
-#define GETLINE 288
+#define GT 284
+#define GTE 285
+#define CAT 286
+#define GETLINE 287
+#define PLUS 288
 #define MINUS 289
-#define PLUS 290
-#define MOD 291
-#define DIV 292
-#define MUL 293
+#define MUL 290
+#define DIV 291
+#define MOD 292
+#define NOT 293
 #define UMINUS 294
-#define NOT 295
+#define IO_IN 295
 #define PIPE 296
-#define IO_IN 297
-#define POW 298
-#define INC_or_DEC 299
-#define FIELD 300
-#define DOLLAR 301
-#define RPAREN 302
-#define LPAREN 303
-#define DOUBLE 304
-#define STRING_ 305
-#define RE 306
-#define ID 307
-#define D_ID 308
-#define FUNCT_ID 309
-#define BUILTIN 310
-#define LENGTH 311
-#define PRINT 312
-#define PRINTF 313
-#define SPLIT 314
-#define MATCH_FUNC 315
-#define SUB 316
-#define GSUB 317
-#define SPRINTF 318
-#define DO 319
-#define WHILE 320
-#define FOR 321
-#define BREAK 322
-#define CONTINUE 323
-#define IF 324
-#define ELSE 325
-#define DELETE 326
-#define BEGIN 327
-#define END 328
-#define EXIT 329
-#define NEXT 330
-#define NEXTFILE 331
-#define RETURN 332
-#define FUNCTION 333
-
-
-
+#define POW 297
+#define INC_or_DEC 298
+#define DOLLAR 299
+#define LPAREN 300
+#define RPAREN 301
+#define DOUBLE 302
+#define STRING_ 303
+#define RE 304
+#define ID 305
+#define D_ID 306
+#define FUNCT_ID 307
+#define BUILTIN 308
+#define LENGTH 309
+#define FIELD 310
+#define PRINT 311
+#define PRINTF 312
+#define SPLIT 313
+#define MATCH_FUNC 314
+#define SUB 315
+#define GSUB 316
+#define SPRINTF 317
+#define ASORT 318
+#define ASORTI 319
+#define WRITEA 320
+#define READA 321
+#define DO 322
+#define WHILE 323
+#define FOR 324
+#define BREAK 325
+#define CONTINUE 326
+#define IF 327
+#define ELSE 328
+#define IN 329
+#define DELETE 330
+#define BEGIN 331
+#define END 332
+#define EXIT 333
+#define NEXT 334
+#define NEXTFILE 335
+#define RETURN 336
+#define FUNCTION 337
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-
-/* Line 1676 of yacc.c  */
-#line 64 "parse.y"
+#line 70 "parse.y"
 
 CELL *cp ;
 SYMTAB *stp ;
@@ -212,20 +236,24 @@ PF_CP  fp ;  /* ptr to a (print/printf) or (sub/gsub) function */
 BI_REC *bip ; /* ptr to info about a builtin */
 FBLOCK  *fbp  ; /* ptr to a function block */
 ARG2_REC *arg2p ;
+CAT_REC  cat ;
 CA_REC   *ca_p  ;
 int   ival ;
 PTR   ptr ;
 
+#line 245 "y.tab.h"
 
-
-/* Line 1676 of yacc.c  */
-#line 223 "y.tab.h"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
 
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
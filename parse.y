@@ -26,6 +26,7 @@ not name that product mawk.
 #include "field.h"
 #include "files.h"
 #include "printf.h"
+#include "repl.h"
 
 
 #define  YYMAXDEPTH	200
@@ -40,11 +41,16 @@ static void   field_A2I(void) ;
 static void   check_var(SYMTAB *) ;
 static void   check_array(SYMTAB *) ;
 static void   RE_as_arg(void) ;
+static int    x_can_change(INST *, INST *, INST *) ;
+static void   code_assign(int, int) ;
+static void   code_cat(CAT_REC *, int) ;
+static void   code_slice(INST *, INST *) ;
 int REempty(PTR) ;
 
 static int scope ;
 static FBLOCK *active_funct ;
       /* when scope is SCOPE_FUNCT  */
+static CAT_REC last_chain ;  /* the last cat_expr that became an expr */
 
 #define  code_address(x)  if( is_local(x) ) \
 			     code2op(L_PUSHA, (x)->offset) ;\
@@ -69,6 +75,7 @@ PF_CP  fp ;  /* ptr to a (print/printf) or (sub/gsub) function */
 BI_REC *bip ; /* ptr to info about a builtin */
 FBLOCK  *fbp  ; /* ptr to a function block */
 ARG2_REC *arg2p ;
+CAT_REC  cat ;
 CA_REC   *ca_p  ;
 int   ival ;
 PTR   ptr ;
@@ -110,26 +117,28 @@ PTR   ptr ;
 %token  <bip> BUILTIN  LENGTH
 %token   <cp>  FIELD
 
-%token  PRINT PRINTF SPLIT MATCH_FUNC SUB GSUB SPRINTF
+%token  PRINT PRINTF SPLIT MATCH_FUNC SUB GSUB SPRINTF ASORT ASORTI
+%token  WRITEA READA
 /* keywords */
 %token  DO WHILE FOR BREAK CONTINUE IF ELSE  IN
 %token  DELETE  BEGIN  END  EXIT NEXT NEXTFILE RETURN  FUNCTION
 
 %type <start>  block  block_or_separator
 %type <start>  statement_list statement mark pmark
-%type <ival>   pr_args  printf_args
+%type <ival>   pr_args  printf_args  print_args  print_list
 %type <arg2p>  arg2
 %type <start>  builtin
 %type <start>  getline_file
 %type <start>  lvalue field  fvalue
-%type <start>  expr cat_expr p_expr
+%type <start>  expr p_expr
+%type <cat>  cat_expr
 %type <start>  while_front  if_front
 %type <start>  for1 for2
 %type <start>  array_loop_front
 %type <start>  return_statement
-%type <start>  split_front  re_arg sub_back
-%type <ival>   arglist args
-%type <fp>     sub_or_gsub
+%type <start>  split_front  re_arg sub_back  asort_array
+%type <ival>   arglist args  asort_back
+%type <fp>     sub_or_gsub  asort_or_asorti  writea_or_reada
 %type <fbp>    funct_start funct_head
 %type <ca_p>   call_args ca_front ca_back
 %type <ival>   f_arglist f_args
@@ -165,7 +174,16 @@ PA_block  :  block
                 { switch_code_to_main() ; }
 
           |  expr  /* this works just like an if statement */
-             { code_jmp(_JZ, (INST*)0) ; }
+             { INST *p1 = CDP($1) ;
+
+               /* a plain /string/ pattern joins the combined scan
+                  of $0, see rule_pattern() in re_cmpl.c */
+               if ( p1 == code_ptr - 2 && p1->op == _MATCH0 )
+               { PTR rp = rule_pattern(p1[1].ptr) ;
+                 if ( rp ) { p1->op = _RMATCH ; p1[1].ptr = rp ; }
+               }
+               code_jmp(_JZ, (INST*)0) ;
+             }
 
              block_or_separator
              { patch_jmp( code_ptr ) ; }
@@ -259,8 +277,8 @@ statement :  block
 separator  :  NL | SEMI_COLON
            ;
 
-expr  :   cat_expr
-      |   lvalue   ASSIGN   expr { code1(_ASSIGN) ; }
+expr  :   cat_expr  { $$ = $1.start ; last_chain = $1 ; }
+      |   lvalue   ASSIGN   expr { code_assign($1, $3) ; }
       |   lvalue   ADD_ASG  expr { code1(_ADD_ASG) ; }
       |   lvalue   SUB_ASG  expr { code1(_SUB_ASG) ; }
       |   lvalue   MUL_ASG  expr { code1(_MUL_ASG) ; }
@@ -322,8 +340,9 @@ expr  :   cat_expr
       ;
 
 cat_expr :  p_expr             %prec CAT
+            { $$.start = $1 ; $$.cnt = 1 ; }
          |  cat_expr  p_expr   %prec CAT
-            { code1(_CAT) ; }
+            { $$ = $1 ; code_cat(&$$, $2) ; }
          ;
 
 p_expr  :   DOUBLE
@@ -466,7 +485,7 @@ mark : /* empty */
          { $$ = code_offset ; }
 
 /* print_statement */
-statement :  PRINT pmark pr_args pr_direction separator
+statement :  PRINT pmark print_args pr_direction separator
             { code2(_PRINT, bi_print) ;
               print_flag = 0 ;
               $$ = $2 ;
@@ -530,6 +549,25 @@ pr_args :  arglist { code2op(_PUSHINT, $1) ; }
 	   { $$=0 ; code2op(_PUSHINT, 0) ; }
         ;
 
+/* the same as pr_args, but a substr() that is an argument of print
+   can be a slice */
+print_args :  /* empty */
+	      { $$ = 0 ; code2op(_PUSHINT, 0) ; }
+	   |  print_list { code2op(_PUSHINT, $1) ; }
+	   |  LPAREN  arg2 RPAREN
+	      { $$ = $2->cnt ; zfree($2,sizeof(ARG2_REC)) ;
+		code2op(_PUSHINT, $$) ;
+	      }
+	   |  LPAREN  RPAREN
+	      { $$=0 ; code2op(_PUSHINT, 0) ; }
+	   ;
+
+print_list :  expr        %prec  LPAREN
+	      { $$ = 1 ; code_slice(CDP($1), code_ptr) ; }
+	   |  print_list  COMMA  expr
+	      { $$ = $1 + 1 ; code_slice(CDP($3), code_ptr) ; }
+	   ;
+
 arg2   :   expr  COMMA  expr
            { $$ = (ARG2_REC*) zmalloc(sizeof(ARG2_REC)) ;
              $$->start = $1 ;
@@ -886,6 +924,46 @@ split_back  :   RPAREN
                 }
             ;
 
+/* asort and asorti take an array, and optionally a destination
+   array and a string naming the order */
+
+p_expr  :  asort_or_asorti LPAREN asort_array asort_back RPAREN
+           { $$ = $3 ;
+             code2op(_PUSHINT, $4) ;
+             code2(_BUILTIN, $1) ;
+           }
+        ;
+
+asort_or_asorti :  ASORT   { $$ = bi_asort ; }
+                |  ASORTI  { $$ = bi_asorti ; }
+                ;
+
+asort_array :  ID
+               { $$ = code_offset ;
+                 check_array($1) ;
+                 code_array($1) ;
+               }
+            ;
+
+asort_back  :  /* empty */  { $$ = 1 ; }
+            |  COMMA asort_array  { $$ = 2 ; }
+            |  COMMA asort_array COMMA expr  { $$ = 3 ; }
+            ;
+
+/* writea and reada take a file name and an array */
+
+p_expr  :  writea_or_reada LPAREN expr COMMA ID RPAREN
+           { $$ = $3 ;
+             check_array($5) ;
+             code_array($5) ;
+             code2(_BUILTIN, $1) ;
+           }
+        ;
+
+writea_or_reada :  WRITEA  { $$ = bi_writea ; }
+                |  READA   { $$ = bi_reada ; }
+                ;
+
 /* sprintf -- try to parse form at compile time *
 
 p_expr
@@ -952,12 +1030,18 @@ p_expr :  LENGTH
 
 
 
-/*  match(expr, RE) */
+/*  match(expr, RE) and match(expr, RE, ID) */
 
 p_expr : MATCH_FUNC LPAREN expr COMMA re_arg RPAREN
         { $$ = $3 ;
           code2(_BUILTIN, bi_match) ;
         }
+     | MATCH_FUNC LPAREN expr COMMA re_arg COMMA ID RPAREN
+        { $$ = $3 ;
+          check_array($7) ;
+          code_array($7) ;
+          code2(_BUILTIN, bi_match3) ;
+        }
      ;
 
 
@@ -1103,7 +1187,7 @@ funct_start   :  funct_head  LPAREN  f_arglist  RPAREN
                    else $1->typev = (char *) 0 ;
 
 		   code_ptr = code_base =
-                       (INST *) zmalloc(INST_BYTES(PAGESZ));
+                       (INST *) zmalloc_t(INST_BYTES(PAGESZ), ZT_CODE);
 		   code_limit = code_base + PAGESZ ;
 		   code_warn = code_limit - CODEWARN ;
                  }
@@ -1243,7 +1327,7 @@ ca_back    :  expr   RPAREN
 
 static void  resize_fblock( FBLOCK * fbp )
 {
-  CODEBLOCK *p = ZMALLOC(CODEBLOCK) ;
+  CODEBLOCK *p = (CODEBLOCK*) zmalloc_t(sizeof(CODEBLOCK), ZT_CODE) ;
   unsigned dummy ;
 
   code2op(_RET0, _HALT) ;
@@ -1347,6 +1431,103 @@ static void code_array(SYMTAB* p)
   else  code2(A_PUSHA, p->stval.array) ;
 }
 
+/* code the cat_expr  chain p_expr, p_expr starts at offset x.
+   A chain of two is coded  a b cat,  longer chains are coded
+   a b c ... catn n,  so the result is built with one allocation.
+   The operands are all on the eval stack, so n is at most MAX_CATN;
+   after that the result is the first operand of a new chain.
+*/
+
+static void code_cat(CAT_REC *chain, int x)
+{
+  if ( chain->cnt == 1 )  code_slice(CDP(chain->start), CDP(x)) ;
+  code_slice(CDP(x), code_ptr) ;
+
+  if ( chain->cnt == 1 || chain->cnt == MAX_CATN )
+  {
+    chain->second = x ;
+    chain->cnt = 2 ;
+    code1(_CAT) ;
+  }
+  else
+  {
+    /* remove the cat that ends chain, it is just before x */
+    int to = x - (chain->cnt == 2 ? 1 : 2) ;
+    unsigned len ;
+
+    code_push(CDP(x), code_ptr - CDP(x), scope, active_funct) ;
+    len = code_pop(CDP(to)) ;
+    code_ptr = CDP(to) + len ;
+    chain->cnt++ ;
+    code2op(_CATN, chain->cnt) ;
+  }
+  chain->end = code_offset ;
+}
+
+/* the value of the code from p to q is used once, by cat or print.
+   If it is a call of substr(), it can be a slice of its argument,
+   see bi_substr_slice().  q[-2] and q[-1] can be the operands of
+   other instructions, but then q[-1] is not the address of a
+   function.
+*/
+
+static void code_slice(INST *p, INST *q)
+{
+  if ( q - p >= 2 && q[-2].op == _BUILTIN &&
+       q[-1].ptr == (PTR) bi_substr )
+     q[-1].ptr = (PTR) bi_substr_slice ;
+}
+
+/* code the end of lvalue = expr, lvalue at offset lv and expr at ex.
+   If it is  v = v x y ... , the code is
+       pusha v  pushi v  <x>  <y> ...  cat (or catn)
+   which becomes
+       pusha v  <x>  <y> ...  append n
+   so v can grow in place.  v is then read after x y ..., so this is
+   not done if they can change v: if they take the address of v
+   (getline v, sub(r, s, v)) or call a function and v is global.  Nor
+   is it done if v is a builtin variable, which getline and match()
+   set.  The test looks at every word, so an operand can stop it, but
+   that is rare.
+*/
+
+static int  x_can_change(INST * p, INST * x, INST * end)
+{
+  if ( p->op == _PUSHA && (CELL *) p[1].ptr >= bi_vars &&
+       (CELL *) p[1].ptr < bi_vars + NUM_BI_VAR )  return 1 ;
+
+  for ( ; x < end ; x++ )
+  {
+    if ( x->op == _CALL && p->op == _PUSHA )  return 1 ;
+    if ( x->op == p->op && x + 1 < end &&
+         (p->op == _PUSHA ? x[1].ptr == p[1].ptr : x[1].op == p[1].op) )
+       return 1 ;
+  }
+  return 0 ;
+}
+
+static void code_assign(int lv, int ex)
+{
+  INST *p = CDP(lv) ;
+  INST *cat = code_ptr - (last_chain.cnt == 2 ? 1 : 2) ;
+
+  if ( ex == lv + 2 && last_chain.start == ex &&
+       last_chain.end == code_offset && last_chain.cnt >= 2 &&
+       last_chain.second == ex + 2 &&
+       ( (p[0].op == _PUSHA && p[2].op == _PUSHI && p[1].ptr == p[3].ptr) ||
+         (p[0].op == L_PUSHA && p[2].op == L_PUSHI && p[1].op == p[3].op) ) &&
+       !x_can_change(p, p + 4, cat) )
+  {
+    INST *x = p + 4 ;
+    unsigned len ;
+
+    code_push(x, cat - x, scope, active_funct) ;
+    len = code_pop(CDP(ex)) ;
+    code_ptr = CDP(ex) + len ;
+    code2op(_APPEND, last_chain.cnt - 1) ;
+  }
+  else  code1(_ASSIGN) ;
+}
 
 /* we've seen an ID as an argument to a user defined function */
 
@@ -1449,6 +1630,7 @@ parse(void)
    if ( yyparse() || compile_error_count != 0 ) mawk_exit(2) ;
 
    scan_cleanup() ;
+   rule_patterns_build() ;
    set_code() ;
    /* code must be set before call to resolve_fcalls() */
    if ( resolve_list )  resolve_fcalls() ;
@@ -31,6 +31,12 @@ you agree to not name that product mawk.
 
 static void  print_cell(CELL *, FILE *) ;
 
+/* an argument of print can be a C_SLICE, see bi_substr_slice() */
+#define  print_destroy(p)  do { \
+	    if ((p)->type == C_SLICE)  free_STRING(string(p)) ;\
+	    else  cell_destroy(p) ;\
+	 } while(0)
+
 
 /* Once execute() starts the sprintf code is (belatedly) the only
    code allowed to use string_buff  */
@@ -60,6 +66,15 @@ print_cell(CELL* p, FILE* fp)
 	 }
 	 break ;
 
+      case C_SLICE:
+	 {
+	    SLICE s ;
+
+	    slice_get(p, s) ;
+	    fwrite(string(p)->str + s.off, 1, s.len, fp) ;
+	 }
+	 break ;
+
       case C_DOUBLE:
 	 {
 	    double d = p->dval ;
@@ -184,11 +199,11 @@ bi_print(CELL *sp)		 /* stack ptr passed in */
       while (k > 0)
       {
 	 print_cell(p,fp) ; print_cell(OFS,fp) ;
-	 cell_destroy(p) ;
+	 print_destroy(p) ;
 	 p++ ; k-- ;
       }
 
-      print_cell(p, fp) ;  cell_destroy(p) ;
+      print_cell(p, fp) ;  print_destroy(p) ;
    }
    else
    {				/* print $0 */
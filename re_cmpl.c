@@ -15,16 +15,19 @@ you agree to not name that product mawk.
 
 /*  re_cmpl.c  */
 
+#define  ZTAG  ZT_RE
 #include "mawk.h"
 #include "memory.h"
 #include "scan.h"
 #include "regexp.h"
 #include "repl.h"
 #include "split.h"
+#include "field.h"
 
 typedef struct re_node {
     const STRING *sval;
     PTR re;
+    PTR gre;			/* with groups, made by re_groups() */
     struct re_node *link;
 } RE_NODE;
 
@@ -77,9 +80,11 @@ re_compile(const STRING * sval)
 		return (PTR) 0;
 	    }
 	}
+	zcount(ZT_RE, 0, REsize(re));
 	p = ZMALLOC(RE_NODE);
 	p->sval = STRING_dup(sval);
 	p->re = re;
+	p->gre = 0;
     }
 
   found:
@@ -96,6 +101,36 @@ re_compile(const STRING * sval)
     return p->re;
 }
 
+/* the machine for match(s, r, A), re compiled again with its
+   ( ) groups tagged.  re came from re_compile() */
+PTR
+re_groups(PTR re)
+{
+    RE_NODE *p = re_list;
+    RE_NODE *q = 0;
+
+    while (p->re != re) {
+	q = p;
+	p = p->link;
+#ifdef DEBUG
+	if (!p)
+	    bozo("non compiled machine");
+#endif
+    }
+    if (q) {			/* move to front */
+	q->link = p->link;
+	p->link = re_list;
+	re_list = p;
+    }
+    if (!p->gre) {
+	p->gre = REcompile_groups(p->sval->str, p->sval->len);
+	if (p->gre == 0)
+	    rt_error(efmt, REerrlist[REerrno], p->sval->str);
+	zcount(ZT_RE, 0, REsize(p->gre));
+    }
+    return p->gre;
+}
+
 /* this is only used by da() */
 
 const STRING*
@@ -115,6 +150,219 @@ re_uncompile(PTR m)
 #endif
 }
 
+/*=================================================*/
+/*  combined main rule patterns  */
+
+/*
+ *  Programs generated from signature lists look like
+ *
+ *	/sig-one/ { ... }
+ *	/sig-two/ { ... }
+ *	... hundreds more ...
+ *
+ *  and every record is run through every machine in turn.  The parser
+ *  passes each main rule pattern to rule_pattern(); the ones that are
+ *  a plain string (no meta characters, see is_string_split()) are coded
+ *  as _RMATCH instead of _MATCH0.  If there are at least RULE_SCAN_MIN
+ *  of them, rule_patterns_build() merges the strings into one
+ *  Aho-Corasick automaton.  The first _RMATCH executed for a record
+ *  scans $0 once and marks every string that occurs, the following
+ *  _RMATCH's just look up their mark.
+ *
+ *  The marks belong to the STRING that was scanned (we hold a
+ *  reference to it, so it cannot be freed and reused), if an action
+ *  changes $0 the next _RMATCH rescans.
+ *
+ *  The automaton is a full transition table over byte classes, bytes
+ *  that are in none of the strings share class 0.
+ */
+
+static RULE_RE **rule_vec;	/* all the _RMATCH patterns */
+static unsigned rule_cnt;
+static unsigned rule_size;
+
+static unsigned char ac_class[256];
+static unsigned ac_nclass;
+static int *ac_delta;		/* ac_nstates * ac_nclass */
+static int *ac_out;		/* self or nearest suffix state that ends a string */
+static int *ac_dict;		/* nearest proper suffix state that ends a string */
+static unsigned *ac_mark;	/* ac_mark[s] == ac_gen, if s was seen this scan */
+static unsigned ac_nstates;
+static unsigned ac_gen;
+static STRING *ac_scanned;	/* what the marks belong to */
+
+#define	 DELTA(s,c)   ac_delta[(s)*ac_nclass+(c)]
+
+/* re is the machine for a main rule pattern, if it is a plain string
+   return a RULE_RE for an _RMATCH, else return 0 and it stays _MATCH0
+*/
+PTR
+rule_pattern(PTR re)
+{
+    size_t len;
+    const char *s = is_string_split(re, &len);
+    RULE_RE *r;
+
+    if (s == 0 || len == 0)
+	return (PTR) 0;
+
+    r = ZMALLOC(RULE_RE);
+    r->re = re;
+    r->str = s;
+    r->len = len;
+    r->idx = rule_cnt;
+    r->state = 0;
+
+    if (rule_cnt == rule_size) {
+	if (rule_size == 0) {
+	    rule_size = 64;
+	    rule_vec = (RULE_RE **) zmalloc(rule_size * sizeof(RULE_RE *));
+	} else {
+	    rule_vec = (RULE_RE **) zrealloc(rule_vec,
+					     rule_size * sizeof(RULE_RE *),
+					     2 * rule_size * sizeof(RULE_RE *));
+	    rule_size *= 2;
+	}
+    }
+    rule_vec[rule_cnt++] = r;
+    return (PTR) r;
+}
+
+/* called once, after the program is parsed */
+void
+rule_patterns_build(void)
+{
+    unsigned i, c;
+    size_t total = 1;		/* upper bound on number of states */
+    int *fail;
+    int *queue;
+    unsigned qhead, qtail;
+
+    if (rule_cnt < RULE_SCAN_MIN)
+	return;			/* _RMATCH will use REtest() */
+
+    ac_nclass = 1;
+    for (i = 0; i < rule_cnt; i++) {
+	const unsigned char *s = (const unsigned char *) rule_vec[i]->str;
+	const unsigned char *s_end = s + rule_vec[i]->len;
+
+	total += rule_vec[i]->len;
+	while (s < s_end) {
+	    if (ac_class[*s] == 0)
+		ac_class[*s] = ac_nclass++;
+	    s++;
+	}
+    }
+
+    /* build the trie, in the trie an edge to state 0 means no edge */
+    ac_delta = (int *) emalloc(total * ac_nclass * sizeof(int));
+    memset(ac_delta, 0, total * ac_nclass * sizeof(int));
+    ac_nstates = 1;
+    for (i = 0; i < rule_cnt; i++) {
+	const unsigned char *s = (const unsigned char *) rule_vec[i]->str;
+	const unsigned char *s_end = s + rule_vec[i]->len;
+	int state = 0;
+
+	while (s < s_end) {
+	    c = ac_class[*s++];
+	    if (DELTA(state, c) == 0)
+		DELTA(state, c) = ac_nstates++;
+	    state = DELTA(state, c);
+	}
+	rule_vec[i]->state = state;
+    }
+    ac_delta = (int *) erealloc(ac_delta,
+				ac_nstates * ac_nclass * sizeof(int));
+
+    ac_out = (int *) emalloc(ac_nstates * sizeof(int));
+    ac_dict = (int *) emalloc(ac_nstates * sizeof(int));
+    ac_mark = (unsigned *) emalloc(ac_nstates * sizeof(unsigned));
+    memset(ac_out, 0, ac_nstates * sizeof(int));
+    memset(ac_mark, 0, ac_nstates * sizeof(unsigned));
+    for (i = 0; i < rule_cnt; i++) {
+	ac_out[rule_vec[i]->state] = rule_vec[i]->state;
+    }
+
+    /* breadth first, fill in failure links and complete the
+       transition table */
+    fail = (int *) emalloc(ac_nstates * sizeof(int));
+    queue = (int *) emalloc(ac_nstates * sizeof(int));
+    qhead = qtail = 0;
+    fail[0] = 0;
+    ac_dict[0] = 0;
+    for (c = 0; c < ac_nclass; c++) {
+	int t = DELTA(0, c);
+	if (t) {
+	    fail[t] = 0;
+	    queue[qtail++] = t;
+	}
+    }
+    while (qhead < qtail) {
+	int s = queue[qhead++];
+
+	ac_dict[s] = ac_out[fail[s]];
+	if (ac_out[s] == 0)
+	    ac_out[s] = ac_dict[s];
+
+	for (c = 0; c < ac_nclass; c++) {
+	    int t = DELTA(s, c);
+	    if (t) {
+		fail[t] = DELTA(fail[s], c);
+		queue[qtail++] = t;
+	    } else
+		DELTA(s, c) = DELTA(fail[s], c);
+	}
+    }
+    free(fail);
+    free(queue);
+}
+
+/* mark every state that ends a string occurring in sval */
+static void
+rule_scan(const STRING * sval)
+{
+    const unsigned char *s = (const unsigned char *) sval->str;
+    const unsigned char *const s_end = s + sval->len;
+    int state = 0;
+    unsigned gen;
+
+    if (++ac_gen == 0) {
+	/* wrapped, start again */
+	memset(ac_mark, 0, ac_nstates * sizeof(unsigned));
+	ac_gen = 1;
+    }
+    gen = ac_gen;
+
+    while (s < s_end) {
+	int t;
+
+	state = DELTA(state, ac_class[*s++]);
+	/* once a state is marked, so is the rest of its suffix chain */
+	for (t = ac_out[state]; t && ac_mark[t] != gen; t = ac_dict[t]) {
+	    ac_mark[t] = gen;
+	}
+    }
+}
+
+/* does $0 (sval) match the _RMATCH pattern p */
+int
+rule_test(STRING * sval, PTR p)
+{
+    const RULE_RE *r = (const RULE_RE *) p;
+
+    if (ac_delta == 0)
+	return REtest(sval->str, sval->len, r->re);
+
+    if (sval != ac_scanned) {
+	if (ac_scanned)
+	    free_STRING(ac_scanned);
+	ac_scanned = sval;
+	sval->ref_cnt++;
+	rule_scan(sval);
+    }
+    return ac_mark[r->state] == ac_gen;
+}
+
 /*=================================================*/
 /*  replacement	 operations   */
 
@@ -17,11 +17,16 @@ you agree to not name that product mawk.
 #define __USE_MINGW_ANSI_STDIO 1 /* So mingw uses its printf not msvcrt */
 #endif
 #include <stdio.h>
+#include <stddef.h>
 
 PTR   REcompile(const char *, size_t)  ;
+PTR   REcompile_groups(const char *, size_t)  ;
+int   REgroups(PTR) ;
+char *REmatch_groups(const char *, size_t, PTR, size_t*, ptrdiff_t*) ;
 int   REtest (const char *, size_t, PTR)  ;
 char *REmatch(const char *, size_t, PTR, size_t*, Bool)  ;
 void  REmprint(PTR , FILE*) ;
+size_t REsize(PTR) ;
 
 extern  int  REerrno ;
 extern  const char* const REerrlist[] ;
@@ -21,8 +21,22 @@ you agree to not name that product mawk.
 #include "types.h"
 
 PTR re_compile(const STRING *);
+PTR re_groups(PTR);
 const STRING* re_uncompile(PTR);
 
+/* a main rule pattern that is a plain string, see re_cmpl.c */
+typedef struct {
+    PTR re;			/* the machine */
+    const char *str;		/* the string it matches */
+    size_t len;
+    unsigned idx;		/* position in the program */
+    int state;			/* state that ends str in combined scan */
+} RULE_RE;
+
+PTR rule_pattern(PTR);
+void rule_patterns_build(void);
+int rule_test(STRING *, PTR);
+
 typedef struct {
     unsigned cnt;		/* number of pieces */
     unsigned amp_cnt;		/* number of & */
@@ -52,6 +52,8 @@ static  short  table[8][8]  =  {
 
 static jmp_buf err_buf ;	 /*  used to trap on error */
 
+static int group_flag ;	 /* tag ( ) groups, see REcompile_groups() */
+
 void
 RE_error_trap(int x)
 {
@@ -68,11 +70,20 @@ REcompile(const char* re, size_t re_len)
    {
       int token ;
       int prec ;
+      int group ;	  /* ( with group_flag, the group number */
+      MACHINE *mp ;	  /* and the machine stack below it */
    }
    op_stack[STACKSZ] ;
    register MACHINE *m_ptr ;
    register struct op *op_ptr ;
    register int t ;
+   int ngroups = 0 ;
+
+   /* (?i) in front, letters match either case */
+   RE_fold = re_len >= 4 && memcmp(re, "(?i)", 4) == 0 ;
+   if (RE_fold) {
+      re += 4 ; re_len -= 4 ;
+   }
 
    /* do this first because it also checks if we have a
      run time stack */
@@ -119,7 +130,8 @@ REcompile(const char* re, size_t re_len)
 		   if ((m_ptr->stop -1)->type == M_WAIT) {
 			(m_ptr->stop - 1)->type = M_ACCEPT ;
 		   }
-	           return (PTR) m_ptr->start ;
+	           RE_class_runs(m_ptr->start) ;
+	           return (PTR) RE_linear(m_ptr->start, ngroups) ;
 	       }
 	       else
 	       {
@@ -166,6 +178,14 @@ REcompile(const char* re, size_t re_len)
 			RE_01(m_ptr) ;
 			break ;
 
+		     case T_LP:
+			if (group_flag) {
+			    if (m_ptr != op_ptr->mp + 1)
+				RE_error_trap(-E4) ;
+			    RE_group(m_ptr, op_ptr->group) ;
+			}
+			break ;
+
 		     default:
 			/*nothing on ( or ) */
 			break ;
@@ -191,6 +211,10 @@ REcompile(const char* re, size_t re_len)
 	    }
 
 	    op_ptr->token = t ;
+	    if (t == T_LP && group_flag) {
+	       op_ptr->group = ++ngroups ;
+	       op_ptr->mp = m_ptr ;
+	    }
       }				/* end of switch */
 
       if (m_ptr == m_stack + (STACKSZ - 1))
@@ -204,6 +228,19 @@ REcompile(const char* re, size_t re_len)
 }
 
 
+/* compile with the ( ) groups tagged for REmatch_groups() */
+PTR
+REcompile_groups(const char* re, size_t re_len)
+{
+   PTR ret ;
+
+   group_flag = 1 ;
+   ret = REcompile(re, re_len) ;
+   group_flag = 0 ;
+   return ret ;
+}
+
+
 /* getting here means a logic flaw or unforeseen case */
 void
 RE_panic(const char *s)
@@ -24,15 +24,20 @@ typedef void* PTR ;
 #include <stdio.h>
 #include <string.h>
 #include <stdint.h>
+#include <stddef.h>
 #include  <setjmp.h>
 #include "..\mawk.h" /* needed for ya-sprintf */
 
 typedef int Bool ;
 PTR   REcompile(const char *,size_t)  ;
+PTR   REcompile_groups(const char *,size_t)  ;
+int   REgroups(PTR) ;
+char *REmatch_groups(const char *, size_t, PTR, size_t*, ptrdiff_t*) ;
 int   REtest (const char *, size_t len, PTR)  ;
 char *REmatch(const char *, size_t, PTR, size_t*, Bool)  ;
 void  REmprint(PTR , FILE*) ;
 int   REempty(PTR) ;
+size_t REsize(PTR) ;
 
 extern  int  REerrno ;
 extern  const char* const REerrlist[] ;
@@ -56,7 +61,10 @@ PTR  RE_realloc(void *,size_t) ;
 #define  M_2JB     	8
 #define  M_WAIT         9
 #define  M_ACCEPT  	10
-#define  U_ON      	11
+#define  M_LINEAR       11  /* only first, run with RE_linear_match() */
+#define  M_ISTR         12  /* M_STR ignoring case, str is lower case */
+#define  M_SAVE         13  /* jump is the group boundary to save */
+#define  U_ON      	14
 
 #define  U_OFF     0
 #define  END_OFF   0
@@ -65,9 +73,18 @@ PTR  RE_realloc(void *,size_t) ;
 
 typedef  uint32_t BV[8] ;  /* bit vector */
 
+/* classes are allocated as a CLASS_BV, the BV is first so a BV*
+   is also a CLASS_BV*.  nib[] holds the BV indexed by the low
+   nibble of a character, nib[0] for the high nibbles 0-7 and
+   nib[1] for 8-15, so 16 characters can be tested at once */
+typedef  struct {
+    BV bv ;
+    unsigned char nib[2][16] ;
+} CLASS_BV ;
+
 typedef  struct
 { int type ;
-  size_t len ;  /* used for M_STR  */
+  size_t len ;  /* used for M_STR, flags for M_CLASS  */
   union
    {
      char *str  ;  /* string */
@@ -78,6 +95,10 @@ typedef  struct
 
 #define  STATESZ  (sizeof(STATE))
 
+/* M_CLASS len flags, set by RE_class_runs() on the body of [..]* and [..]+ */
+#define  CLASS_RUN      1  /* next state cannot start with a class member */
+#define  CLASS_RUN_END  2  /* next state is M_ACCEPT */
+
 typedef  struct
 { STATE  *start, *stop ; }   MACHINE ;
 
@@ -133,18 +154,32 @@ MACHINE    RE_start(void) ;
 MACHINE    RE_end(void) ;
 MACHINE    RE_any(void) ;
 MACHINE    RE_str(char *, size_t) ;
+MACHINE    RE_istr(char *, size_t) ;
 MACHINE    RE_class(const BV *) ;
+void       RE_class_runs(STATE *) ;
+int        RE_machine_size(STATE *) ;
 void       RE_cat(MACHINE *, MACHINE *) ;
 void       RE_or(MACHINE *, MACHINE *) ;
 void       RE_close(MACHINE *) ;
 void       RE_poscl(MACHINE *) ;
 void       RE_01(MACHINE *) ;
+void       RE_group(MACHINE *, int) ;
 void       RE_panic(const char *) ;
 char*      str_str(const char *, size_t , const char *, size_t) ;
+char*      str_istr(const char *, size_t , const char *, size_t) ;
+int        RE_icmp(const char *, const char *, size_t) ;
 
+extern int RE_fold ;
 void       RE_lex_init (const char *,size_t) ;
 int        RE_lex (MACHINE *) ;
 void       RE_run_stack_init(void) ;
 RT_STATE * RE_new_run_stack(void) ;
+const char* RE_class_scan(const BV *, const char *, const char *) ;
+const char* RE_class_span(const BV *, const char *, const char *) ;
+
+extern int RE_linear_flag ;
+STATE*     RE_linear(STATE *, int) ;
+char*      RE_linear_match(STATE *, const char *, size_t, size_t *,
+                           Bool, Bool) ;
 
 #endif   /* REXP_H  */
@@ -17,6 +17,7 @@ you agree to not name that product mawk.
 /*  lexical scanner  */
 
 #include  "rexp.h"
+#include <ctype.h>
 
 static int do_str(int, const char **, MACHINE *) ;
 static int do_class(const char **, MACHINE *) ;
@@ -51,6 +52,8 @@ static unsigned char REchar2token[256] = {
 
 #define NOT_STARTED    (-1)
 
+int RE_fold ;           /* set by (?i), see REcompile() */
+
 static int prev ;       /* previous token */
 static const char *lp ;		 /*  ptr into reg exp string  */
 static const char* re_str ;   /* parsing this string */
@@ -211,7 +214,23 @@ out:
 
    *s = 0 ;
    *pp = p ;
-   *mp = RE_str((char *) RE_realloc(str, len + 1), len) ;
+   str = (char *) RE_realloc(str, len + 1) ;
+   if (RE_fold) {
+      /* match either case, if there is a letter with two */
+      Bool has_case = 0 ;
+      for (s = str; s < str + len; s++) {
+	 int lc = tolower(*(unsigned char *) s) ;
+	 if (lc != *(unsigned char *) s || toupper(lc) != lc) {
+	    *s = lc ;
+	    has_case = 1 ;
+	 }
+      }
+      if (has_case) {
+	 *mp = RE_istr(str, len) ;
+	 return T_STR ;
+      }
+   }
+   *mp = RE_str(str, len) ;
    return T_STR ;
 }
 
@@ -258,6 +277,43 @@ static void BV_or(BV bv1, const BV bv2)
     }
 }
 
+/* a new empty BV, with room for the nibble tables */
+static BV* new_BV(void)
+{
+    CLASS_BV* p = (CLASS_BV*) RE_malloc(sizeof(CLASS_BV)) ;
+    memset(p, 0, sizeof(CLASS_BV)) ;
+    return &p->bv ;
+}
+
+/* fill in the nibble tables of a finished BV, see RE_class_scan() */
+static void BV_nibbles(BV* bvp)
+{
+    CLASS_BV* p = (CLASS_BV*) bvp ;
+    unsigned c ;
+    memset(p->nib, 0, sizeof(p->nib)) ;
+    for(c = 0; c < 256; c++) {
+        if (ISON(*bvp, c)) {
+	    p->nib[c >> 7][c & 15] |= 1 << ((c >> 4) & 7) ;
+	}
+    }
+}
+
+/* with (?i), a letter in the class brings in its other case */
+static void BV_fold(BV* bvp)
+{
+    BV x ;
+    unsigned c ;
+    memcpy(x, *bvp, sizeof(BV)) ;
+    for(c = 0; c < 256; c++) {
+        if (ISON(x, c)) {
+	    unsigned lc = tolower(c) ;
+	    unsigned uc = toupper(c) ;
+	    ON(*bvp, lc) ;
+	    ON(*bvp, uc) ;
+	}
+    }
+}
+
 /* build a BV for a character class.
    *start points at the '['
    on exit:   *start points at the character after ']'
@@ -290,15 +346,14 @@ do_class(const char** start, MACHINE* mp)
 	    /* [] and [^] alone is not OK */
 	    RE_error_trap(-E3) ;
 	}
-	bvp = (BV *)RE_malloc(sizeof(BV)) ;
-	memset(bvp,0,sizeof(BV)) ;
+	bvp = new_BV() ;
 	ON(*bvp, ']') ;
 	p++ ;
     }
     if (!comp_flag && bvp == 0 && p[0] == '[' && p[1] == ':') {
 	t = p ;
         cc_bvp = do_named_cc(&t) ;
-	if (*t == ']' && t+1 == re_end) {
+	if (*t == ']' && t+1 == re_end && !RE_fold) {
 	    /* [[:name:]] */
             *mp = RE_class(cc_bvp) ;
 	    *start = re_end ;
@@ -307,8 +362,7 @@ do_class(const char** start, MACHINE* mp)
     }
 
     if (bvp == 0) {
-        bvp = (BV *)RE_malloc(sizeof(BV)) ;
-	memset(bvp, 0, sizeof(BV)) ;
+        bvp = new_BV() ;
 	if (cc_bvp) {
 	    BV_or(*bvp, *cc_bvp) ;
 	}
@@ -422,12 +476,16 @@ do_class(const char** start, MACHINE* mp)
 	}
     }
 
+    if (RE_fold) {
+        BV_fold(bvp) ;
+    }
     if (comp_flag) {
         unsigned i ;
         for(i=0; i < 8; i++) {
             (*bvp)[i] = ~(*bvp)[i] ;
 	}
     }
+    BV_nibbles(bvp) ;
     *mp = RE_class((const BV*) bvp) ;
     return T_CLASS ;
 }
@@ -598,8 +656,6 @@ escape(const char** start_p)
 
 /* named character class  */
 
-#include <ctype.h>
-
 #if !defined(isblank)			/* check for nonstandard macro */
 
 #define isblank isblank_		/* hide from C++ declaration conflict */
@@ -657,14 +713,14 @@ static const BV* lookup_cclass(const char* name)
 	else {
 	    unsigned c ;
 	    int (*tester)(int) = try->tester ;
-	    BV* bvp = (BV *)RE_malloc(sizeof(BV)) ;
+	    BV* bvp = new_BV() ;
 	    try->bvp = (const BV*) bvp ;
-	    memset(bvp, 0, sizeof(BV)) ;
 	    for(c = 0; c < 256; c++) {
 	        if (tester(c)) {
 		    ON(*bvp,c) ;
 		}
 	    }
+	    BV_nibbles(bvp) ;
 	    return (const BV*) bvp ;
 	}
     }
@@ -17,6 +17,7 @@ you agree to not name that product mawk.
 /*  re machine	operations  */
 
 #include  "rexp.h"
+#include <ctype.h>
 
 
 #define is_MU(mp) ((mp)->start->type == M_U && (mp)->stop - (mp)->start == 1)
@@ -104,6 +105,7 @@ RE_class(const BV* bvp)
    MACHINE x ;
 
    new_TWO(M_CLASS, &x) ;
+   x.start->len = 0 ;
    x.start->data.bvp = bvp ;
    return x ;
 }
@@ -119,6 +121,18 @@ RE_str(char* str, size_t len)
    return x ;
 }
 
+/* str is already lower case */
+MACHINE
+RE_istr(char* str, size_t len)
+{
+   MACHINE x ;
+
+   new_TWO(M_ISTR, &x) ;
+   x.start->len = len ;
+   x.start->data.str = str ;
+   return x ;
+}
+
 
 /*  replace m and n by a machine that recognizes  mn
 
@@ -190,14 +204,17 @@ void RE_catQQ(MACHINE* mp, MACHINE* np)
 {
     MACHINE m_copy ;
     MACHINE n_copy ;
+    Bool n_wait ;
 
     remove_Q(mp) ;
     remove_Q(np) ;
     machine_copy(&m_copy,mp) ;
     machine_copy(&n_copy,np) ;
 
+    /* an M_WAIT that N already had must stay, N jumps past it */
+    n_wait = np->stop[-1].type == M_WAIT ;
     RE_cat(mp,np) ;
-    if (mp->stop[-1].type == M_WAIT) {
+    if (!n_wait && mp->stop[-1].type == M_WAIT) {
         /* remove it */
 	mp->stop-- ;
 	mp->stop->type = M_ACCEPT ;
@@ -225,6 +242,7 @@ Bool is_endable(MACHINE* mp)
 {
     switch(mp->stop[-1].type) {
         case M_STR:
+	case M_ISTR:
 	case M_CLASS:
 	case M_ANY:
 	case M_START:
@@ -434,6 +452,29 @@ RE_01(MACHINE* mp)
     }
 }
 
+/*  replace m by a machine that saves the start and end of
+    group n, for REcompile_groups()
+
+    M_SAVE 2n-2, m, M_SAVE 2n-1
+
+    jumps in m to its M_ACCEPT now go to the second M_SAVE
+*/
+void
+RE_group(MACHINE* mp, int n)
+{
+    unsigned sz = mp->stop - mp->start + 1 ;
+    STATE* p = (STATE *) RE_malloc((sz + 2) * STATESZ) ;
+    memcpy(p + 1, mp->start, sz * STATESZ) ;
+    free(mp->start) ;
+    p[0].type = M_SAVE ;
+    p[0].data.jump = 2 * n - 2 ;
+    p[sz].type = M_SAVE ;
+    p[sz].data.jump = 2 * n - 1 ;
+    p[sz + 1].type = M_ACCEPT ;
+    mp->start = p ;
+    mp->stop = p + sz + 1 ;
+}
+
 /* this is a hook for mawk's split, was the machine generated by 
    a regular expression of "".
 */
@@ -444,6 +485,86 @@ int REempty(PTR p)
     return s->type == M_ACCEPT ;
 }
 
+/* number of states in m, including the M_ACCEPT at the end */
+int
+RE_machine_size(STATE* m)
+{
+    STATE* p = m ;
+    STATE* last = m ;
+
+    while (1) {
+	switch (p->type) {
+	case M_1J:
+	case M_2JA:
+	    if (p + p->data.jump > last)
+		last = p + p->data.jump ;
+	    break ;
+	}
+	if (p->type == M_ACCEPT && p >= last)
+	    return p - m + 1 ;
+	p++ ;
+    }
+}
+
+/* bytes of a machine from REcompile(), for -W memstats */
+size_t
+REsize(PTR m)
+{
+    return RE_machine_size((STATE*) m) * sizeof(STATE) ;
+}
+
+/* called by REcompile() on a finished machine.
+   Mark each M_CLASS that is the whole body of a loop, [..]* or [..]+,
+   where the loop can only be left at the end of a run of the class,
+   because what follows cannot start with a class member.  The matchers
+   then take the whole run at once instead of pushing a state for
+   every character.  If what follows is M_ACCEPT, the run is
+   still the longest match, which is all REmatch() wants.
+*/
+void
+RE_class_runs(STATE* m)
+{
+    int size = RE_machine_size(m) ;
+    int i ;
+
+    for (i = 0; i + 2 < size; i++) {
+	STATE* p = m + i ;
+	STATE* next = p + 2 ;
+	int type ;
+	if (p->type != M_CLASS || p[1].type != M_2JB || p[1].data.jump != -1)
+	    continue ;
+	type = next->type >= END_ON ? next->type - END_ON : next->type ;
+	switch (type) {
+	case M_STR:
+	    if (next->len > 0 && !ISON(*p->data.bvp, next->data.str[0]))
+		p->len = CLASS_RUN ;
+	    break ;
+	case M_ISTR:
+	    if (next->len > 0 && !ISON(*p->data.bvp, next->data.str[0]) &&
+		!ISON(*p->data.bvp, toupper((unsigned char) next->data.str[0])))
+		p->len = CLASS_RUN ;
+	    break ;
+	case M_CLASS:
+	    {
+		unsigned k ;
+		for (k = 0; k < 8; k++) {
+		    if ((*p->data.bvp)[k] & (*next->data.bvp)[k])
+			break ;
+		}
+		if (k == 8)
+		    p->len = CLASS_RUN ;
+	    }
+	    break ;
+	case M_END:
+	    p->len = CLASS_RUN ;
+	    break ;
+	case M_ACCEPT:
+	    p->len = CLASS_RUN_END ;
+	    break ;
+	}
+    }
+}
+
 /*===================================
 MEMORY	ALLOCATION
  *==============================*/
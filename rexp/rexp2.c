@@ -20,6 +20,11 @@ you agree to not name that product mawk.
 
 #include "rexp.h"
 #include "wait.h"
+#include <ctype.h>
+
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
 
 #define	 STACKGROWTH	16
 
@@ -110,6 +115,13 @@ REtest(const char* str, size_t len, PTR machine)
    if (m->type == M_STR && (m+1)->type == M_ACCEPT) {
       return str_str(s, len, m->data.str, m->len) != (char *) 0 ;
    }
+   else if (m->type == M_ISTR && (m+1)->type == M_ACCEPT) {
+      return str_istr(s, len, m->data.str, m->len) != (char *) 0 ;
+   }
+   else if (m->type == M_LINEAR) {
+      /* would backtrack badly, see rexp4.c */
+      return RE_linear_match(m, str, len, (size_t *) 0, 0, 1) != (char *) 0 ;
+   }
    else
    {
       s = str - 1 ;      /* ^ can be matched  */
@@ -182,8 +194,51 @@ reswitch  :
 	 u_flag = U_OFF ;
 	 goto reswitch ;
 
+      case M_ISTR + U_OFF + END_OFF:
+	if (s > str_end || (size_t)(str_end - s) < m->len || RE_icmp(s, m->data.str, m->len))  {
+	     goto refill ;
+	 }
+	 s += m->len ;	m++ ;
+	 goto reswitch ;
+
+      case M_ISTR + U_OFF + END_ON:
+	 if ((size_t)(str_end - s) != m->len || RE_icmp(s,m->data.str,m->len) != 0) {
+	     goto refill ;
+	 }
+	 s = str_end+1 ;
+	 m++ ;
+	 goto reswitch ;
+
+      case M_ISTR + U_ON + END_OFF:
+	 if (s > str_end) goto refill ;
+         if (s < str) s = str ;
+	 if (!(s = str_istr(s, (size_t)(str_end - s) , m->data.str, m->len)))  goto refill ;
+	 push(m, s + 1, U_ON) ;
+	 s += m->len ; m++ ; u_flag = U_OFF ;
+	 goto reswitch ;
+
+      case M_ISTR + U_ON + END_ON:
+	 if (s > str_end) goto refill ;
+         if (s < str) s = str ;
+	 {
+	     int t = ((size_t)(str_end - s)) - m->len ;
+	     if (t < 0 || RE_icmp(s + t, m->data.str, m->len) != 0) {
+	         goto refill ;
+	     }
+	 }
+	 s = str_end+1 ;
+	 m++ ;
+	 u_flag = U_OFF ;
+	 goto reswitch ;
+
       case M_CLASS + U_OFF + END_OFF:
 	 if (s >= str_end || !ISON(*m->data.bvp, s[0]))	 goto refill ;
+	 if (m->len & CLASS_RUN) {
+	    /* only the end of the run can match, see RE_class_runs() */
+	    s = RE_class_span(m->data.bvp, s + 1, str_end) ;
+	    m += 2 ;
+	    goto reswitch ;
+	 }
 	 s++ ; m++ ;
 	 goto reswitch ;
 
@@ -195,10 +250,14 @@ reswitch  :
 
       case M_CLASS + U_ON + END_OFF:
          if (s < str) s = str ;
-	 while (1) {
-	    if (s >= str_end) goto refill ;
-	    if (ISON(*m->data.bvp,s[0])) break ;
-	    s++ ;
+	 s = RE_class_scan(m->data.bvp, s, str_end) ;
+	 if (s >= str_end) goto refill ;
+	 if (m->len & CLASS_RUN) {
+	    /* a start inside the run ends at the same place */
+	    s = RE_class_span(m->data.bvp, s + 1, str_end) ;
+	    push(m, s, U_ON) ;
+	    m += 2 ; u_flag = U_OFF ;
+	    goto reswitch ;
 	 }
 	 s++ ;
 	 push(m, s, U_ON) ;
@@ -302,6 +361,97 @@ reswitch  :
 
 
 
+/* scanning for class members.
+   With SSSE3 16 characters are tested at once : pshufb looks up the low
+   nibble of each character in the CLASS_BV nibble tables (an index with
+   the top bit set gives 0, which picks the table for the high nibble),
+   and the high nibble selects the bit.
+*/
+
+#ifdef __SSSE3__
+/* bit i is set if x[i] is in the class */
+static unsigned
+class_mask16(const CLASS_BV* cp, __m128i x)
+{
+   const __m128i nib_mask = _mm_set1_epi8(0x8f) ;
+   const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+				      1, 2, 4, 8, 16, 32, 64, -128) ;
+   __m128i t0 = _mm_loadu_si128((const __m128i *) cp->nib[0]) ;
+   __m128i t1 = _mm_loadu_si128((const __m128i *) cp->nib[1]) ;
+   __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), _mm_set1_epi8(0x0f)) ;
+   __m128i r = _mm_or_si128(
+		  _mm_shuffle_epi8(t0, _mm_and_si128(x, nib_mask)),
+		  _mm_shuffle_epi8(t1, _mm_and_si128(
+			_mm_xor_si128(x, _mm_set1_epi8(-128)), nib_mask))) ;
+
+   r = _mm_and_si128(r, _mm_shuffle_epi8(bits, hi)) ;
+   return ~_mm_movemask_epi8(_mm_cmpeq_epi8(r, _mm_setzero_si128())) & 0xffff ;
+}
+#endif
+
+/* first character in [s, s_end) in the class, or s_end */
+const char *
+RE_class_scan(const BV* bvp, const char* s, const char* s_end)
+{
+#ifdef __SSSE3__
+   const CLASS_BV* cp = (const CLASS_BV *) bvp ;
+   while (s_end - s >= 16) {
+      unsigned k = class_mask16(cp, _mm_loadu_si128((const __m128i *) s)) ;
+      if (k) return s + __builtin_ctz(k) ;
+      s += 16 ;
+   }
+#endif
+   while (s < s_end && !ISON(*bvp, s[0])) s++ ;
+   return s ;
+}
+
+/* first character in [s, s_end) not in the class, or s_end */
+const char *
+RE_class_span(const BV* bvp, const char* s, const char* s_end)
+{
+#ifdef __SSSE3__
+   const CLASS_BV* cp = (const CLASS_BV *) bvp ;
+   while (s_end - s >= 16) {
+      unsigned k = class_mask16(cp, _mm_loadu_si128((const __m128i *) s)) ^ 0xffff ;
+      if (k) return s + __builtin_ctz(k) ;
+      s += 16 ;
+   }
+#endif
+   while (s < s_end && ISON(*bvp, s[0])) s++ ;
+   return s ;
+}
+
+/* compare n characters of s to the lower case key, ignoring case,
+   0 if the same */
+int
+RE_icmp(const char* s, const char* key, size_t n)
+{
+   while (n--) {
+      if (tolower(*(const unsigned char *) s) != *(const unsigned char *) key)
+	 return 1 ;
+      s++ ; key++ ;
+   }
+   return 0 ;
+}
+
+/* str_str() ignoring case, key is lower case */
+char *
+str_istr(const char* target, size_t tlen, const char* key, size_t klen)
+{
+   const char* last ;
+   int c ;
+
+   if (klen == 0 || tlen < klen) return (char *) 0 ;
+   c = *(const unsigned char *) key ;
+   last = target + (tlen - klen) ;
+   for (; target <= last; target++) {
+      if (tolower(*(const unsigned char *) target) == c &&
+	  RE_icmp(target + 1, key + 1, klen - 1) == 0)
+	 return (char *) target ;
+   }
+   return (char *) 0 ;
+}
+
 #ifdef	MAWK
 
 char *
@@ -62,6 +62,19 @@ char *REmatch(const char* str, size_t str_len ,
       }
       return ts ;
    }
+   else if (m->type == M_ISTR && (m + 1)->type == M_ACCEPT)
+   {
+      char* ts = str_istr(str,str_len,m->data.str,m->len) ;
+      if (ts) {
+          *lenp = m->len ;
+      }
+      return ts ;
+   }
+   else if (m->type == M_LINEAR)
+   {
+      /* would backtrack badly, see rexp4.c */
+      return RE_linear_match(m, str, str_len, lenp, no_front_match, 0) ;
+   }
 
    s = no_front_match ? str : str-1 ; /* only s == str-1 matches ^ */
    u_flag = U_ON ; cb_e = cb_ss = ss = (char *) 0 ;
@@ -176,6 +189,69 @@ reswitch  :
 	 s = str_end+1 ; m++ ; u_flag = U_OFF ;
 	 goto reswitch ;
 
+      case M_ISTR + U_OFF + END_OFF:
+	 if (s > str_end || str_end - s < m->len || RE_icmp(s, m->data.str, m->len) !=0)  {
+	     goto refill ;
+	 }
+	 if (!ss)
+	 {
+	    if (cb_ss && (s > cb_ss || (s == cb_ss && cb_e == str_end))) {
+	        goto refill ;
+	    }
+	    else  ss = s ;
+	 }
+	 s += m->len ;	m++ ;
+	 goto reswitch ;
+
+      case M_ISTR + U_OFF + END_ON:
+	 if (str_end - s != m->len || RE_icmp(s, m->data.str,m->len) != 0)  {
+	     goto refill ;
+	 }
+	 if (!ss)
+	 {
+	    if (cb_ss && (s > cb_ss || (s == cb_ss && cb_e == str_end))) {
+	        goto refill ;
+	    }
+	    else  ss = s ;
+	 }
+	 s = str_end+1 ;
+	 m++ ;
+	 goto reswitch ;
+
+      case M_ISTR + U_ON + END_OFF:
+	 if (s > str_end) goto refill ;
+	 if (s < str) s = str ;
+	 if (!(s = str_istr(s,str_end - s, m->data.str, m->len)))  goto refill ;
+	 push(m, s + 1, ss, U_ON) ;
+	 if (!ss)
+	 {
+	    if (cb_ss && (s > cb_ss || (s == cb_ss && cb_e == str_end))) {
+	        goto refill ;
+	    }
+	    else  ss = s ;
+	 }
+	 s += m->len ; m++ ; u_flag = U_OFF ;
+	 goto reswitch ;
+
+      case M_ISTR + U_ON + END_ON:
+         if (s > str_end) goto refill ;
+	 if (s < str) s = str ;
+	 {
+	     int t = (str_end - s) - m->len ;
+	     if (t < 0 || RE_icmp(s = s + t, m->data.str, m->len) != 0) {
+	         goto refill ;
+	     }
+	 }
+	 if (!ss)
+	 {
+	    if (cb_ss && (s > cb_ss || (s == cb_ss && cb_e == str_end))) {
+	        goto refill ;
+	    }
+	    else  ss = s ;
+	 }
+	 s = str_end+1 ; m++ ; u_flag = U_OFF ;
+	 goto reswitch ;
+
       case M_CLASS + U_OFF + END_OFF:
 	 if (s >= str_end || !ISON(*m->data.bvp, s[0]))	 goto refill ;
 	 if (!ss)
@@ -185,6 +261,12 @@ reswitch  :
 	    }
 	    else  ss = s ;
 	 }
+	 if (m->len) {
+	    /* only the end of the run can match, see RE_class_runs() */
+	    s = RE_class_span(m->data.bvp, s + 1, str_end) ;
+	    m += 2 ;
+	    goto reswitch ;
+	 }
 	 s++ ; m++ ;
 	 goto reswitch ;
 
@@ -202,10 +284,23 @@ reswitch  :
 
       case M_CLASS + U_ON + END_OFF:
 	 if (s < str) s = str ;
-         while(1) {
-	     if (s >= str_end) goto refill ;
-	     if (ISON(*m->data.bvp, s[0])) break ;
-	     s++ ;
+	 s = RE_class_scan(m->data.bvp, s, str_end) ;
+	 if (s >= str_end) goto refill ;
+	 if (m->len) {
+	    /* a later start inside the run ends at the same place */
+	    const char* e = RE_class_span(m->data.bvp, s + 1, str_end) ;
+	    push(m, e, ss, U_ON) ;
+	    if (!ss)
+	    {
+	       if (cb_ss && (s > cb_ss || (s == cb_ss && cb_e == str_end))) {
+		   goto refill ;
+	       }
+	       else  ss = s ;
+	    }
+	    s = e ;
+	    m += 2 ;
+	    u_flag = U_OFF ;
+	    goto reswitch ;
 	 }
 	 push(m, s+1, ss, U_ON) ;
 	 if (!ss)
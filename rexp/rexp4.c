@@ -0,0 +1,545 @@
+
+/********************************************
+rexp4.c
+
+This is a source file for mawk, an implementation of
+the AWK programming language.
+
+Mawk is distributed without warranty under the terms of
+the GNU General Public License, version 3, 2007.
+
+If you import elements of this code into another product,
+you agree to not name that product mawk.
+********************************************/
+
+
+/*  match a string against a machine in linear time  */
+
+/*
+   REtest() and REmatch() backtrack.  On a machine with a loop whose
+   body can branch, e.g. (a*)*b or (a|aa)*c, the number of paths is
+   exponential in the length of the string and a long record that does
+   not match can take hours.
+
+   RE_linear_match() runs the same machine as a Thompson/Pike
+   simulation:  all the ways the machine can be in are advanced one
+   character at a time, and two ways that reach the same state at the
+   same point in the string are merged.  So the time is bounded by
+   (length of string) * (size of machine).
+
+   A thread is (state, offset into an M_STR or M_ISTR, u_flag) with the start
+   of its match, ss.  When two threads merge the one with the earlier
+   ss is kept (REmatch() wants the leftmost longest match).
+
+   The positions in the string run from -1 to len+1.  Position -1 is
+   the s == str-1 of REtest(), where only ^ can be matched, and
+   position len+1 is the s == str_end+1 after $ has been matched.
+
+   REcompile() marks a machine for this by putting an M_LINEAR state
+   in front of it, see RE_linear().  The len of the M_LINEAR state is
+   the number of states that follow it, and its jump is the number of
+   ( ) groups tagged by REcompile_groups().
+
+   With groups each thread also carries the group boundaries it has
+   passed, cap[].  An M_SAVE passed while the thread can still move
+   on (u_flag on) does not know its position yet, it is CAP_PENDING
+   until the thread takes a character, in the same way as ss.
+*/
+
+#include <ctype.h>
+#include "rexp.h"
+
+int RE_linear_flag ;	/* -W linear, use RE_linear_match() on everything */
+
+#define	 UNSET	  ((ptrdiff_t) PTRDIFF_MAX)    /* ss not set yet */
+#define	 CAP_UNSET    (-1)	/* group not in the match */
+#define	 CAP_PENDING  (-2)	/* position of the next character taken */
+
+typedef struct {
+    int cnt ;
+    int *dense ;	  /* the slots in the list, in order added */
+    int *sparse ;	  /* index of a slot in dense */
+    ptrdiff_t *ss ;	  /* start of match by slot */
+    ptrdiff_t *cap ;	  /* ncap group boundaries by slot */
+} TLIST ;
+
+/* the machine being run */
+static STATE *machine ;
+static STATE *machine_tag ;	/* the M_LINEAR state of machine */
+static int nstates ;
+static int *base ;		/* first slot/2 of each state */
+static int *slot_pc ;		/* inverse of base */
+static int nslots ;
+static int slots_size ;
+static int ncap ;		/* 2 * number of groups */
+static size_t cap_size ;	/* of each TLIST cap */
+static int cap_max ;		/* of cb_cap, tmp_cap */
+
+static TLIST lists[3] ;		/* current position, next, past end */
+#define	 past  (lists+2)
+
+static const char *str ;
+static ptrdiff_t str_len ;
+static Bool test_only ;
+static Bool accepted ;
+static ptrdiff_t cb_ss ;	/* best match so far */
+static ptrdiff_t cb_e ;
+static ptrdiff_t *cb_cap ;
+static ptrdiff_t *tmp_cap ;
+static ptrdiff_t *cap_out ;	/* set by REmatch_groups() */
+
+static void add(TLIST *, int, int, int, ptrdiff_t, ptrdiff_t,
+		const ptrdiff_t *) ;
+
+/* M_STR or M_ISTR, a state with a slot for each character */
+#define	 IS_STR(p)	((p)->type % END_ON == M_STR || (p)->type % END_ON == M_ISTR)
+
+#define	 member(l,x)	((l)->sparse[x] < (l)->cnt && \
+			 (l)->dense[(l)->sparse[x]] == (x))
+
+static void
+tlist_alloc(TLIST * l)
+{
+    l->dense = (int *) RE_realloc(l->dense, slots_size * sizeof(int)) ;
+    l->sparse = (int *) RE_realloc(l->sparse, slots_size * sizeof(int)) ;
+    l->ss = (ptrdiff_t *)
+	RE_realloc(l->ss, slots_size * sizeof(ptrdiff_t)) ;
+    /* sparse can hold anything, but keep valgrind happy */
+    memset(l->sparse, 0, slots_size * sizeof(int)) ;
+}
+
+/* set up base[] and slot_pc[] for m, m points at its M_LINEAR state */
+static void
+load_machine(STATE * m)
+{
+    int i ;
+    int n = 0 ;
+    STATE *p ;
+
+    machine_tag = m ;
+    machine = m + 1 ;
+    nstates = m->len ;
+    ncap = 2 * m->data.jump ;
+
+    base = (int *) RE_realloc(base, (nstates + 1) * sizeof(int)) ;
+    for (i = 0, p = machine; i < nstates; i++, p++) {
+	base[i] = n ;
+	n += IS_STR(p) && p->len > 1 ? p->len : 1 ;
+    }
+    base[nstates] = n ;
+    nslots = 2 * n ;
+
+    slot_pc = (int *) RE_realloc(slot_pc, n * sizeof(int)) ;
+    for (i = 0; i < nstates; i++) {
+	int j ;
+	for (j = base[i]; j < base[i + 1]; j++)
+	    slot_pc[j] = i ;
+    }
+
+    if (nslots > slots_size) {
+	slots_size = nslots ;
+	for (i = 0; i < 3; i++)
+	    tlist_alloc(lists + i) ;
+    }
+    if ((size_t) nslots * ncap > cap_size) {
+	cap_size = (size_t) nslots * ncap ;
+	for (i = 0; i < 3; i++) {
+	    lists[i].cap = (ptrdiff_t *)
+		RE_realloc(lists[i].cap, cap_size * sizeof(ptrdiff_t)) ;
+	}
+    }
+    if (ncap > cap_max) {
+	cap_max = ncap ;
+	cb_cap = (ptrdiff_t *) RE_realloc(cb_cap, ncap * sizeof(ptrdiff_t)) ;
+	tmp_cap = (ptrdiff_t *) RE_realloc(tmp_cap, ncap * sizeof(ptrdiff_t)) ;
+    }
+}
+
+/* cap with the pending boundaries at pos, in tmp_cap */
+static const ptrdiff_t *
+resolve(const ptrdiff_t * cap, ptrdiff_t pos)
+{
+    int i ;
+
+    for (i = 0; i < ncap; i++)
+	tmp_cap[i] = cap[i] == CAP_PENDING ? pos : cap[i] ;
+    return tmp_cap ;
+}
+
+static void
+accept(int u, ptrdiff_t ss, ptrdiff_t pos, const ptrdiff_t * cap)
+{
+    ptrdiff_t s = pos ;
+    ptrdiff_t e ;
+
+    accepted = 1 ;
+    if (test_only)
+	return ;
+
+    if (s > str_len)
+	s = str_len ;
+    else if (s < 0)
+	s = 0 ;
+
+    if (ss == UNSET) {
+	ss = e = s ;
+    }
+    else if (u == U_ON) {
+	e = str_len ;		/* trailing .* */
+    }
+    else
+	e = s ;
+
+    if (cb_ss == UNSET || ss < cb_ss || (ss == cb_ss && e > cb_e)) {
+	cb_ss = ss ;
+	cb_e = e ;
+	if (ncap)
+	    memcpy(cb_cap, resolve(cap, e), ncap * sizeof(ptrdiff_t)) ;
+    }
+}
+
+/* add thread (pc,k,u) with match start ss to list l at position pos,
+   and everything that can be reached from it without moving */
+static void
+add(TLIST * l, int pc, int k, int u, ptrdiff_t ss, ptrdiff_t pos,
+    const ptrdiff_t * cap)
+{
+    int slot = 2 * (base[pc] + k) + (u != U_OFF) ;
+    STATE *p ;
+    ptrdiff_t *t = 0 ;
+
+    if (member(l, slot)) {
+	if (test_only || ss >= l->ss[slot])
+	    return ;
+	/* an earlier start, redo from here */
+    }
+    else {
+	l->sparse[slot] = l->cnt ;
+	l->dense[l->cnt++] = slot ;
+    }
+    l->ss[slot] = ss ;
+    if (ncap) {
+	t = l->cap + (size_t) slot * ncap ;
+	if (t != cap)
+	    memcpy(t, cap, ncap * sizeof(ptrdiff_t)) ;
+	cap = t ;
+    }
+
+    if (k)			/* inside a string */
+	return ;
+
+    p = machine + pc ;
+    switch (p->type) {
+    case M_1J:
+	add(l, pc + p->data.jump, 0, u, ss, pos, cap) ;
+	break ;
+
+    case M_2JA:
+	add(l, pc + 1, 0, u, ss, pos, cap) ;
+	add(l, pc + p->data.jump, 0, u, ss, pos, cap) ;
+	break ;
+
+    case M_2JB:
+	/* loop again first, so groups in a loop are greedy */
+	add(l, pc + p->data.jump, 0, u, ss, pos, cap) ;
+	add(l, pc + 1, 0, u, ss, pos, cap) ;
+	break ;
+
+    case M_WAIT:
+	add(l, pc + 1, 0, u, ss, pos, cap) ;
+	break ;
+
+    case M_SAVE:
+	t[p->data.jump] = u != U_OFF ? CAP_PENDING :
+	    pos < 0 ? 0 : pos > str_len ? str_len : pos ;
+	add(l, pc + 1, 0, u, ss, pos, cap) ;
+	break ;
+
+    case M_U:
+	if (pos < 0)
+	    break ;		/* moved to position 0 by step_start() */
+	if (ss == UNSET)
+	    ss = pos ;
+	add(l, pc + 1, 0, U_ON, ss, pos, ncap ? resolve(cap, pos) : cap) ;
+	break ;
+
+    case M_END:
+	if (pos == str_len) {
+	    add(past, pc + 1, 0, U_OFF, ss == UNSET ? str_len : ss,
+		str_len + 1, ncap ? resolve(cap, str_len) : cap) ;
+	}
+	break ;
+
+    case M_ACCEPT:
+	if (pos >= 0)
+	    accept(u, ss, pos, cap) ;
+	break ;
+
+    default:
+	/* the rest move on a character, or on -1 to 0 */
+	break ;
+    }
+}
+
+/* thread (pc,k) matched the character at pos, or matched to the end */
+static void
+advance(TLIST * next, int pc, int k, ptrdiff_t ss, ptrdiff_t pos,
+	const ptrdiff_t * cap)
+{
+    STATE *p = machine + pc ;
+
+    if (ncap)
+	cap = resolve(cap, pos) ;
+    if (IS_STR(p) && k + 1 < (int) p->len) {
+	add(next, pc, k + 1, U_OFF, ss, pos + 1, cap) ;
+    }
+    else if (p->type < END_ON) {
+	add(next, pc + 1, 0, U_OFF, ss, pos + 1, cap) ;
+    }
+    else if (pos + 1 == str_len) {
+	add(past, pc + 1, 0, U_OFF, ss, str_len + 1, cap) ;
+    }
+}
+
+/* move the threads in cur past the character at pos, into next */
+static void
+step(TLIST * cur, TLIST * next, ptrdiff_t pos)
+{
+    int c = (unsigned char) str[pos] ;
+    int phase ;
+    int i ;
+
+    next->cnt = 0 ;
+    /* phase 0, threads that have started, in order of ss
+       phase 1, threads that start at pos
+       phase 2, threads that may start later
+       keeping next in ss order, so merges keep the leftmost */
+    for (phase = 0; phase < 3; phase++) {
+	for (i = 0; i < cur->cnt; i++) {
+	    int slot = cur->dense[i] ;
+	    ptrdiff_t ss = cur->ss[slot] ;
+	    int u = slot & 1 ? U_ON : U_OFF ;
+	    int pc = slot_pc[slot >> 1] ;
+	    int k = (slot >> 1) - base[pc] ;
+	    STATE *p = machine + pc ;
+	    const ptrdiff_t *cap = ncap ? cur->cap + (size_t) slot * ncap : 0 ;
+	    Bool moved ;
+
+	    if ((ss == UNSET) != (phase > 0))
+		continue ;
+	    if (cb_ss != UNSET) {
+		/* cannot beat the current best */
+		if (ss == UNSET ? pos > cb_ss : ss > cb_ss)
+		    continue ;
+		if (cb_e == str_len && ss == cb_ss)
+		    continue ;
+	    }
+
+	    if (phase < 2) {
+		switch (p->type % END_ON) {
+		case M_STR:
+		    moved = c == (unsigned char) p->data.str[k] ;
+		    break ;
+		case M_ISTR:
+		    moved = tolower(c) == (unsigned char) p->data.str[k] ;
+		    break ;
+		case M_CLASS:
+		    moved = ISON(*p->data.bvp, c) != 0 ;
+		    break ;
+		case M_ANY:
+		    moved = 1 ;
+		    break ;
+		default:
+		    moved = 0 ;
+		    break ;
+		}
+		if (moved)
+		    advance(next, pc, k, ss == UNSET ? pos : ss, pos, cap) ;
+	    }
+
+	    if (u == U_ON && phase != 1) {
+		/* .* in front, can also try at the next position */
+		if (ss == UNSET && cb_ss != UNSET)
+		    continue ;
+		switch (p->type % END_ON) {
+		case M_STR:
+		case M_ISTR:
+		case M_CLASS:
+		case M_ANY:
+		case M_END:
+		    add(next, pc, 0, U_ON, ss, pos + 1, cap) ;
+		    break ;
+		}
+	    }
+	}
+    }
+}
+
+/* from position -1 to 0, only ^ moves */
+static void
+step_start(TLIST * cur, TLIST * next)
+{
+    int i ;
+    int phase ;
+
+    next->cnt = 0 ;
+    for (phase = 0; phase < 2; phase++) {
+	for (i = 0; i < cur->cnt; i++) {
+	    int slot = cur->dense[i] ;
+	    int pc = slot_pc[slot >> 1] ;
+	    STATE *p = machine + pc ;
+	    const ptrdiff_t *cap = ncap ? cur->cap + (size_t) slot * ncap : 0 ;
+
+	    if (p->type % END_ON == M_START) {
+		if (phase == 0) {
+		    if (ncap)
+			cap = resolve(cap, 0) ;
+		    if (p->type < END_ON)
+			add(next, pc + 1, 0, U_OFF, 0, 0, cap) ;
+		    else if (str_len == 0)
+			add(past, pc + 1, 0, U_OFF, 0, 1, cap) ;
+		}
+	    }
+	    else if (phase == 1) {
+		add(next, pc, 0, slot & 1 ? U_ON : U_OFF,
+		    cur->ss[slot], 0, cap) ;
+	    }
+	}
+    }
+}
+
+/* m points at an M_LINEAR state.
+   Same returns as REmatch(), if test is on, returns non-null
+   for a match and *lenp is not set
+*/
+char *
+RE_linear_match(STATE * m, const char *s, size_t len,
+		size_t *lenp, Bool no_front_match, Bool test)
+{
+    TLIST *cur = lists ;
+    TLIST *next = lists + 1 ;
+    ptrdiff_t pos ;
+
+    if (m != machine_tag)
+	load_machine(m) ;
+
+    str = s ;
+    str_len = (ptrdiff_t) len ;
+    test_only = test ;
+    accepted = 0 ;
+    cb_ss = cb_e = UNSET ;
+    cur->cnt = next->cnt = past->cnt = 0 ;
+    if (ncap) {
+	int i ;
+	for (i = 0; i < ncap; i++)
+	    tmp_cap[i] = CAP_UNSET ;
+    }
+
+    if (no_front_match) {
+	add(cur, 0, 0, U_ON, UNSET, 0, tmp_cap) ;
+    }
+    else {
+	add(cur, 0, 0, U_ON, UNSET, -1, tmp_cap) ;
+	step_start(cur, next) ;
+	cur = lists + 1 ;
+	next = lists ;
+    }
+
+    for (pos = 0; pos < str_len; pos++) {
+	if (accepted && test_only)
+	    break ;
+	if (cur->cnt == 0)
+	    break ;
+	step(cur, next, pos) ;
+	{
+	    TLIST *t = cur ;
+	    cur = next ;
+	    next = t ;
+	}
+    }
+
+    if (test_only)
+	return accepted ? (char *) s : (char *) 0 ;
+
+    if (cb_ss == UNSET) {
+	*lenp = 0 ;
+	return (char *) 0 ;
+    }
+    *lenp = cb_e - cb_ss ;
+    if (cap_out)
+	memcpy(cap_out, cb_cap, ncap * sizeof(ptrdiff_t)) ;
+    return (char *) s + cb_ss ;
+}
+
+/* number of ( ) groups in a machine from REcompile_groups() */
+int
+REgroups(PTR machine)
+{
+    STATE *m = (STATE *) machine ;
+
+    return m->type == M_LINEAR ? m->data.jump : 0 ;
+}
+
+/* REmatch() on a machine from REcompile_groups() that also sets
+   gv[2*i] and gv[2*i+1] to the start and end of group i+1 in str,
+   or to -1 if the group is not part of the match.
+   gv has room for 2 * REgroups(machine).
+*/
+char *
+REmatch_groups(const char *s, size_t len, PTR machine,
+	       size_t *lenp, ptrdiff_t * gv)
+{
+    STATE *m = (STATE *) machine ;
+    char *ret ;
+
+    if (REgroups(machine) == 0)
+	return REmatch(s, len, machine, lenp, 0) ;
+    cap_out = gv ;
+    ret = RE_linear_match(m, s, len, lenp, 0, 0) ;
+    cap_out = 0 ;
+    return ret ;
+}
+
+/* does m have a loop with a branch inside it, (a*)* or (a|aa)* */
+static Bool
+has_nested_loop(STATE * m, int size)
+{
+    int i ;
+
+    for (i = 0; i < size; i++) {
+	if (m[i].type == M_2JB && m[i].data.jump < 0) {
+	    int j ;
+	    for (j = i + m[i].data.jump; j < i; j++) {
+		if (m[j].type == M_2JA || m[j].type == M_2JB)
+		    return 1 ;
+	    }
+	}
+    }
+    return 0 ;
+}
+
+/* called by REcompile() on a new machine.  If the machine needs it
+   (or -W linear) put an M_LINEAR in front of it.  Plain strings
+   and the empty machine are left alone, they cannot backtrack.
+   A machine with ngroups tagged groups always gets one, only
+   RE_linear_match() keeps the group boundaries. */
+STATE *
+RE_linear(STATE * m, int ngroups)
+{
+    int size ;
+
+    if (m->type == M_ACCEPT ||
+	(m->type == M_STR && m[1].type == M_ACCEPT)) {
+	return m ;
+    }
+
+    size = RE_machine_size(m) ;
+    if (ngroups || RE_linear_flag || has_nested_loop(m, size)) {
+	m = (STATE *) RE_realloc(m, (size + 1) * STATESZ) ;
+	memmove(m + 1, m, size * STATESZ) ;
+	m->type = M_LINEAR ;
+	m->len = size ;
+	m->data.jump = ngroups ;
+    }
+    return m ;
+}
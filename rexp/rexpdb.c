@@ -31,7 +31,10 @@ static  const char *xlat[] = {
 "M_2JA" ,
 "M_2JB" ,
 "M_WAIT",
-"M_ACCEPT" } ;
+"M_ACCEPT" ,
+"M_LINEAR" ,
+"M_ISTR" ,
+"M_SAVE" } ;
 
 /* print string visibly */
 static
@@ -77,7 +80,8 @@ void  REmprint(void* m, FILE* f)
     fprintf(f, "%-10s" , xlat[p->type]) ;
     switch( p->type )
     {
-     case M_STR : visible_string(f,p->data.str,p->len) ;
+     case M_STR :
+     case M_ISTR : visible_string(f,p->data.str,p->len) ;
                   break ;
 
      case M_2JA:
@@ -87,6 +91,7 @@ void  REmprint(void* m, FILE* f)
 	 }
 	 /* fall thru */
      case M_1J:
+     case M_SAVE:
      case M_2JB : fprintf(f, "%d", p->data.jump) ;
                  break ;
      case M_CLASS:
@@ -25,6 +25,7 @@ you agree to not name that product mawk.
 #include  "fin.h"
 #include  "repl.h"
 #include  "code.h"
+#include  "bi_vars.h"
 #include "config.h"
 
 #include  <fcntl.h>
@@ -694,6 +695,14 @@ reswitch:
 		     current_token == DOLLAR ? D_ID : ID ;
 		  break ;
 
+	       case ST_PROCINFO:
+		  stp->type = ST_ARRAY ;
+		  stp->stval.array = procinfo = new_ARRAY() ;
+		  yylval.stp = stp ;
+		  current_token =
+		     current_token == DOLLAR ? D_ID : ID ;
+		  break ;
+
 	       case ST_FUNCT:
 		  yylval.fbp = stp->stval.fbp ;
 		  current_token = FUNCT_ID ;
@@ -22,6 +22,7 @@ you agree to not name that product mawk.
 
 
 #define EVAL_STACK_SIZE  256	/* initial size , can grow */
+#define MAX_CATN  32	/* most operands of one catn, see parse.y code_cat() */
 
 /*
  * FBANK_SZ, the number of fields at startup, must be a power of 2.
@@ -45,6 +46,10 @@ you agree to not name that product mawk.
 
 #define  HASH_PRIME  113
 
+#define  RULE_SCAN_MIN  4  /* main rule patterns that are plain strings are
+			      merged into one scan of $0 if there are at least
+			      this many of them (see re_cmpl.c) */
+
 #define  MAX_COMPILE_ERRORS  5	/* quit if more than 4 errors */
 
 #endif /* SIZES_H */
@@ -204,14 +204,15 @@ null_split(const char *s, size_t slen)
 }
 
 /* The caller knows there are cnt STRING* in the split_block_list
- * buffers.  This function uses them to make CELLs in cp[]
+ * buffers.  This function uses them to make cnt CELLs starting
+ * at cp, with stride bytes from one CELL to the next.
  * The target CELLs are virgin, they don't need to be
  * destroyed
  *
  */
 
 void
-transfer_to_array(CELL cp[], size_t cnt)
+transfer_to_array(CELL *cp, size_t cnt, size_t stride)
 {
     Split_Block_Node *node_p = split_block_list;
     unsigned idx = 0;
@@ -219,7 +220,7 @@ transfer_to_array(CELL cp[], size_t cnt)
 	cp->type = C_MBSTRN;
 	cp->ptr = (PTR) node_p->strings[idx];
 	cnt--;
-	cp++;
+	cp = (CELL *) ((char *) cp + stride);
 	if (++idx == SP_SIZE) {
 	    idx = 0;
 	    node_p = node_p->link;
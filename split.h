@@ -24,7 +24,7 @@ you agree to not name that product mawk.
 
    The caller next imediately calls
         transfer_to_fields(size_t)   or
-	transfer_to_array(CELL[],size_t)
+	transfer_to_array(CELL*,size_t,size_t)
 
    to get the pieces out of the anonymous private buffer
 
@@ -43,6 +43,6 @@ size_t re_split(const char *str, size_t len, PTR re);
 
 /* the two transfer functions  */
 void transfer_to_fields(size_t cnt);
-void transfer_to_array(CELL[], size_t cnt);
+void transfer_to_array(CELL *, size_t cnt, size_t stride);
 
 #endif /* SPLIT_H */
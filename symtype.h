@@ -43,6 +43,14 @@ int start ; /* offset to code_base */
 int cnt ;
 } ARG2_REC ;
 
+/* for parsing  a b c , a chain of concatenations */
+typedef  struct {
+int start ; /* offset to code_base */
+int second ; /* where b starts */
+int end ;  /* and where the chain ends */
+int cnt ;  /* number of operands */
+} CAT_REC ;
+
 /*------------------------
   user defined functions
   ------------------------*/
@@ -70,7 +78,7 @@ void   fdump(void) ;
 #define  ST_FUNCT   6
 #define  ST_NR      7  /*  NR is special */
 #define  ST_ENV     8  /* and so is ENVIRON */
-#define  ST_UNUSED  9  
+#define  ST_PROCINFO 9 /* and PROCINFO */
 #define  ST_LOCAL_NONE  10
 #define  ST_LOCAL_VAR   11
 #define  ST_LOCAL_ARRAY 12
@@ -138,6 +146,7 @@ void  check_fcall(FBLOCK*,int,int,FBLOCK*,CA_REC*,unsigned) ;
 void   relocate_resolve_list(int,int,FBLOCK*,int,unsigned,int) ;
 
 /* hash.c */
+uint64_t   hash64(const char*,size_t) ;
 unsigned   hash(const char *) ;
 unsigned   hash2(const char*,size_t) ;
 SYMTAB * insert(const char *) ;
@@ -0,0 +1,102 @@
+# arrays: keys, dense arrays, SUBSEP keys, delete in a loop, sorted loops,
+# asort() and asorti()
+
+function show(A, how,    k, s) {
+    PROCINFO["sorted_in"] = how
+    s = ""
+    for (k in A) s = s " " k "=" A[k]
+    PROCINFO["sorted_in"] = "@unsorted"
+    print how ":" s
+}
+
+function keys(A,    k, n, s) {
+    n = asorti(A, K)
+    s = ""
+    for (k = 1; k <= n; k++) s = s " " K[k]
+    return n ":" s
+}
+
+BEGIN {
+    # short keys with NUL bytes are kept inline in the node
+    z = sprintf("%c", 0)
+    A["a" z "b"] = 1 ; A["a" z "c"] = 2 ; A["a"] = 3 ; A[z] = 4 ; A[z z] = 5
+    A["abcdefg"] = 6 ; A["abcdefgh"] = 7 ; A["abcdefg" z] = 8
+    print length(A), A["a" z "b"], A["a" z "c"], A["a"], A[z], A[z z]
+    print A["abcdefg"], A["abcdefgh"], A["abcdefg" z], (("a" z) in A)
+    n = 0
+    for (k in A) if (index(k, z)) n++
+    print "keys with NUL", n
+    delete A
+
+    # integer and string keys are the same element
+    B[1] = "one" ; B["2"] = "two" ; B[3.0] = "three" ; B[-4] = "minus four"
+    print B["1"], B[2], B["3"], B["-4"], (("01") in B), (1.5 in B)
+    B["01"] = "oh one" ; B[1.5] = "one and a half" ; B[2^53] = "big"
+    print B[1], B["01"], B["1.5"], B[9007199254740992], length(B)
+    CONVFMT = "%.2g" ; x = 0.1 ; B[x] = "tenth" ; CONVFMT = "%.6g"
+    print B["0.1"], ("0.1" in B), length(B)
+    for (i = 1; i <= 1000; i++) C[i] = i          # dense
+    C["x"] = "x" ; C[2000] = 2000                 # then not
+    print length(C), C[500], C["500"], C["x"], C[2000], (1001 in C)
+    delete C[500] ; print length(C), (500 in C), C[499] + C[501]
+
+    # SUBSEP keys
+    D[1, 2] = "a" ; D["x", "y", "z"] = "b"
+    print ((1, 2) in D), (("1" SUBSEP "2") in D), D["x" SUBSEP "y" SUBSEP "z"]
+    SUBSEP = ":"
+    D[3, 4] = "c"
+    print (("3:4") in D), ((1, 2) in D), D["3:4"]
+    for (k in D) { split(k, P, SUBSEP) ; if (P[1] == 3) print "split", P[2] }
+    SUBSEP = "\034"
+
+    # delete in a for-in loop: each key present at the start is seen once
+    for (i = 0; i < 200; i++) E["k" i] = i
+    n = 0
+    for (k in E) {
+        if (k in S) print "twice", k
+        S[k] = 1 ; n++
+        delete E[k]
+        if (n == 10) for (j = 100; j < 200; j++) delete E["k" j]
+    }
+    print "delete in loop", n, length(E), length(S)
+    for (i = 0; i < 1000; i++) F[i] = i
+    n = 0
+    for (k in F) { n++ ; delete F }
+    print "delete all in loop", n, length(F)
+
+    # every sorted_in order, on data with no ties
+    G["b"] = 11 ; G["a"] = "x" ; G[10] = 2 ; G[9] = "10" ; G["c"] = -1
+    G["d"] = "" ; G[-1] = 2.5
+    show(G, "@ind_str_asc") ; show(G, "@ind_str_desc")
+    show(G, "@val_str_asc") ; show(G, "@val_str_desc")
+    show(G, "@val_type_asc") ; show(G, "@val_type_desc")
+    N[10] = 2 ; N[9] = "10" ; N[-1] = 2.5 ; N["3x"] = "-7" ; N["0.5"] = "abc"
+    show(N, "@ind_num_asc") ; show(N, "@ind_num_desc")
+    show(N, "@val_num_asc") ; show(N, "@val_num_desc")
+    n = 0
+    for (k in G) n++
+    print "@unsorted", n
+
+    # asort and asorti
+    n = asort(G, H)
+    s = "" ; for (i = 1; i <= n; i++) s = s " " H[i]
+    print "asort", n ":" s
+    n = asort(G, H, "@val_str_desc")
+    s = "" ; for (i = 1; i <= n; i++) s = s " " H[i]
+    print "asort desc", n ":" s
+    print "asorti", keys(G)
+    n = asorti(N, H, "@ind_num_asc")
+    s = "" ; for (i = 1; i <= n; i++) s = s " " H[i]
+    print "asorti num", n ":" s
+    split("pear apple fig 10 9 banana", I)
+    n = asort(I)
+    print "asort(A)", n, I[1], I[2], I[3], I[4], I[5], I[6]
+    split("pear apple fig", I)
+    n = asort(I, I)
+    print "asort(A, A)", n, I[1], I[2], I[3], length(I)
+    split("pear apple fig", I)
+    n = asorti(I, I)
+    print "asorti(A, A)", n, I[1], I[2], I[3], length(I)
+    delete J
+    print "empty", asort(J), asorti(J, H), length(H)
+}
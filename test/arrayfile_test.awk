@@ -0,0 +1,66 @@
+# writea() and reada(): a round trip, then files that are not array files
+
+BEGIN {
+    f = "arrayfile.tmp" ; bad = "arraybad.tmp"
+    z = sprintf("%c", 0)
+    for (i = 0; i < 5000; i++) A["key" i] = i
+    A["a" z "b"] = "nul" ; A[""] = "empty key" ; A["x"] = ""
+    A["strnum"] = "3.0" ; A[1.5] = 0.1 ; A[-7] = "minus" ; A["y"] = 1e300
+    print "writea", writea(f, A)
+    print "reada", reada(f, B), length(B), length(A)
+    n = 0
+    for (k in A) if (!(k in B) || B[k] != A[k]) { print "differs", k ; n++ }
+    print "checked", n
+    print B["a" z "b"], B[""], "[" B["x"] "]", B["strnum"] + 1, B["strnum"]
+    print B[1.5], B["-7"], B["y"], ("nokey" in B), length(B)
+
+    # elements looked up in a mapped array can be changed and added to
+    print "reada", reada(f, C), C["key42"]
+    C["key42"] = "changed" ; C["new"] = 1 ; delete C["key43"]
+    print C["key42"], C["new"], ("key43" in C), length(C)
+    print "unchanged", reada(f, C), C["key42"], ("new" in C), length(C)
+
+    # new keys are counted, and kept when the rest of the file is loaded
+    print "reada", reada(f, C), length(C)
+    x = C["nokey1"] ; C["nokey2"] = 2 ; C["key7"] = "seven"
+    print length(C), ("nokey1" in C), C["nokey2"], C["key7"]
+    n = 0
+    for (k in C) n++
+    print "loaded", n, length(C), C["nokey2"], C["key7"], C["key8"]
+
+    # an empty array, and writing to a file that cannot be opened
+    delete E
+    print "empty", writea(f, E), reada(f, C), length(C)
+    print "no dir", writea("no/such/dir/file", A)
+
+    # not array files: missing, text, truncated, a bad header
+    print "missing", reada("no/such/file", C), length(C)
+    print "some text" > bad ; close(bad)
+    print "text", reada(bad, C)
+    writea(f, A)
+    RS = "no such separator" z
+    getline s < f ; close(f)
+    printf "%s", substr(s, 1, 100) > bad ; close(bad)
+    print "truncated", reada(bad, C)
+    printf "wmawk2A%sXXXX%s", z, substr(s, 13) > bad ; close(bad)
+    print "bad order", reada(bad, C)
+    printf "wmawk2B%s%s", z, substr(s, 9) > bad ; close(bad)
+    print "bad magic", reada(bad, C)
+    print "still", reada(f, C), length(C), C["key4999"]
+
+    # rewriting the file does not change an array mapped from it
+    M["key4999"] = "rewritten"
+    writea(f, M)
+    print "mapped", length(C), C["key4999"], C["key17"]
+
+    # a record whose value has a type that no element can have.  reada()
+    # only checks the header, so the error comes when the element is
+    # used, which mawktest and wmawk2test.bat try
+    delete M ; M["badtype"] = 1
+    writea(f, M)
+    getline s < f ; close(f)
+    p = index(s, "badtype") - 8    # the type of its record, 5 is C_RE
+    printf "%s%c%s", substr(s, 1, p - 1), 5, substr(s, p + 1) > bad
+    close(bad)
+    print "bad type", reada(bad, C), length(C)
+}
@@ -0,0 +1,49 @@
+# run with and without -W memory=1, the output must be the same
+# whether or not the big arrays are written to disk
+
+BEGIN {
+    for (i = 0; i < 60000; i++) {
+        k = "key" (i * 7919 % 60000)
+        A[k] = A[k] i " "
+        B[i % 20000, "g"] += i
+    }
+    n = s = 0
+    for (k in A) { n++ ; s += length(A[k]) }
+    print "A", length(A), n, s
+    n = s = 0
+    for (k in B) { n++ ; split(k, P, SUBSEP) ; s += P[1] * B[k] % 1000 }
+    print "B", length(B), n, s
+    print A["key1"], A["key59999"], (("key60000") in A), B[19999, "g"]
+
+    # delete during a loop, the first of each pair seen deletes the other
+    n = 0
+    for (k in A) {
+        n++
+        j = substr(k, 4) + 0
+        delete A["key" (j % 2 ? j - 1 : j + 1)]
+    }
+    print "deleted", n, length(A)
+
+    # keys added in a loop are not visited, delete A ends nothing
+    for (i = 0; i < 60000; i++) A["key" i] = i
+    n = 0
+    for (k in A) { n++ ; if (n % 3 == 0) A["new" n] = 1 }
+    print "added", n, length(A)
+    n = 0
+    for (k in A) { if (++n == 10) delete A }
+    print "delete A", n, length(A)
+
+    # sorted loops and asort
+    for (i = 0; i < 40000; i++) C[sprintf("%06d", (i * 7) % 40000)] = i
+    PROCINFO["sorted_in"] = "@ind_str_desc"
+    n = 0
+    for (k in C) { if (n++ < 3) print k, C[k] }
+    PROCINFO["sorted_in"] = "@val_num_asc"
+    n = 0
+    for (k in C) { if (n++ < 3) print k, C[k] }
+    PROCINFO["sorted_in"] = "@unsorted"
+    n = asort(C, D)
+    print "asort", n, D[1], D[n], D[20000]
+    delete C
+    print length(C), length(D)
+}
@@ -0,0 +1,50 @@
+# numbers in fields and strings:  a field is tested once per record,
+# and the same text in later records gives the same answer
+
+{
+    for (i = 1; i <= NF; i++)
+	if ($i == $i + 0) { nums++ ; sum += $i ; if ($i > max) max = $i }
+	else strs++
+    if ($1 > 0) pos++
+    if (NF >= 2) { old = $2 ; $2 = NR ; if ($2 == NR && $2 + 0 == NR) asg++ ; $2 = old }
+}
+
+END {
+    print NR, nums, strs, sum, max, pos, asg
+
+    # split() elements, getline var and the same text in new cells
+    n = split("12 12.0 0x1A 1e3 -5 +5 .5 5. abc 1x ' 7 '", A)
+    for (i = 1; i <= n; i++) printf "%s:%d%d%s ", A[i], (A[i] == A[i] + 0), \
+	(A[i] < 10), A[i] + 1
+    print ""
+    print (A[1] == A[2]), (A[1] "" == A[2]), (A[5] < A[6]), (A[7] == 0.5)
+
+    # records made from the same few texts
+    t = c = 0 ; m = -1
+    for (r = 0; r < 3000; r++) {
+	$0 = (r % 7) " " (r % 3 ? "x" : r % 11 ".5") " " (r % 5) "e1"
+	if ($2 > 0) c++
+	t += $1 + $2 + $3 ; if ($3 > m) m = $3
+	if ($1 < $3) c++
+    }
+    print t, c, m, $0
+    for (k = 0; k < 3; k++) {
+	split("3 10 x", B)
+	print (B[1] < B[2]), (B[2] < B[3]), B[1] + B[2]
+    }
+
+    # numbers to strings as CONVFMT changes
+    x = 3.14159265 ; y = 1 / 3 ; z = 1e6 ; w = -17
+    for (k = 0; k < 2; k++) {
+	CONVFMT = "%.6g" ; a = x "" ; b = y "" ; C[x] ; C[w]
+	CONVFMT = "%.2f" ; a = a " " x ; b = b " " y ; C[x] ; C[w]
+	e = "%.2" ; CONVFMT = e "e" ; a = a " " x ; C[x]
+	CONVFMT = "%.0f" ; a = a " " x " " z " " w
+	print a, "|", b
+    }
+    CONVFMT = "%.6g"
+    n = 0 ; for (k in C) n++ ; print n, (3.14 in C), ("-17" in C), ("3.14e+00" in C)
+    for (k = 0; k < 10; k++) { D[k / 4] ; D[k * 1e6] }
+    n = 0 ; for (k in D) n++ ; print n, ("0.25" in D), ("2.25" in D), ("9000000" in D)
+    OFMT = "%.1f" ; print x, x "" ; OFMT = "%.6g"
+}
@@ -0,0 +1,20 @@
+# $0 from record to record:  the last record kept by variables,
+# arrays and fields is not changed by the next one
+
+{
+    if (NR > 1 && prev != L[last]) print "changed", NR
+    L[NR] = $0 ; prev = $0 ; last = NR
+    if (NR % 10 == 0) { sub(/./, "#") ; S[NR] = $0 }
+    if (NR % 15 == 0) { $2 = "<" $2 ">" ; S[NR] = $0 }
+    if (NR % 21 == 0 && (getline) > 0) G[NR] = $0 "|" prev
+    if (NF) { k = substr($0, 1, 3) substr(prev, 2, 2) ; kept = $0 ; f1 = $1 }
+}
+
+END {
+    n = 0
+    for (i = 1; i <= NR; i++) if (i in L) { n++ ; h = h length(L[i]) "," }
+    print n, h
+    for (i = 10; i <= NR; i += 5) if (i in S) print i, S[i]
+    for (i = 1; i <= NR; i++) if (i in G) print i, G[i]
+    print kept, "|", f1, "|", k
+}
@@ -0,0 +1,13 @@
+# regular expressions with a repeat inside a repeat, a backtracking
+# matcher takes exponential time to fail on these, long runs of
+# a class, and (?i) to ignore case
+END {
+    while (length(s) < 5000) s = s "a"
+    print (s ~ /(a*)*b/), (s ~ /(a|aa)*c/), (s ~ /^([a-z]+)+$/)
+    print match(s, /(a|aa)*$/), RLENGTH
+    t = s "123,xyz"
+    print match(t, /[a-z]+[0-9]+,/), RLENGTH, gsub(/[^,]*,/, "", t), t
+    t = "An ERROR, then Error 42"
+    print match(t, /(?i)err[a-z]r/), RLENGTH, gsub(/(?i)[^a-z ]+/, "", t), t
+    print match("key=42;", /([a-z]+)=([0-9]+)/, A), A[0], A[1], A[2], A[2, "start"], A[2, "length"], (3 in A)
+}
@@ -0,0 +1,22 @@
+# several main rules with plain string patterns are tested with one
+# scan of $0, check they still fire in rule order, see each other's
+# changes to $0, and mix with ranges, next and other patterns
+
+/include/	{ n["include"]++ ; print NR ": include" }
+/define/	{ n["define"]++ ; print NR ": define" }
+/ine/		{ n["ine"]++ }
+/struct/	{ n["struct"]++ ; $0 = $0 " [changed]" ; print NR ": struct" }
+/changed/	{ n["changed"]++ ; print NR ": changed" }
+/hash/, /}/	{ n["range"]++ }
+/ANODE/		{ n["ANODE"]++ ; print NR ": ANODE" ; next }
+/node/		{ n["node"]++ ; print NR ": node" }
+/[Dd]elet/	{ n["delet"]++ }
+/e/		{ n["e"]++ }
+/\./		{ n["dot"]++ }
+!/a/		{ n["no a"]++ }
+
+END {
+    split("include define ine struct changed range ANODE node delet e dot", K)
+    K[12] = "no a"
+    for (i = 1; i <= 12; i++) print K[i], n[K[i]]
+}
@@ -0,0 +1,126 @@
+# string building:  v = v x ...  appends to v in place
+
+function local_append(n,    s, i) {
+    for (i = 1; i <= n; i++) s = s i ","
+    return s
+}
+
+function change_global() { g = "changed" ; return "x" }
+
+BEGIN {
+    # the old value of v is still shared by other variables and arrays
+    s = "ab" ; t = s ; A[1] = s
+    s = s "c" ; s = s "d" "e"
+    print s, t, A[1]
+    t = t t ; print s, t
+
+    # many appends, and appending numbers
+    u = "" ; for (i = 0; i < 1000; i++) u = u (i % 10)
+    print length(u), substr(u, 991)
+    n = 1 ; n = n 2 3.5 ; print n, n + 1
+    print local_append(5)
+
+    # sprintf() and substr() appended in place
+    s = "" ; for (i = 1; i <= 5; i++) s = s sprintf("%02d.", i) ; print s
+    s = "" ; for (i = 0; i < 10000; i++) s = s substr("0123456789", i % 10 + 1, 1)
+    print length(s), substr(s, 9991)
+    s = "abc" ; s = s substr(s, 2) substr("xyz", 1, 2) sprintf("%s", s) ; print s
+
+    # x changes v:  v is read after x
+    g = "g" ; g = g change_global() ; print g
+    h = "h" ; h = h (h = "H") ; print h
+    k = "k" ; k = k sub(/k/, "K", k) ; print k
+    m = "mm" ; m = m gsub(/m/, "M", m) m ; print m
+    l = "l" ; l = l (getline l < ARGV[1]) (getline l < ARGV[1]) l
+    close(ARGV[1]) ; print l
+
+    # builtins that set builtin variables
+    RSTART = RSTART match("xab", /a/) ; print RSTART
+    RLENGTH = RLENGTH match("xaab", /a+/) ; print RLENGTH
+    SUBSEP = SUBSEP "x" ; print length(SUBSEP)
+}
+
+# longer chains than the eval stack holds
+BEGIN {
+    a = "a" ; b = "bb" ; c = 3 ; d = "dd" ; e = 5
+    s = a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e
+    t = "" ; for (i = 0; i < 60; i++) t = t a b c d e
+    print length(s), s == t
+    u = "<" ; u = u a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e \
+	a b c d e a b c d e a b c d e a b c d e
+    print length(u), u == "<" t
+}
+
+# strings of up to 7 characters are shared
+BEGIN {
+    split("ab cd ab 12 ab 12.0 1x", P)
+    x = P[1] ; x = x "!" ; y = substr(P[3], 1, 1) ; sub(/b/, "B", P[5])
+    print x, P[1], P[3], y, P[5], toupper(P[3]), P[3]
+    print P[4] + 1, P[4] == P[6], P[4] "" == P[6], P[7] + 0, (P[7] < 2)
+    # many different short strings, and the same ones again
+    for (i = 0; i < 40000; i++) K[i] = sprintf("k%d", i % 30000)
+    n = 0
+    for (i = 0; i < 40000; i++) if (K[i] != "k" (i % 30000)) n++
+    print "short", n, K[39999], length(K)
+}
+
+# substr() used by cat and print is a slice of its argument
+BEGIN {
+    r = "2024-10-19 12:34:56 GET /index.html 200"
+    print substr(r, 1, 4), substr(r, 6, 2), substr(r, 9), substr(r, 100)
+    d = substr(r, 9, 2) "/" substr(r, 6, 2) "/" substr(r, 1, 4) ; print d
+    print (substr(r, 12, 2) substr(r, 15, 2) > 1200), length(substr(r, 21))
+    x = "abcdef" ; print substr(x, 2, 3) (x = "zzz"), x
+    print substr(toupper(r), 21, 3) "-" substr(sprintf("%05d", 42), 2)
+    print (r ~ /GET/ ? substr(r, 21, 3) : "no") "|" (0 ? "no" : substr(r, 25, 6))
+    s = "" ; for (i = 1; i <= length(r); i += 5) s = s substr(r, i, 2) ; print s
+    t = substr(r, 1, 1) substr(r, 2, 1) substr(r, 3, 1) substr(r, 4, 1) \
+	substr(r, 5, 1) substr(r, 6, 1) substr(r, 7, 1) substr(r, 8, 1) \
+	substr(r, 9, 1) substr(r, 10, 1) substr(r, 11, 1) substr(r, 12, 1) \
+	substr(r, 13, 1) substr(r, 14, 1) substr(r, 15, 1) substr(r, 16, 1) \
+	substr(r, 17, 1) substr(r, 18, 1) substr(r, 19, 1) substr(r, 20, 1) \
+	substr(r, 21, 1) substr(r, 22, 1) substr(r, 23, 1) substr(r, 24, 1) \
+	substr(r, 25, 1) substr(r, 26, 1) substr(r, 27, 1) substr(r, 28, 1) \
+	substr(r, 29, 1) substr(r, 30, 1) substr(r, 31, 1) substr(r, 32, 1) \
+	substr(r, 33, 1) substr(r, 34, 3) substr(r, 37)
+    print (t == r), t
+    printf "%s %s\n", substr(r, 1, 4), substr(r, 21, 3)
+    print(substr(r, 1, 4), substr(r, 21, 3))
+    A[substr(r, 1, 4)] = substr(r, 6, 2) ; for (k in A) print k, A[k]
+    # a temporary is cut down in place, a variable is not
+    u = toupper(r) ; v = substr(toupper(r), 3) ; w = substr(u, 3)
+    z = substr(r "", 2) ; q = substr(r, 1)
+    print v ; print w ; print u ; print z ; print (q == r), length(v z)
+}
+
+NR == 1 { NR = NR (getline) ; print NR }
+FNR == 3 { FNR = FNR (getline) ; print FNR }
+NR == 12 { NF = NF (getline) ; print NF }
+END { w = "end" ; w = w NR ; print w }
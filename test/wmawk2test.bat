@@ -47,6 +47,8 @@ if not %errorlevel% == 0 goto error2
 if not %errorlevel% == 0 goto error2
 %1 -f reg3.awk mawktest.dat >> temp.out
 if not %errorlevel% == 0 goto error2
+%1 -f reg4.awk mawktest.dat >> temp.out
+if not %errorlevel% == 0 goto error2
 comp temp.out reg-awk.out /m >NUL
 if not %errorlevel% == 0 goto error2
 echo  regular expression matching OK
@@ -165,6 +167,80 @@ if not %errorlevel% == 0 goto error13
 echo  test of misc functions not already tested passed
 echo.
 
+echo testing arrays
+%1 -f array_test.awk >temp.out
+if not %errorlevel% == 0 goto error14
+comp temp.out array_test.out /m >NUL
+if not %errorlevel% == 0 goto error14
+rem an unknown order is an error
+%1 "BEGIN{A[1]; asort(A, B, \"@bad\")}" 2>NUL
+if %errorlevel% == 0 goto error14
+echo  arrays test passed
+echo.
+
+echo testing arrays written to disk by -W memory
+rem the output must not change when arrays are written to disk
+%1 -f memory_test.awk >temp.out
+if not %errorlevel% == 0 goto error15
+comp temp.out memory_test.out /m >NUL
+if not %errorlevel% == 0 goto error15
+%1 -W memory=1 -f memory_test.awk >temp.out
+if not %errorlevel% == 0 goto error15
+comp temp.out memory_test.out /m >NUL
+if not %errorlevel% == 0 goto error15
+rem nor when memory use is reported on stderr
+%1 -W MEMSTATS -f memory_test.awk >temp.out 2>NUL
+if not %errorlevel% == 0 goto error15
+comp temp.out memory_test.out /m >NUL
+if not %errorlevel% == 0 goto error15
+echo  arrays written to disk by -W memory test passed
+echo.
+
+echo testing array files
+%1 -f arrayfile_test.awk >temp.out
+if not %errorlevel% == 0 goto error16
+rem the element with a bad type is an error when it is used
+%1 "BEGIN{reada(\"arraybad.tmp\", A); x = A[\"badtype\"] \"\"}" 2>NUL
+if %errorlevel% == 0 goto error16
+del arrayfile.tmp
+del arraybad.tmp
+comp temp.out arrayfile_test.out /m >NUL
+if not %errorlevel% == 0 goto error16
+echo  array files test passed
+echo.
+
+echo testing numbers in strings
+%1 -f number_test.awk mawktest.dat >temp.out
+if not %errorlevel% == 0 goto error17
+comp temp.out number_test.out /m >NUL
+if not %errorlevel% == 0 goto error17
+echo  numbers in strings test passed
+echo.
+
+echo testing records
+%1 -f record_test.awk mawktest.dat >temp.out
+if not %errorlevel% == 0 goto error18
+comp temp.out record_test.out /m >NUL
+if not %errorlevel% == 0 goto error18
+echo  records test passed
+echo.
+
+echo testing plain string main rules
+%1 -f rules_test.awk mawktest.dat >temp.out
+if not %errorlevel% == 0 goto error19
+comp temp.out rules_test.out /m >NUL
+if not %errorlevel% == 0 goto error19
+echo  plain string main rules test passed
+echo.
+
+echo testing string building
+%1 -f string_test.awk mawktest.dat >temp.out
+if not %errorlevel% == 0 goto error20
+comp temp.out string_test.out /m >NUL
+if not %errorlevel% == 0 goto error20
+echo  string building test passed
+echo.
+
 echo All tests passed
 %1 "{print \"Total test time was\",systime(1)-$1,\"secs\"}" start_time.out
 del temp.out
@@ -216,3 +292,24 @@ exit /b
 :error13
 echo test of misc functions not already tested failed
 exit /b
+:error14
+echo arrays test failed
+exit /b
+:error15
+echo arrays written to disk by -W memory test failed
+exit /b
+:error16
+echo array files test failed
+exit /b
+:error17
+echo numbers in strings test failed
+exit /b
+:error18
+echo records test failed
+exit /b
+:error19
+echo plain string main rules test failed
+exit /b
+:error20
+echo string building test failed
+exit /b
@@ -35,6 +35,7 @@ enum {
     C_SNULL , /* split on the empty string  */
     C_REPL , /* a replacement string   '\&' changed to &  */
     C_REPLV , /* a vector replacement -- broken on &  */
+    C_SLICE , /* part of a string, only for cat and print */
     NUM_CELL_TYPES 
 } ;
 
@@ -63,8 +64,16 @@ unsigned ref_cnt ;
 char str[4] ;
 } STRING ;
 
-/* number of bytes for a STRING of length len */
-#define  STRING_SIZE(len)  ((len)<=3?sizeof(STRING):sizeof(STRING)+(len)-3)
+/* number of bytes for a STRING of length len.  This is rounded up to
+   the 16 byte blocks of zmalloc(), and past the 512 bytes it pools to
+   an eighth of a power of 2, so a STRING can grow in place by the
+   room that is left, or be zrealloc()ed a few times as it doubles */
+#define  STRING_BYTES(len)  (sizeof(STRING)+(len)-3)
+#define  STRING_SIZE(len)  ((len)<=3 ? sizeof(STRING) :\
+                            STRING_BYTES(len) <= 512 ?\
+                            (STRING_BYTES(len)+15) & ~(size_t)15 :\
+                            string_size(len))
+size_t string_size(size_t) ;
 
 /* compare two strings for == */
 #define STRING_eq(s1,s2) ((s1)->len==(s2)->len && \
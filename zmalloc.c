@@ -15,7 +15,73 @@ you agree to not name that product mawk.
 
 #include  "mawk.h"
 #include  "zmalloc.h"
+#if defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+size_t mem_used ;
+size_t mem_budget = (size_t) -1 ;	/* no budget */
+
+/* for -W memstats: bytes in use, the most that were in use and the
+   number of allocations, for each tag and for each size in the 16 byte
+   steps of pool[] below, the last size is everything over 512 bytes */
+typedef struct {
+    size_t live ;
+    size_t peak ;
+    size_t count ;
+} ZStat ;
+
+#define  STAT_STEP   16
+#define  STAT_SIZES  32
+#define  size_class(sz)  ((sz) > STAT_STEP * STAT_SIZES ? STAT_SIZES :\
+			  ((sz) + STAT_STEP - 1) / STAT_STEP - 1)
+
+static ZStat tag_stat[ZT_CNT] ;
+static ZStat size_stat[STAT_SIZES + 1] ;
+static size_t mem_peak ;
+
+int mem_stats_flag ;
+volatile sig_atomic_t mem_stats_signal ;
+
+static void
+count_alloc(size_t sz, int tag)
+{
+    ZStat* t = &tag_stat[tag] ;
+    ZStat* s = &size_stat[size_class(sz)] ;
+
+    mem_used += sz ;
+    if (mem_used > mem_peak)  mem_peak = mem_used ;
+    t->count++ ;
+    t->live += sz ;
+    if (t->live > t->peak)  t->peak = t->live ;
+    s->count++ ;
+    s->live += sz ;
+    if (s->live > s->peak)  s->peak = s->live ;
+}
+
+static void
+count_free(size_t sz, int tag)
+{
+    mem_used -= sz ;
+    tag_stat[tag].live -= sz ;
+    size_stat[size_class(sz)].live -= sz ;
+}
+
+/* memory a subsystem gets from emalloc() goes from old to new bytes */
+void
+zcount(int tag, size_t old, size_t new)
+{
+    ZStat* t = &tag_stat[tag] ;
+
+    if (old == 0)  t->count++ ;
+    t->live += new - old ;
+    if (t->live > t->peak)  t->peak = t->live ;
+}
 
 static void
 out_of_mem(void)
@@ -48,21 +114,34 @@ void* erealloc(void* p, size_t sz)
 
 #ifdef  MEM_CHECK
 
-void* zmalloc(size_t sz)
+void* zmalloc_t(size_t sz, int tag)
 {
+    count_alloc(sz, tag) ;
     return emalloc(sz) ;
 }
 
-void* zrealloc(void* p, size_t old, size_t new)
+void* zrealloc_t(void* p, size_t old, size_t new, int tag)
 {
+    count_free(old, tag) ;
+    count_alloc(new, tag) ;
     return erealloc(p,new) ;
 }
 
-void zfree(void* p, size_t sz)
+void zfree_t(void* p, size_t sz, int tag)
 {
+    count_free(sz, tag) ;
     free(p) ;
 }
 
+void zreclaim(void)
+{
+}
+
+static void
+chunk_stats(FILE* fp)
+{
+}
+
 #else    /* usual  case */
 /*
   zmalloc() gets mem from emalloc() in chunks of ZSIZE * AVAIL_SZ
@@ -79,6 +158,7 @@ void zfree(void* p, size_t sz)
 typedef union zblock {
     union zblock* link ;
     double align ;
+    size_t live ;  /* in the first ZBlock of a chunk */
     char filler[16] ;
 } ZBlock ;
 #else /* original definition */
@@ -104,23 +184,103 @@ static size_t amt_avail ;
 
 #define AVAIL_SZ    (2*1024*1024/ZSIZE)   /* number of Zblocks to get from emalloc - 2Mbytes . Coding this way allows change of filler[] size without changing number of bytes in a memory allocation */
 
-#if 1 /* use windows virtual memory functions to directly get memory - this is slightly slower than using emalloc() ! */
-static void
-fill_avail(void)
-{   
-    void* ptr = VirtualAlloc(0, ZSIZE * AVAIL_SZ, MEM_RESERVE|MEM_COMMIT, PAGE_READWRITE); // see e.g. https://learn.microsoft.com/en-us/windows/win32/Memory/reserving-and-committing-memory 
-    if (ptr == NULL) out_of_mem() ;
-    avail = (ZBlock *)ptr ;
-    amt_avail = AVAIL_SZ ;
+/* The memory for avail comes from the OS in chunks of CHUNK bytes,
+   aligned on CHUNK, so the chunk a block is in is found by masking
+   its address.  The first ZBlock of a chunk counts its blocks that
+   are in use.  When a chunk has none in use, zreclaim() can take its
+   blocks off the pool[] lists and give its pages back to the OS.
+   Such a released chunk is the first to be used again.
+*/
+
+#define  CHUNK	(ZSIZE * AVAIL_SZ)
+#define  chunk_of(p)  ((ZBlock *) ((size_t) (p) & ~(size_t) (CHUNK - 1)))
+
+static struct chunk_rec {
+    ZBlock* base ;
+    int released ;
+} *chunk_list ;
+static size_t chunk_cnt ;
+static size_t chunk_max ;
+
+#define  RECLAIM_MIN  4	/* don't bother for fewer free chunks */
+
+#if defined(_WIN32) || defined(_WIN64)
+
+static ZBlock*
+os_chunk(void)
+{
+    while (1) {
+	/* find an aligned address, then ask for that */
+	char* r = (char*) VirtualAlloc(0, 2 * CHUNK, MEM_RESERVE, PAGE_NOACCESS) ;
+	char* q ;
+	void* p ;
+
+	if (r == NULL) out_of_mem() ;
+	q = (char*) (((size_t) r + CHUNK - 1) & ~(size_t) (CHUNK - 1)) ;
+	VirtualFree(r, 0, MEM_RELEASE) ;
+	p = VirtualAlloc(q, CHUNK, MEM_RESERVE|MEM_COMMIT, PAGE_READWRITE) ;
+	if (p) return (ZBlock*) p ;
+    }
 }
+
+#define  os_release(p)	VirtualFree(p, CHUNK, MEM_DECOMMIT)
+#define  os_reuse(p)	\
+	 if (!VirtualAlloc(p, CHUNK, MEM_COMMIT, PAGE_READWRITE)) out_of_mem()
+
 #else
+
+static ZBlock*
+os_chunk(void)
+{
+    char* r = (char*) mmap(0, 2 * CHUNK, PROT_READ|PROT_WRITE,
+			   MAP_PRIVATE|MAP_ANONYMOUS, -1, 0) ;
+    char* q ;
+
+    if (r == (char*) MAP_FAILED) out_of_mem() ;
+    /* keep the aligned CHUNK in the middle */
+    q = (char*) (((size_t) r + CHUNK - 1) & ~(size_t) (CHUNK - 1)) ;
+    if (q > r) munmap(r, q - r) ;
+    munmap(q + CHUNK, r + CHUNK - q) ;
+#ifdef MADV_HUGEPAGE
+    madvise(q, CHUNK, MADV_HUGEPAGE) ;
+#endif
+    return (ZBlock*) q ;
+}
+
+/* pages given back read as zero, which is an empty chunk */
+#define  os_release(p)	madvise(p, CHUNK, MADV_DONTNEED)
+#define  os_reuse(p)
+
+#endif
+
 static void
 fill_avail(void)
 {
-    avail = (ZBlock *)emalloc(ZSIZE * AVAIL_SZ) ;
-    amt_avail = AVAIL_SZ ;
+    ZBlock* c = 0 ;
+    size_t i ;
+
+    for (i = 0; i < chunk_cnt; i++) {
+	if (chunk_list[i].released) {
+	    c = chunk_list[i].base ;
+	    os_reuse(c) ;
+	    chunk_list[i].released = 0 ;
+	    break ;
+	}
+    }
+    if (c == 0) {
+	if (chunk_cnt == chunk_max) {
+	    chunk_max = chunk_max ? 2 * chunk_max : 16 ;
+	    chunk_list = (struct chunk_rec*)
+		erealloc(chunk_list, chunk_max * sizeof(struct chunk_rec)) ;
+	}
+	c = os_chunk() ;
+	chunk_list[chunk_cnt].base = c ;
+	chunk_list[chunk_cnt++].released = 0 ;
+    }
+    c->live = 0 ;
+    avail = c + 1 ;
+    amt_avail = AVAIL_SZ - 1 ;
 }
-#endif
 
 #define  POOL_SZ    32 /* was 16=>132 secs, 32=>132, 64=>133 secs */
 static ZBlock* pool[POOL_SZ] ;
@@ -128,8 +288,9 @@ static ZBlock* pool[POOL_SZ] ;
 #define zmalloc_limit  (POOL_SZ*ZSIZE) /* currently 32*16 =512 bytes with ZSIZE=16 , 16 bytes is the smallest allocation, then 32, 48,64,... 512 bytes - above that the system malloc is used */
 
 #if 1 /* new approach, if there is not a block of the correct size then cut a larger block up */
-void* zmalloc(size_t sz)
+void* zmalloc_t(size_t sz, int tag)
 {
+ count_alloc(sz, tag) ;
  if (sz > zmalloc_limit) 
  	{
      return emalloc(sz) ;
@@ -140,6 +301,7 @@ void* zmalloc(size_t sz)
 	{
      /* there is a block of the correct size already in the pool, just return it [ thats the fastest way to allocate memory ] */
      pool[blks-1] = p->link ;
+     chunk_of(p)->live += blks ;
      return p ;
 	}
 	
@@ -153,8 +315,9 @@ void* zmalloc(size_t sz)
 		 	 pool[i] = pi->link ; // take 1 block of space found
 		 	 p=pi; // 1st bit of space is what we return to caller
 		 	 pi+=blks;// rest we put into correct free list
-		 	 pi->link=pool[i-blks-1];
-		 	 pool[i-blks-1]=pi;
+		 	 pi->link=pool[i-blks]; /* pool[i] holds blocks of i+1 units, so i+1-blks units are left */
+		 	 pool[i-blks]=pi;
+		 	 chunk_of(p)->live += blks ;
 		 	 // printf("L");
 		 	 return p;
 		 	}
@@ -172,11 +335,13 @@ void* zmalloc(size_t sz)
  p = avail ;
  avail += blks ;
  amt_avail -= blks ;
+ chunk_of(p)->live += blks ;
  return p ;
 }
 #else /* original version */
-void* zmalloc(size_t sz)
+void* zmalloc_t(size_t sz, int tag)
 {
+    count_alloc(sz, tag) ;
     if (sz > zmalloc_limit) {
         return emalloc(sz) ;
     }
@@ -205,8 +370,9 @@ void* zmalloc(size_t sz)
 }
 #endif
 
-void zfree(void* p, size_t sz)
+void zfree_t(void* p, size_t sz, int tag)
 {
+    count_free(sz, tag) ;
     if (sz > zmalloc_limit) {
         free(p) ;
     }
@@ -216,20 +382,126 @@ void zfree(void* p, size_t sz)
 	ZBlock* zp = (ZBlock*) p ;
 	zp->link = pool[blks-1] ;
 	pool[blks-1] = zp ;
+	chunk_of(zp)->live -= blks ;
+    }
+}
+
+/* give chunks with no blocks in use back to the OS, called after
+   a big array is cleared.  The chunk avail is cut from is kept. */
+
+void zreclaim(void)
+{
+    ZBlock* keep = amt_avail ? chunk_of(avail) : 0 ;
+    size_t i, cnt = 0 ;
+
+    for (i = 0; i < chunk_cnt; i++) {
+	ZBlock* c = chunk_list[i].base ;
+	if (!chunk_list[i].released && c != keep && c->live == 0) cnt++ ;
+    }
+    if (cnt < RECLAIM_MIN) return ;
+
+    /* take their blocks off the pool[] lists */
+    for (i = 0; i < POOL_SZ; i++) {
+	ZBlock** pp = &pool[i] ;
+	ZBlock* p ;
+
+	while ((p = *pp) != 0) {
+	    ZBlock* c = chunk_of(p) ;
+	    if (c->live == 0 && c != keep) *pp = p->link ;
+	    else pp = &p->link ;
+	}
     }
+
+    for (i = 0; i < chunk_cnt; i++) {
+	ZBlock* c = chunk_list[i].base ;
+	if (!chunk_list[i].released && c != keep && c->live == 0) {
+	    os_release(c) ;
+	    chunk_list[i].released = 1 ;
+	}
+    }
+#ifdef __GLIBC__
+    /* and what free() holds of the big blocks */
+    malloc_trim(0) ;
+#endif
 }
 
-void* zrealloc(void* p, size_t old_size, size_t new_size)
+void* zrealloc_t(void* p, size_t old_size, size_t new_size, int tag)
 {
     if (new_size > zmalloc_limit && old_size > zmalloc_limit) {
+        count_free(old_size, tag) ;
+        count_alloc(new_size, tag) ;
         return erealloc(p,new_size) ;
     }
     else {
-        void* ret = zmalloc(new_size) ;
+        void* ret = zmalloc_t(new_size, tag) ;
         memcpy(ret, p, old_size < new_size ? old_size : new_size) ;
-        zfree(p, old_size) ;
+        zfree_t(p, old_size, tag) ;
 	return ret ;
     }
 }
 
+/* what the chunks from the OS hold that is not given out */
+static void
+chunk_stats(FILE* fp)
+{
+    size_t i, released = 0, pooled = amt_avail ;
+
+    for (i = 0; i < chunk_cnt; i++) {
+	if (chunk_list[i].released)  released++ ;
+    }
+    for (i = 0; i < POOL_SZ; i++) {
+	ZBlock* p ;
+	for (p = pool[i]; p; p = p->link)  pooled += i + 1 ;
+    }
+    fprintf(fp, "%llu chunks of %llu bytes, %llu released, "
+	    "%llu bytes free in pool[]\n",
+	    (unsigned long long) chunk_cnt, (unsigned long long) CHUNK,
+	    (unsigned long long) released,
+	    (unsigned long long) (pooled * ZSIZE)) ;
+}
+
 #endif
+
+static void
+stat_line(FILE* fp, const char* name, ZStat* st)
+{
+    fprintf(fp, "%-8s %14llu %14llu %12llu\n", name,
+	    (unsigned long long) st->live, (unsigned long long) st->peak,
+	    (unsigned long long) st->count) ;
+}
+
+/* the report for -W memstats.  The fin and re lines also count buffers
+   and machines from malloc(), which are not in the zmalloc total */
+void
+mem_stats(FILE* fp)
+{
+    static const char* const tag_name[ZT_CNT] = {
+	"other", "string", "array", "re", "code", "fin"
+    } ;
+    ZStat total ;
+    char name[16] ;
+    int i ;
+
+    mem_stats_signal = 0 ;
+    fprintf(fp, "%-8s %14s %14s %12s\n", "memory", "live", "peak",
+	    "allocs") ;
+    /* other goes last */
+    for (i = 1; i <= ZT_CNT; i++)
+	stat_line(fp, tag_name[i % ZT_CNT], &tag_stat[i % ZT_CNT]) ;
+
+    total.live = mem_used ;
+    total.peak = mem_peak ;
+    total.count = 0 ;
+    for (i = 0; i <= STAT_SIZES; i++)  total.count += size_stat[i].count ;
+    stat_line(fp, "zmalloc", &total) ;
+
+    fprintf(fp, "%-8s %14s %14s %12s\n", "size", "live", "peak", "allocs") ;
+    for (i = 0; i <= STAT_SIZES; i++) {
+	if (size_stat[i].count == 0)  continue ;
+	if (i == STAT_SIZES)  sprintf(name, ">%d", STAT_STEP * STAT_SIZES) ;
+	else  sprintf(name, "%d", STAT_STEP * (i + 1)) ;
+	stat_line(fp, name, &size_stat[i]) ;
+    }
+    chunk_stats(fp) ;
+    fflush(fp) ;
+}
@@ -18,16 +18,55 @@ you agree to not name that product mawk.
 #define  ZMALLOC_H
 
 #include <stddef.h>
+#include <stdio.h>
+#include <signal.h>
 
 void* emalloc(size_t) ;
 void* erealloc(void*,size_t) ;
 
-void* zmalloc(size_t) ;
-void* zrealloc(void*,size_t,size_t) ;
-void  zfree(void*,size_t) ;
+/* what zmalloc()ed memory is counted against for -W memstats.
+   A file sets ZTAG before it includes this for what it allocates,
+   memory freed in another file is tagged where it is freed */
+enum {
+    ZT_OTHER ,
+    ZT_STRING ,
+    ZT_ARRAY ,
+    ZT_RE ,
+    ZT_CODE ,
+    ZT_FIN ,
+    ZT_CNT
+} ;
+
+#ifndef  ZTAG
+#define  ZTAG  ZT_OTHER
+#endif
+
+void* zmalloc_t(size_t,int) ;
+void* zrealloc_t(void*,size_t,size_t,int) ;
+void  zfree_t(void*,size_t,int) ;
+void  zreclaim(void) ;
+
+#define zmalloc(sz)	zmalloc_t(sz,ZTAG)
+#define zrealloc(p,old,new)	zrealloc_t(p,old,new,ZTAG)
+#define zfree(p,sz)	zfree_t(p,sz,ZTAG)
 
 #define ZMALLOC(type)  ((type*)zmalloc(sizeof(type)))
 #define ZFREE(p)	zfree(p,sizeof(*(p)))
 
+/* memory from malloc() that a subsystem counts itself, going from
+   old to new bytes */
+void  zcount(int,size_t,size_t) ;
+
+/* -W memstats prints mem_stats() at exit, and when SIGUSR1 sets
+   mem_stats_signal */
+extern int mem_stats_flag ;
+extern volatile sig_atomic_t mem_stats_signal ;
+void  mem_stats(FILE*) ;
+
+/* bytes given out by zmalloc() and not yet freed, and the limit on
+   them set by -W memory, past which large arrays are written to disk */
+extern size_t mem_used ;
+extern size_t mem_budget ;
+
 
 #endif  /* ZMALLOC_H */